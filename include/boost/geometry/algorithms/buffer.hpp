@@ -19,6 +19,7 @@
 #define BOOST_GEOMETRY_ALGORITHMS_BUFFER_HPP
 
 #include <cstddef>
+#include <type_traits>
 
 #include <boost/numeric/conversion/cast.hpp>
 
@@ -39,6 +40,7 @@
 
 #include <boost/geometry/algorithms/detail/buffer/buffer_box.hpp>
 #include <boost/geometry/algorithms/detail/buffer/buffer_inserter.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_multi_point.hpp>
 
 namespace boost { namespace geometry
 {
@@ -178,31 +180,15 @@ Output return_buffer(Input const& geometry, Distance const& distance, Distance c
     return geometry_out;
 }
 
-/*!
-\brief \brief_calc{buffer}
-\ingroup buffer
-\details \details_calc{buffer, \det_buffer}.
-\tparam GeometryIn \tparam_geometry
-\tparam MultiPolygon \tparam_geometry{MultiPolygon}
-\tparam DistanceStrategy A strategy defining distance (or radius)
-\tparam SideStrategy A strategy defining creation along sides
-\tparam JoinStrategy A strategy defining creation around convex corners
-\tparam EndStrategy A strategy defining creation at linestring ends
-\tparam PointStrategy A strategy defining creation around points
-\param geometry_in \param_geometry
-\param geometry_out output multi polygon (or std:: collection of polygons),
-    will contain a buffered version of the input geometry
-\param distance_strategy The distance strategy to be used
-\param side_strategy The side strategy to be used
-\param join_strategy The join strategy to be used
-\param end_strategy The end strategy to be used
-\param point_strategy The point strategy to be used
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace buffer
+{
 
-\qbk{distinguish,with strategies}
-\qbk{[include reference/algorithms/buffer_with_strategies.qbk]}
- */
+// Buffers the geometry with the strategies. If Clustered, cartesian multi
+// points are buffered per cluster (see multi_point_inserter).
 template
 <
+    bool Clustered,
     typename GeometryIn,
     typename MultiPolygon,
     typename DistanceStrategy,
@@ -211,7 +197,7 @@ template
     typename EndStrategy,
     typename PointStrategy
 >
-inline void buffer(GeometryIn const& geometry_in,
+inline void buffer_with_strategies(GeometryIn const& geometry_in,
                 MultiPolygon& geometry_out,
                 DistanceStrategy const& distance_strategy,
                 SideStrategy const& side_strategy,
@@ -223,8 +209,8 @@ inline void buffer(GeometryIn const& geometry_in,
     concepts::check<GeometryIn const>();
     concepts::check<polygon_type>();
 
-    typedef typename point_type<GeometryIn>::type point_type;
-    typedef typename rescale_policy_type
+    typedef typename geometry::point_type<GeometryIn>::type point_type;
+    typedef typename geometry::rescale_policy_type
         <
             point_type,
             typename geometry::cs_tag<point_type>::type
@@ -242,7 +228,7 @@ inline void buffer(GeometryIn const& geometry_in,
     geometry::envelope(geometry_in, box);
     geometry::buffer(box, box, distance_strategy.max_distance(join_strategy, end_strategy));
 
-    typename strategies::relate::services::default_strategy
+    typename geometry::strategies::relate::services::default_strategy
         <
             GeometryIn, GeometryIn
         >::type strategies;
@@ -251,7 +237,12 @@ inline void buffer(GeometryIn const& geometry_in,
             = boost::geometry::get_rescale_policy<rescale_policy_type>(
                 box, strategies);
 
-    detail::buffer::buffer_inserter<polygon_type>(geometry_in,
+    // Without clustering multi_point_inserter falls back to buffer_inserter
+    multi_point_inserter
+        <
+            std::conditional_t<Clustered, typename tag<GeometryIn>::type, void>,
+            typename cs_tag<GeometryIn>::type
+        >::template apply<polygon_type>(geometry_in,
                 range::back_inserter(geometry_out),
                 distance_strategy,
                 side_strategy,
@@ -262,6 +253,106 @@ inline void buffer(GeometryIn const& geometry_in,
                 rescale_policy);
 }
 
+}} // namespace detail::buffer
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief \brief_calc{buffer}
+\ingroup buffer
+\details \details_calc{buffer, \det_buffer}.
+\tparam GeometryIn \tparam_geometry
+\tparam MultiPolygon \tparam_geometry{MultiPolygon}
+\tparam DistanceStrategy A strategy defining distance (or radius)
+\tparam SideStrategy A strategy defining creation along sides
+\tparam JoinStrategy A strategy defining creation around convex corners
+\tparam EndStrategy A strategy defining creation at linestring ends
+\tparam PointStrategy A strategy defining creation around points
+\param geometry_in \param_geometry
+\param geometry_out output multi polygon (or std:: collection of polygons),
+    will contain a buffered version of the input geometry
+\param distance_strategy The distance strategy to be used
+\param side_strategy The side strategy to be used
+\param join_strategy The join strategy to be used
+\param end_strategy The end strategy to be used
+\param point_strategy The point strategy to be used
+
+\qbk{distinguish,with strategies}
+\qbk{[include reference/algorithms/buffer_with_strategies.qbk]}
+ */
+template
+<
+    typename GeometryIn,
+    typename MultiPolygon,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+inline void buffer(GeometryIn const& geometry_in,
+                MultiPolygon& geometry_out,
+                DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                EndStrategy const& end_strategy,
+                PointStrategy const& point_strategy)
+{
+    detail::buffer::buffer_with_strategies<false>(geometry_in, geometry_out,
+        distance_strategy, side_strategy, join_strategy, end_strategy,
+        point_strategy);
+}
+
+/*!
+\brief \brief_calc{buffer}, clustering the points of multi points
+\ingroup buffer
+\details \details_calc{buffer, \det_buffer}.
+    Cartesian multi points are clustered on a grid first. The buffer of a
+    point without neighbours is created by the point strategy directly, the
+    buffers of the points of the other clusters are united per cluster.
+    This is faster than buffer for
+    large multi points, the output covers the same area but its polygons
+    and rings may start at other points and be ordered differently.
+    Other geometries are buffered like by buffer.
+\tparam GeometryIn \tparam_geometry
+\tparam MultiPolygon \tparam_geometry{MultiPolygon}
+\tparam DistanceStrategy A strategy defining distance (or radius)
+\tparam SideStrategy A strategy defining creation along sides
+\tparam JoinStrategy A strategy defining creation around convex corners
+\tparam EndStrategy A strategy defining creation at linestring ends
+\tparam PointStrategy A strategy defining creation around points
+\param geometry_in \param_geometry
+\param geometry_out output multi polygon (or std:: collection of polygons),
+    will contain a buffered version of the input geometry
+\param distance_strategy The distance strategy to be used
+\param side_strategy The side strategy to be used
+\param join_strategy The join strategy to be used
+\param end_strategy The end strategy to be used
+\param point_strategy The point strategy to be used
+ */
+template
+<
+    typename GeometryIn,
+    typename MultiPolygon,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+inline void buffer_clustered(GeometryIn const& geometry_in,
+                MultiPolygon& geometry_out,
+                DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                EndStrategy const& end_strategy,
+                PointStrategy const& point_strategy)
+{
+    detail::buffer::buffer_with_strategies<true>(geometry_in, geometry_out,
+        distance_strategy, side_strategy, join_strategy, end_strategy,
+        point_strategy);
+}
+
 
 }} // namespace boost::geometry
 
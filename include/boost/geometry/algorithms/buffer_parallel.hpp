@@ -0,0 +1,128 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_BUFFER_PARALLEL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_BUFFER_PARALLEL_HPP
+
+
+#include <cstddef>
+
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/buffer/buffer_box.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_parallel.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
+
+#include <boost/geometry/strategies/relate/services.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Calculates the buffer of a multi-geometry, using multiple threads
+\ingroup buffer
+\details Components of the multi-geometry of which the buffers can not
+    overlap are buffered independently, in separate threads. Components of
+    which the buffered envelopes overlap are buffered together. The result
+    has the same area as the result of buffer. Geometries which are not
+    cartesian are buffered as by buffer.
+\tparam MultiGeometry \tparam_geometry
+\tparam MultiPolygon \tparam_geometry{MultiPolygon}
+\param geometry_in \param_geometry
+\param geometry_out output multi polygon, will contain a buffered version
+    of the input geometry
+\param distance_strategy The distance strategy to be used
+\param side_strategy The side strategy to be used
+\param join_strategy The join strategy to be used
+\param end_strategy The end strategy to be used
+\param point_strategy The point strategy to be used
+\param thread_count maximal number of threads to use, 0 means the number
+    of hardware threads
+ */
+template
+<
+    typename MultiGeometry,
+    typename MultiPolygon,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+inline void buffer_parallel(MultiGeometry const& geometry_in,
+                MultiPolygon& geometry_out,
+                DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                EndStrategy const& end_strategy,
+                PointStrategy const& point_strategy,
+                std::size_t thread_count = 0)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    concepts::check<MultiGeometry const>();
+    concepts::check<polygon_type>();
+
+    typedef typename point_type<MultiGeometry>::type point_type;
+    typedef typename rescale_policy_type
+        <
+            point_type,
+            typename geometry::cs_tag<point_type>::type
+        >::type rescale_policy_type;
+
+    geometry_out.clear();
+
+    if (geometry::is_empty(geometry_in))
+    {
+        // Then output geometry is kept empty as well
+        return;
+    }
+
+    model::box<point_type> box;
+    geometry::envelope(geometry_in, box);
+    detail::buffer::buffer_box(box,
+        distance_strategy.max_distance(join_strategy, end_strategy), box);
+
+    typename strategies::relate::services::default_strategy
+        <
+            MultiGeometry, MultiGeometry
+        >::type strategies;
+
+    // The rescale policy is based on the whole input, such that all
+    // clusters use the same
+    rescale_policy_type rescale_policy
+            = boost::geometry::get_rescale_policy<rescale_policy_type>(
+                box, strategies);
+
+    detail::buffer::buffer_parallel_inserter<polygon_type>(geometry_in,
+                range::back_inserter(geometry_out),
+                distance_strategy,
+                side_strategy,
+                join_strategy,
+                end_strategy,
+                point_strategy,
+                strategies,
+                rescale_policy,
+                thread_count);
+}
+
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_BUFFER_PARALLEL_HPP
@@ -0,0 +1,233 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_BUFFER_TILED_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_BUFFER_TILED_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/buffer.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_box.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_parallel.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_tiled.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/strategies/relate/services.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Calculates the buffer of a geometry, clipped to tiles, tile by tile
+\ingroup buffer
+\details The buffer is calculated per tile, for the part of the input which
+    can reach that tile, and then clipped to the tile. Components which can
+    not be clipped before buffering (areal components, for a negative
+    distance) are buffered once and kept until their last tile. The result for each
+    tile is passed to the visitor, as soon as it is calculated, and is not
+    kept afterwards. Therefore the buffer of the whole input is never
+    materialized. The tiles are typically a grid of boxes, but can be
+    any range of boxes. The visitor is called for every tile, in the order
+    of the tiles, also for tiles with an empty result, as
+    visitor.apply(tile_index, multi_polygon).
+\tparam MultiPolygon \tparam_geometry{MultiPolygon}, the type of the
+    result per tile
+\tparam GeometryIn \tparam_geometry
+\tparam Tiles range of boxes
+\tparam Visitor policy with an apply function taking the tile index and
+    the result within that tile
+\param geometry_in \param_geometry
+\param tiles the tiles
+\param visitor the visitor receiving the results per tile
+\param distance_strategy The distance strategy to be used
+\param side_strategy The side strategy to be used
+\param join_strategy The join strategy to be used
+\param end_strategy The end strategy to be used
+\param point_strategy The point strategy to be used
+ */
+template
+<
+    typename MultiPolygon,
+    typename GeometryIn,
+    typename Tiles,
+    typename Visitor,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+inline void buffer_tiled(GeometryIn const& geometry_in,
+                Tiles const& tiles,
+                Visitor& visitor,
+                DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                EndStrategy const& end_strategy,
+                PointStrategy const& point_strategy)
+{
+    typedef detail::buffer::tile_components<GeometryIn> components;
+    typedef typename components::component_type component_type;
+    typedef detail::buffer::tile_part
+        <
+            typename tag<component_type>::type
+        > tile_part;
+    typedef typename point_type<GeometryIn>::type point_type;
+    typedef typename tile_part::template part_type<point_type>::type part_type;
+    typedef model::box<point_type> box_type;
+    typedef detail::buffer::component_box<box_type> item_type;
+
+    concepts::check<GeometryIn const>();
+    concepts::check<typename boost::range_value<MultiPolygon>::type>();
+
+    typedef typename strategies::relate::services::default_strategy
+        <
+            GeometryIn, GeometryIn
+        >::type strategy_type;
+    strategy_type strategies;
+
+    bool const deflate = distance_strategy.negative();
+
+    // The tiles are enlarged, instead of the components, because the
+    // enlarged tile is also used to clip the components
+    std::vector<item_type> tile_items;
+    tile_items.reserve(boost::size(tiles));
+    for (std::size_t i = 0; i < boost::size(tiles); i++)
+    {
+        item_type item;
+        item.index = i;
+        item.component = i;
+        detail::buffer::buffer_box(range::at(tiles, i),
+            distance_strategy.max_distance(join_strategy, end_strategy),
+            item.box);
+        tile_items.push_back(item);
+    }
+
+    std::vector<item_type> component_items;
+    component_items.reserve(components::size(geometry_in));
+    for (std::size_t i = 0; i < components::size(geometry_in); i++)
+    {
+        component_type const& component = components::at(geometry_in, i);
+        if (geometry::is_empty(component))
+        {
+            continue;
+        }
+        item_type item;
+        item.index = component_items.size();
+        item.component = i;
+        geometry::envelope(component, item.box, strategies);
+        component_items.push_back(item);
+    }
+
+    std::vector<std::vector<std::size_t> > tile_components(tile_items.size());
+    detail::buffer::tile_component_visitor<strategy_type>
+        component_visitor(tile_components, strategies);
+
+    geometry::partition
+        <
+            box_type
+        >::apply(tile_items, component_items, component_visitor,
+                 detail::buffer::get_component_box<strategy_type>(strategies),
+                 detail::buffer::overlaps_component_box<strategy_type>(strategies));
+
+    // The last tile of each component, to release the buffers of
+    // whole components after it
+    std::vector<std::size_t> last_tile(components::size(geometry_in), 0);
+    for (std::size_t i = 0; i < tile_components.size(); i++)
+    {
+        for (std::size_t j = 0; j < tile_components[i].size(); j++)
+        {
+            last_tile[tile_components[i][j]] = i;
+        }
+    }
+
+    std::map<std::size_t, MultiPolygon> whole_buffers;
+    bool const whole = tile_part::whole(deflate);
+
+    for (std::size_t i = 0; i < tile_items.size(); i++)
+    {
+        std::vector<std::size_t>& indexes = tile_components[i];
+        std::sort(indexes.begin(), indexes.end());
+
+        MultiPolygon result;
+        if (whole)
+        {
+            // The deflated components of a valid geometry do not overlap,
+            // their clipped buffers are collected without union
+            for (std::size_t j = 0; j < indexes.size(); j++)
+            {
+                typename std::map<std::size_t, MultiPolygon>::iterator it
+                    = whole_buffers.find(indexes[j]);
+                if (it == whole_buffers.end())
+                {
+                    it = whole_buffers.insert(std::make_pair(indexes[j],
+                                                             MultiPolygon())).first;
+                    geometry::buffer(components::at(geometry_in, indexes[j]),
+                                     it->second, distance_strategy,
+                                     side_strategy, join_strategy,
+                                     end_strategy, point_strategy);
+                }
+
+                MultiPolygon clipped;
+                geometry::intersection(it->second, range::at(tiles, i), clipped);
+                for (std::size_t k = 0; k < boost::size(clipped); k++)
+                {
+                    range::push_back(result, range::at(clipped, k));
+                }
+
+                if (last_tile[indexes[j]] == i)
+                {
+                    whole_buffers.erase(it);
+                }
+            }
+            visitor.apply(i, result);
+            continue;
+        }
+
+        part_type part;
+        for (std::size_t j = 0; j < indexes.size(); j++)
+        {
+            tile_part::apply(components::at(geometry_in, indexes[j]),
+                             tile_items[i].box, deflate, part);
+        }
+
+        if (! geometry::is_empty(part))
+        {
+            MultiPolygon buffered;
+            geometry::buffer(part, buffered, distance_strategy, side_strategy,
+                             join_strategy, end_strategy, point_strategy);
+            geometry::intersection(buffered, range::at(tiles, i), result);
+        }
+        visitor.apply(i, result);
+    }
+}
+
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_BUFFER_TILED_HPP
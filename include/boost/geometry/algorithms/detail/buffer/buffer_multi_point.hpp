@@ -0,0 +1,416 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_MULTI_POINT_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_MULTI_POINT_HPP
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/buffer/buffer_inserter.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/multi_polygon.hpp>
+
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace buffer
+{
+
+// A point with the grid cell it is located in
+struct grid_point
+{
+    double x, y; // cell
+    std::size_t index;
+
+    inline bool operator<(grid_point const& other) const
+    {
+        return x < other.x
+            || (x == other.x && (y < other.y
+                || (y == other.y && index < other.index)));
+    }
+};
+
+// Clusters points of which the buffers might overlap. Points are assigned to
+// a grid with cells of twice the buffer distance. All points in a cell are
+// within that distance in both dimensions, points in neighbouring cells are
+// compared.
+class point_clusters
+{
+public :
+    template <typename MultiPoint>
+    inline point_clusters(MultiPoint const& multi_point, double distance)
+        : m_parent(boost::size(multi_point))
+    {
+        double const cell_size = 2.0 * distance;
+
+        std::vector<grid_point> grid;
+        grid.reserve(boost::size(multi_point));
+        std::size_t index = 0;
+        for (typename boost::range_iterator<MultiPoint const>::type
+                it = boost::begin(multi_point);
+             it != boost::end(multi_point);
+             ++it, ++index)
+        {
+            grid_point gp;
+            gp.x = std::floor(geometry::get<0>(*it) / cell_size);
+            gp.y = std::floor(geometry::get<1>(*it) / cell_size);
+            gp.index = index;
+            grid.push_back(gp);
+            m_parent[index] = index;
+        }
+        std::sort(grid.begin(), grid.end());
+
+        for (std::size_t begin = 0; begin < grid.size(); )
+        {
+            std::size_t end = cell_end(grid, begin);
+            for (std::size_t i = begin + 1; i < end; i++)
+            {
+                join(grid[begin].index, grid[i].index);
+            }
+
+            // Compare with the neighbouring cells not compared before
+            double const dxs[4] = { 0, 1, 1, 1 };
+            double const dys[4] = { 1, -1, 0, 1 };
+            for (int n = 0; n < 4; n++)
+            {
+                join_cells(multi_point, grid, begin, end,
+                           grid[begin].x + dxs[n], grid[begin].y + dys[n],
+                           cell_size);
+            }
+            begin = end;
+        }
+    }
+
+    inline std::size_t find(std::size_t i)
+    {
+        while (m_parent[i] != i)
+        {
+            m_parent[i] = m_parent[m_parent[i]];
+            i = m_parent[i];
+        }
+        return i;
+    }
+
+    // Returns the indexes of the points per cluster, ordered by their
+    // first point
+    inline std::vector<std::vector<std::size_t> > get()
+    {
+        std::size_t const none = m_parent.size();
+        std::vector<std::size_t> cluster_of_root(m_parent.size(), none);
+        std::vector<std::vector<std::size_t> > result;
+        for (std::size_t i = 0; i < m_parent.size(); i++)
+        {
+            std::size_t const root = find(i);
+            if (cluster_of_root[root] == none)
+            {
+                cluster_of_root[root] = result.size();
+                result.push_back(std::vector<std::size_t>());
+            }
+            result[cluster_of_root[root]].push_back(i);
+        }
+        return result;
+    }
+
+private :
+    static inline std::size_t cell_end(std::vector<grid_point> const& grid,
+                                       std::size_t begin)
+    {
+        std::size_t end = begin + 1;
+        while (end < grid.size()
+               && grid[end].x == grid[begin].x
+               && grid[end].y == grid[begin].y)
+        {
+            end++;
+        }
+        return end;
+    }
+
+    inline void join(std::size_t i, std::size_t j)
+    {
+        std::size_t const root_i = find(i);
+        std::size_t const root_j = find(j);
+        if (root_i < root_j)
+        {
+            m_parent[root_j] = root_i;
+        }
+        else if (root_j < root_i)
+        {
+            m_parent[root_i] = root_j;
+        }
+    }
+
+    template <typename MultiPoint>
+    inline void join_cells(MultiPoint const& multi_point,
+                           std::vector<grid_point> const& grid,
+                           std::size_t begin, std::size_t end,
+                           double x, double y, double cell_size)
+    {
+        grid_point first;
+        first.x = x;
+        first.y = y;
+        first.index = 0;
+        std::size_t const other_begin = std::lower_bound(grid.begin(),
+                grid.end(), first) - grid.begin();
+        if (other_begin == grid.size()
+            || grid[other_begin].x != x || grid[other_begin].y != y
+            || find(grid[begin].index) == find(grid[other_begin].index))
+        {
+            return;
+        }
+
+        std::size_t const other_end = cell_end(grid, other_begin);
+        for (std::size_t i = begin; i < end; i++)
+        {
+            for (std::size_t j = other_begin; j < other_end; j++)
+            {
+                if (near(range::at(multi_point, grid[i].index),
+                         range::at(multi_point, grid[j].index), cell_size))
+                {
+                    join(grid[i].index, grid[j].index);
+                    return;
+                }
+            }
+        }
+    }
+
+    template <typename Point>
+    static inline bool near(Point const& p1, Point const& p2, double d)
+    {
+        return geometry::math::abs(geometry::get<0>(p1) - geometry::get<0>(p2)) <= d
+            && geometry::math::abs(geometry::get<1>(p1) - geometry::get<1>(p2)) <= d;
+    }
+
+    std::vector<std::size_t> m_parent;
+};
+
+// Appends the buffer of one point as a polygon
+template
+<
+    typename GeometryOutput,
+    typename Point,
+    typename OutputIterator,
+    typename DistanceStrategy,
+    typename PointStrategy
+>
+inline void buffer_single_point(Point const& point, OutputIterator& out,
+        DistanceStrategy const& distance_strategy,
+        PointStrategy const& point_strategy)
+{
+    typedef typename point_type<GeometryOutput>::type output_point_type;
+
+    // The point strategy generates a closed clockwise ring
+    std::vector<output_point_type> range_out;
+    point_strategy.apply(point, distance_strategy, range_out);
+    if (BOOST_GEOMETRY_CONDITION(
+            geometry::point_order<GeometryOutput>::value == counterclockwise))
+    {
+        std::reverse(range_out.begin(), range_out.end());
+    }
+    if (BOOST_GEOMETRY_CONDITION(
+            geometry::closure<GeometryOutput>::value == open))
+    {
+        range_out.pop_back();
+    }
+
+    GeometryOutput polygon;
+    typename ring_type<GeometryOutput>::type& ring = exterior_ring(polygon);
+    for (std::size_t i = 0; i < range_out.size(); i++)
+    {
+        range::push_back(ring, range_out[i]);
+    }
+    *out++ = polygon;
+}
+
+// Orders the indexes of the points of a cluster along the x-axis
+template <typename MultiPoint>
+struct cluster_point_less
+{
+    MultiPoint const& multi_point;
+
+    inline bool operator()(std::size_t i, std::size_t j) const
+    {
+        return geometry::get<0>(range::at(multi_point, i))
+             < geometry::get<0>(range::at(multi_point, j));
+    }
+};
+
+// Appends the union of the buffers of the points of a cluster. The circles
+// are generated directly and united pairwise, in rounds (a cascaded union),
+// neighbouring along the x-axis, which keeps the united parts small.
+template
+<
+    typename GeometryOutput,
+    typename MultiPoint,
+    typename OutputIterator,
+    typename DistanceStrategy,
+    typename PointStrategy,
+    typename Strategies
+>
+inline void buffer_cluster(MultiPoint const& multi_point,
+        std::vector<std::size_t> cluster, OutputIterator& out,
+        DistanceStrategy const& distance_strategy,
+        PointStrategy const& point_strategy,
+        Strategies const& strategies)
+{
+    typedef model::multi_polygon<GeometryOutput> multi_polygon_type;
+
+    cluster_point_less<MultiPoint> const less = { multi_point };
+    std::sort(cluster.begin(), cluster.end(), less);
+
+    std::vector<multi_polygon_type> parts(cluster.size());
+    for (std::size_t i = 0; i < cluster.size(); i++)
+    {
+        range::back_insert_iterator<multi_polygon_type>
+            part_out = range::back_inserter(parts[i]);
+        buffer_single_point<GeometryOutput>(
+            range::at(multi_point, cluster[i]), part_out,
+            distance_strategy, point_strategy);
+    }
+
+    for (std::size_t step = 1; step < parts.size(); step *= 2)
+    {
+        for (std::size_t i = 0; i + step < parts.size(); i += 2 * step)
+        {
+            multi_polygon_type united;
+            geometry::union_(parts[i], parts[i + step], united, strategies);
+            parts[i] = std::move(united);
+            parts[i + step].clear();
+        }
+    }
+
+    for (std::size_t i = 0; i < parts.front().size(); i++)
+    {
+        *out++ = std::move(parts.front()[i]);
+    }
+}
+
+template <typename Tag, typename CsTag>
+struct multi_point_inserter
+{
+    template
+    <
+        typename GeometryOutput,
+        typename GeometryInput,
+        typename OutputIterator,
+        typename DistanceStrategy,
+        typename SideStrategy,
+        typename JoinStrategy,
+        typename EndStrategy,
+        typename PointStrategy,
+        typename Strategies,
+        typename RobustPolicy
+    >
+    static inline void apply(GeometryInput const& geometry_input,
+            OutputIterator out,
+            DistanceStrategy const& distance_strategy,
+            SideStrategy const& side_strategy,
+            JoinStrategy const& join_strategy,
+            EndStrategy const& end_strategy,
+            PointStrategy const& point_strategy,
+            Strategies const& strategies,
+            RobustPolicy const& robust_policy)
+    {
+        buffer_inserter<GeometryOutput>(geometry_input, out,
+            distance_strategy, side_strategy, join_strategy,
+            end_strategy, point_strategy, strategies, robust_policy);
+    }
+};
+
+// Cartesian multi points are clustered on a grid (used by buffer_clustered).
+// The buffer of a point without neighbours is generated directly, the
+// buffers of the points of the other clusters are united per cluster.
+// This avoids one piece collection with all points.
+template <>
+struct multi_point_inserter<multi_point_tag, cartesian_tag>
+{
+    template
+    <
+        typename GeometryOutput,
+        typename MultiPoint,
+        typename OutputIterator,
+        typename DistanceStrategy,
+        typename SideStrategy,
+        typename JoinStrategy,
+        typename EndStrategy,
+        typename PointStrategy,
+        typename Strategies,
+        typename RobustPolicy
+    >
+    static inline void apply(MultiPoint const& multi_point,
+            OutputIterator out,
+            DistanceStrategy const& distance_strategy,
+            SideStrategy const& side_strategy,
+            JoinStrategy const& join_strategy,
+            EndStrategy const& end_strategy,
+            PointStrategy const& point_strategy,
+            Strategies const& strategies,
+            RobustPolicy const& robust_policy)
+    {
+        double const distance = geometry::math::abs(
+            distance_strategy.max_distance(join_strategy, end_strategy));
+
+        if (boost::size(multi_point) < 2
+            || distance_strategy.negative()
+            || ! (distance > 0))
+        {
+            buffer_inserter<GeometryOutput>(multi_point, out,
+                distance_strategy, side_strategy, join_strategy,
+                end_strategy, point_strategy, strategies, robust_policy);
+            return;
+        }
+
+        point_clusters clusters(multi_point, distance);
+        std::vector<std::vector<std::size_t> > const indexes = clusters.get();
+
+        for (std::size_t i = 0; i < indexes.size(); i++)
+        {
+            std::vector<std::size_t> const& cluster = indexes[i];
+            if (cluster.size() == 1)
+            {
+                buffer_single_point<GeometryOutput>(
+                    range::at(multi_point, cluster.front()), out,
+                    distance_strategy, point_strategy);
+                continue;
+            }
+
+            buffer_cluster<GeometryOutput>(multi_point, cluster, out,
+                distance_strategy, point_strategy, strategies);
+        }
+    }
+};
+
+
+}} // namespace detail::buffer
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_MULTI_POINT_HPP
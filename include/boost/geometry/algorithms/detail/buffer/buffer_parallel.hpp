@@ -0,0 +1,288 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_PARALLEL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_PARALLEL_HPP
+
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/buffer/buffer_box.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_inserter.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace buffer
+{
+
+template <typename Box>
+struct component_box
+{
+    Box box;
+    std::size_t index; // in the collection of boxes
+    std::size_t component; // in the multi-geometry
+};
+
+template <typename Strategy>
+struct get_component_box
+{
+    get_component_box(Strategy const& strategy)
+        : m_strategy(strategy)
+    {}
+
+    template <typename Box, typename Item>
+    inline void apply(Box& total, Item const& item) const
+    {
+        geometry::expand(total, item.box, m_strategy);
+    }
+
+    Strategy const& m_strategy;
+};
+
+template <typename Strategy>
+struct overlaps_component_box
+{
+    overlaps_component_box(Strategy const& strategy)
+        : m_strategy(strategy)
+    {}
+
+    template <typename Box, typename Item>
+    inline bool apply(Box const& box, Item const& item) const
+    {
+        return ! detail::disjoint::disjoint_box_box(box, item.box, m_strategy);
+    }
+
+    Strategy const& m_strategy;
+};
+
+// Joins components of which the buffered envelopes overlap into one cluster.
+// The root of a cluster is its first component.
+template <typename Strategy>
+struct cluster_visitor
+{
+    std::vector<std::size_t> m_parent;
+    Strategy const& m_strategy;
+
+    cluster_visitor(std::size_t count, Strategy const& strategy)
+        : m_parent(count)
+        , m_strategy(strategy)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            m_parent[i] = i;
+        }
+    }
+
+    inline std::size_t find(std::size_t i)
+    {
+        while (m_parent[i] != i)
+        {
+            m_parent[i] = m_parent[m_parent[i]];
+            i = m_parent[i];
+        }
+        return i;
+    }
+
+    template <typename Item>
+    inline bool apply(Item const& item1, Item const& item2)
+    {
+        if (! detail::disjoint::disjoint_box_box(item1.box, item2.box, m_strategy))
+        {
+            std::size_t const root1 = find(item1.index);
+            std::size_t const root2 = find(item2.index);
+            if (root1 < root2)
+            {
+                m_parent[root2] = root1;
+            }
+            else if (root2 < root1)
+            {
+                m_parent[root1] = root2;
+            }
+        }
+        return true;
+    }
+};
+
+// Returns the indexes of the boxes per cluster, ordered by their
+// first box
+template <typename Box, typename Strategy>
+inline std::vector<std::vector<std::size_t> >
+    cluster_components(std::vector<component_box<Box> > const& boxes,
+                       Strategy const& strategy)
+{
+    cluster_visitor<Strategy> visitor(boxes.size(), strategy);
+    geometry::partition
+        <
+            Box
+        >::apply(boxes, visitor,
+                 get_component_box<Strategy>(strategy),
+                 overlaps_component_box<Strategy>(strategy));
+
+    std::size_t const none = boxes.size();
+    std::vector<std::size_t> cluster_of_root(boxes.size(), none);
+    std::vector<std::vector<std::size_t> > result;
+    for (std::size_t i = 0; i < boxes.size(); i++)
+    {
+        std::size_t const root = visitor.find(i);
+        if (cluster_of_root[root] == none)
+        {
+            cluster_of_root[root] = result.size();
+            result.push_back(std::vector<std::size_t>());
+        }
+        result[cluster_of_root[root]].push_back(i);
+    }
+    return result;
+}
+
+/*!
+    \brief Buffers a multi-geometry, buffering clusters of components in
+        separate threads
+    \details Components of which the buffered envelopes do not overlap have
+        buffers which do not overlap. Components are therefore clustered on
+        their buffered envelopes, and every cluster is buffered on its own, with
+        its own piece collection. The output of the clusters is appended in
+        the order of their first component.
+*/
+template
+<
+    typename GeometryOutput,
+    typename Multi,
+    typename OutputIterator,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy,
+    typename Strategies,
+    typename RobustPolicy
+>
+inline void buffer_parallel_inserter(Multi const& multi, OutputIterator out,
+        DistanceStrategy const& distance_strategy,
+        SideStrategy const& side_strategy,
+        JoinStrategy const& join_strategy,
+        EndStrategy const& end_strategy,
+        PointStrategy const& point_strategy,
+        Strategies const& strategies,
+        RobustPolicy const& robust_policy,
+        std::size_t thread_count)
+{
+    typedef model::box<typename point_type<Multi>::type> box_type;
+
+    // The envelopes are buffered by the distance, this is only done for
+    // cartesian geometries
+    bool const cartesian = std::is_same
+        <
+            typename cs_tag<Multi>::type, cartesian_tag
+        >::value;
+
+    if (boost::size(multi) < 2 || ! BOOST_GEOMETRY_CONDITION(cartesian))
+    {
+        buffer_inserter<GeometryOutput>(multi, out,
+            distance_strategy, side_strategy, join_strategy,
+            end_strategy, point_strategy, strategies, robust_policy);
+        return;
+    }
+
+    std::vector<component_box<box_type> > boxes;
+    boxes.reserve(boost::size(multi));
+    std::size_t component = 0;
+    for (typename boost::range_iterator<Multi const>::type it = boost::begin(multi);
+         it != boost::end(multi); ++it, ++component)
+    {
+        if (geometry::is_empty(*it))
+        {
+            continue;
+        }
+        component_box<box_type> item;
+        item.index = boxes.size();
+        item.component = component;
+        geometry::envelope(*it, item.box, strategies);
+        detail::buffer::buffer_box(item.box,
+            distance_strategy.max_distance(join_strategy, end_strategy),
+            item.box);
+        boxes.push_back(item);
+    }
+
+    std::vector<std::vector<std::size_t> > const clusters
+        = cluster_components(boxes, strategies);
+    if (clusters.size() < 2)
+    {
+        buffer_inserter<GeometryOutput>(multi, out,
+            distance_strategy, side_strategy, join_strategy,
+            end_strategy, point_strategy, strategies, robust_policy);
+        return;
+    }
+
+    // Clusters are also buffered separately if there is one thread,
+    // because the effort of a piece collection grows faster than linear
+    std::vector<std::vector<GeometryOutput> > results(clusters.size());
+    parallel_for(clusters.size(), parallel_thread_count(thread_count),
+                 [&](std::size_t i)
+    {
+        std::vector<std::size_t> const& cluster = clusters[i];
+        if (cluster.size() == 1)
+        {
+            buffer_inserter<GeometryOutput>(
+                range::at(multi, boxes[cluster.front()].component),
+                std::back_inserter(results[i]),
+                distance_strategy, side_strategy, join_strategy,
+                end_strategy, point_strategy, strategies, robust_policy);
+            return;
+        }
+
+        Multi part;
+        for (std::size_t j = 0; j < cluster.size(); j++)
+        {
+            range::push_back(part, range::at(multi, boxes[cluster[j]].component));
+        }
+        buffer_inserter<GeometryOutput>(part, std::back_inserter(results[i]),
+            distance_strategy, side_strategy, join_strategy,
+            end_strategy, point_strategy, strategies, robust_policy);
+    });
+
+    for (std::size_t i = 0; i < results.size(); i++)
+    {
+        for (std::size_t j = 0; j < results[i].size(); j++)
+        {
+            *out++ = std::move(results[i][j]);
+        }
+    }
+}
+
+}} // namespace detail::buffer
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_PARALLEL_HPP
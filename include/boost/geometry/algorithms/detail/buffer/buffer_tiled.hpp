@@ -0,0 +1,198 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_TILED_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_TILED_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_parallel.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/linestring.hpp>
+#include <boost/geometry/geometries/multi_linestring.hpp>
+#include <boost/geometry/geometries/multi_point.hpp>
+#include <boost/geometry/geometries/multi_polygon.hpp>
+#include <boost/geometry/geometries/polygon.hpp>
+
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace buffer
+{
+
+// Access to the components of a geometry, a single geometry is its own
+// only component
+template <typename Geometry, bool IsMulti = util::is_multi<Geometry>::value>
+struct tile_components
+{
+    typedef Geometry component_type;
+
+    static inline std::size_t size(Geometry const& )
+    {
+        return 1;
+    }
+
+    static inline Geometry const& at(Geometry const& geometry, std::size_t )
+    {
+        return geometry;
+    }
+};
+
+template <typename Geometry>
+struct tile_components<Geometry, true>
+{
+    typedef typename boost::range_value<Geometry>::type component_type;
+
+    static inline std::size_t size(Geometry const& geometry)
+    {
+        return boost::size(geometry);
+    }
+
+    static inline component_type const& at(Geometry const& geometry,
+                                            std::size_t index)
+    {
+        return range::at(geometry, index);
+    }
+};
+
+// Collects the part of a component which can influence the buffer within
+// a tile. The box is the tile, enlarged by the maximal buffer distance.
+// Linear and areal components are clipped by it. For a negative distance
+// the areal components are whole: a deflated polygon can not be derived
+// from a part of the polygon. These are buffered once, on their own.
+template <typename Tag>
+struct tile_part
+{};
+
+template <>
+struct tile_part<point_tag>
+{
+    template <typename Point>
+    struct part_type
+    {
+        typedef model::multi_point<Point> type;
+    };
+
+    static inline bool whole(bool )
+    {
+        return false;
+    }
+
+    template <typename Point, typename Box, typename Part>
+    static inline void apply(Point const& point, Box const& box, bool, Part& part)
+    {
+        if (geometry::covered_by(point, box))
+        {
+            range::push_back(part, point);
+        }
+    }
+};
+
+template <>
+struct tile_part<linestring_tag>
+{
+    template <typename Point>
+    struct part_type
+    {
+        typedef model::multi_linestring<model::linestring<Point> > type;
+    };
+
+    static inline bool whole(bool )
+    {
+        return false;
+    }
+
+    template <typename Linestring, typename Box, typename Part>
+    static inline void apply(Linestring const& linestring, Box const& box,
+                             bool, Part& part)
+    {
+        Part clipped;
+        geometry::intersection(linestring, box, clipped);
+        for (std::size_t i = 0; i < boost::size(clipped); i++)
+        {
+            range::push_back(part, range::at(clipped, i));
+        }
+    }
+};
+
+template <>
+struct tile_part<polygon_tag>
+{
+    template <typename Point>
+    struct part_type
+    {
+        typedef model::multi_polygon<model::polygon<Point> > type;
+    };
+
+    static inline bool whole(bool deflate)
+    {
+        return deflate;
+    }
+
+    template <typename Areal, typename Box, typename Part>
+    static inline void apply(Areal const& areal, Box const& box,
+                             bool, Part& part)
+    {
+        Part clipped;
+        geometry::intersection(areal, box, clipped);
+        for (std::size_t i = 0; i < boost::size(clipped); i++)
+        {
+            range::push_back(part, range::at(clipped, i));
+        }
+    }
+};
+
+template <>
+struct tile_part<ring_tag>
+    : tile_part<polygon_tag>
+{};
+
+// Collects the components of which the buffered envelope overlaps a tile
+template <typename Strategy>
+struct tile_component_visitor
+{
+    std::vector<std::vector<std::size_t> >& m_components;
+    Strategy const& m_strategy;
+
+    tile_component_visitor(std::vector<std::vector<std::size_t> >& components,
+                           Strategy const& strategy)
+        : m_components(components)
+        , m_strategy(strategy)
+    {}
+
+    template <typename Tile, typename Component>
+    inline bool apply(Tile const& tile, Component const& component)
+    {
+        if (! detail::disjoint::disjoint_box_box(tile.box, component.box, m_strategy))
+        {
+            m_components[tile.index].push_back(component.component);
+        }
+        return true;
+    }
+};
+
+}} // namespace detail::buffer
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_BUFFER_BUFFER_TILED_HPP
@@ -29,6 +29,7 @@
 
 #include <boost/geometry/algorithms/detail/disjoint/linear_linear.hpp>
 #include <boost/geometry/algorithms/detail/disjoint/segment_box.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/segments.hpp>
 
 #include <boost/geometry/algorithms/for_each.hpp>
 
@@ -79,7 +80,9 @@ struct areal_areal
                              Geometry2 const& geometry2,
                              Strategy const& strategy)
     {
-        if ( ! disjoint_linear<Geometry1, Geometry2>::apply(geometry1, geometry2, strategy) )
+        // Only the existence of an intersection of the boundaries matters,
+        // so segments are intersected without calculating turns
+        if ( ! disjoint_segments<Geometry1, Geometry2>::apply(geometry1, geometry2, strategy) )
         {
             return false;
         }
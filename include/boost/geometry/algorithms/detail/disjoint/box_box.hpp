@@ -25,6 +25,8 @@
 
 #include <boost/geometry/algorithms/dispatch/disjoint.hpp>
 
+#include <boost/geometry/strategies/detail.hpp>
+
 // For backward compatibility
 #include <boost/geometry/strategies/cartesian/disjoint_box_box.hpp>
 #include <boost/geometry/strategies/spherical/disjoint_box_box.hpp>
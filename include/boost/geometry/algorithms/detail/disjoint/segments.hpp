@@ -0,0 +1,334 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_DISJOINT_SEGMENTS_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_DISJOINT_SEGMENTS_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/linear_linear.hpp>
+#include <boost/geometry/algorithms/detail/overlay/do_reverse.hpp>
+#include <boost/geometry/algorithms/detail/sections/cached_sections.hpp>
+#include <boost/geometry/algorithms/detail/sections/range_by_section.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_functions.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_pairs.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+
+#include <boost/geometry/policies/robustness/no_rescale_policy.hpp>
+
+#include <boost/geometry/util/promote_integral.hpp>
+
+#include <boost/geometry/views/closeable_view.hpp>
+#include <boost/geometry/views/detail/range_type.hpp>
+#include <boost/geometry/views/reversible_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace disjoint
+{
+
+// Pair of sections of which the boxes overlap, with the size of the overlap
+template <typename Section1, typename Section2, typename Value>
+struct section_pair
+{
+    Section1 const* section1;
+    Section2 const* section2;
+    Value area;
+    Value extent;
+
+    // Larger overlaps first
+    inline bool operator<(section_pair const& other) const
+    {
+        return area > other.area
+            || (area == other.area && extent > other.extent);
+    }
+};
+
+// Visitor of pairs of sections. The pairs of which the boxes overlap are
+// collected in batches of limited size, because the total number of pairs
+// can be large. The pairs of a batch are passed to the predicate with the
+// largest overlap first, until the predicate returns true.
+template
+<
+    typename Section1, typename Section2,
+    typename Strategy, typename Predicate
+>
+class section_pair_batches
+{
+    typedef typename geometry::coordinate_type
+        <
+            typename Section1::box_type
+        >::type coordinate_type;
+    typedef typename promote_integral<coordinate_type>::type value_type;
+    typedef section_pair<Section1, Section2, value_type> pair_type;
+
+public:
+    section_pair_batches(Predicate const& predicate,
+                         Strategy const& strategy,
+                         std::size_t batch_size)
+        : m_predicate(predicate)
+        , m_strategy(strategy)
+        , m_batch_size(batch_size)
+        , m_found(false)
+    {}
+
+    inline bool apply(Section1 const& sec1, Section2 const& sec2)
+    {
+        if (! detail::disjoint::disjoint_box_box(sec1.bounding_box,
+                                                 sec2.bounding_box,
+                                                 m_strategy))
+        {
+            pair_type pair;
+            pair.section1 = &sec1;
+            pair.section2 = &sec2;
+            pair.area = value_type(1);
+            pair.extent = value_type(0);
+            add_overlap<0>(pair, sec1.bounding_box, sec2.bounding_box);
+            add_overlap<1>(pair, sec1.bounding_box, sec2.bounding_box);
+            m_pairs.push_back(pair);
+
+            if (m_pairs.size() >= m_batch_size)
+            {
+                // false if interrupted
+                return ! flush();
+            }
+        }
+        return true;
+    }
+
+    // Passes the collected pairs to the predicate, returns true if it
+    // returned true for any pair passed until now
+    inline bool flush()
+    {
+        std::sort(m_pairs.begin(), m_pairs.end());
+        for (std::size_t i = 0; i < m_pairs.size() && ! m_found; i++)
+        {
+            m_found = m_predicate(*m_pairs[i].section1, *m_pairs[i].section2);
+        }
+        m_pairs.clear();
+        return m_found;
+    }
+
+private:
+    template <std::size_t Dimension, typename Box>
+    static inline void add_overlap(pair_type& pair,
+                                   Box const& box1, Box const& box2)
+    {
+        value_type const min_value = (std::max)(
+            value_type(geometry::get<min_corner, Dimension>(box1)),
+            value_type(geometry::get<min_corner, Dimension>(box2)));
+        value_type const max_value = (std::min)(
+            value_type(geometry::get<max_corner, Dimension>(box1)),
+            value_type(geometry::get<max_corner, Dimension>(box2)));
+        value_type const size = max_value > min_value
+            ? value_type(max_value - min_value) : value_type(0);
+        pair.area *= size;
+        pair.extent += size;
+    }
+
+    Predicate const& m_predicate;
+    Strategy const& m_strategy;
+    std::size_t m_batch_size;
+    bool m_found;
+    std::vector<pair_type> m_pairs;
+};
+
+/*!
+    \brief Checks if any segment of the first geometry intersects any segment
+        of the second geometry.
+    \details The geometries are sectionalized. Pairs of sections of which
+        the boxes overlap are collected in batches, and in every batch the
+        pairs with the largest overlap, most likely containing intersecting
+        segments, are visited first. The segments are intersected until the
+        first intersection is found. No turns are calculated.
+*/
+template <typename Geometry1, typename Geometry2>
+struct disjoint_segments
+{
+    static const bool reverse1 = overlay::do_reverse
+        <
+            geometry::point_order<Geometry1>::value
+        >::value;
+
+    static const bool reverse2 = overlay::do_reverse
+        <
+            geometry::point_order<Geometry2>::value
+        >::value;
+
+    typedef typename geometry::point_type<Geometry1>::type point_type;
+    typedef model::box<point_type> box_type;
+    typedef geometry::sections<box_type, 2> sections_type;
+    typedef typename boost::range_value<sections_type>::type section_type;
+
+    template <typename Geometry, bool Reverse>
+    struct view_type
+    {
+        typedef typename closeable_view
+            <
+                typename range_type<Geometry>::type const,
+                closure<Geometry>::value
+            >::type cview_type;
+
+        typedef typename reversible_view
+            <
+                cview_type const,
+                Reverse ? iterate_reverse : iterate_forward
+            >::type type;
+    };
+
+    /*!
+    \tparam Strategy relate (segments intersection) strategy
+    */
+    template <typename Strategy>
+    static inline bool apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             Strategy const& strategy)
+    {
+        typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
+
+        detail::no_rescale_policy robust_policy;
+
+        sections_type sections1, sections2;
+        sections_type const& sec1 = detail::section::get_sections
+            <
+                reverse1, dimensions
+            >(geometry1, robust_policy, sections1, strategy, 0);
+        sections_type const& sec2 = detail::section::get_sections
+            <
+                reverse2, dimensions
+            >(geometry2, robust_policy, sections2, strategy, 1);
+
+        auto const predicate = [&](section_type const& s1, section_type const& s2)
+        {
+            return intersecting(geometry1, s1, geometry2, s2, strategy);
+        };
+
+        section_pair_batches
+            <
+                section_type, section_type, Strategy, decltype(predicate)
+            > visitor(predicate, strategy, 256);
+
+        detail::section::visit_section_pairs<box_type>(sec1, sec2, visitor, strategy);
+
+        return ! visitor.flush();
+    }
+
+private:
+    // Returns true if any segment of the first section, reaching the box
+    // of the second section, intersects such a segment of the second section
+    template <typename Strategy>
+    static inline bool intersecting(Geometry1 const& geometry1,
+                                    section_type const& sec1,
+                                    Geometry2 const& geometry2,
+                                    section_type const& sec2,
+                                    Strategy const& strategy)
+    {
+        typedef typename view_type<Geometry1, reverse1>::cview_type cview_type1;
+        typedef typename view_type<Geometry1, reverse1>::type view_type1;
+        typedef typename view_type<Geometry2, reverse2>::cview_type cview_type2;
+        typedef typename view_type<Geometry2, reverse2>::type view_type2;
+
+        typedef typename boost::range_iterator<view_type1 const>::type iterator1;
+        typedef typename boost::range_iterator<view_type2 const>::type iterator2;
+
+        typedef typename geometry::point_type<Geometry2>::type point2_type;
+        typedef model::referring_segment<point_type const> segment1_type;
+        typedef model::referring_segment<point2_type const> segment2_type;
+
+        if ((sec1.duplicate && (sec1.count + 1) < sec1.range_count)
+           || (sec2.duplicate && (sec2.count + 1) < sec2.range_count))
+        {
+            // Sections containing only duplicates are skipped, their points
+            // are also part of adjacent sections (see get_turns)
+            return false;
+        }
+
+        cview_type1 cview1(range_by_section(geometry1, sec1));
+        cview_type2 cview2(range_by_section(geometry2, sec2));
+        view_type1 view1(cview1);
+        view_type2 view2(cview2);
+
+        detail::no_rescale_policy robust_policy;
+
+        iterator1 prev1, it1, end1;
+        start(sec1, view1, sec2.bounding_box, prev1, it1, end1);
+
+        for (prev1 = it1++;
+             it1 != end1 && ! detail::section::exceeding<0>(sec1.directions[0],
+                    *prev1, sec1.bounding_box, sec2.bounding_box, robust_policy);
+             prev1 = it1++)
+        {
+            segment1_type const segment1(*prev1, *it1);
+
+            iterator2 prev2, it2, end2;
+            start(sec2, view2, sec1.bounding_box, prev2, it2, end2);
+
+            for (prev2 = it2++;
+                 it2 != end2 && ! detail::section::exceeding<0>(sec2.directions[0],
+                        *prev2, sec2.bounding_box, sec1.bounding_box, robust_policy);
+                 prev2 = it2++)
+            {
+                segment2_type const segment2(*prev2, *it2);
+                if (! disjoint_segment
+                        <
+                            segment1_type, segment2_type
+                        >::apply(segment1, segment2, strategy))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Sets the iterators to the last point of a section preceding the
+    // other box, as in get_turns
+    template <typename Range, typename Iterator>
+    static inline void start(section_type const& section, Range const& range,
+                             box_type const& other_box,
+                             Iterator& prev, Iterator& it, Iterator& end)
+    {
+        detail::no_rescale_policy robust_policy;
+
+        it = boost::begin(range) + section.begin_index;
+        end = boost::begin(range) + section.end_index + 1;
+
+        prev = it++;
+        for (; it != end && detail::section::preceding<0>(section.directions[0],
+                    *it, section.bounding_box, other_box, robust_policy);
+             prev = it++)
+        {}
+        it = prev;
+    }
+};
+
+
+}} // namespace detail::disjoint
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_DISJOINT_SEGMENTS_HPP
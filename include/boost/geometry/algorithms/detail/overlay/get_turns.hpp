@@ -16,8 +16,11 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_GET_TURNS_HPP
 
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <map>
+#include <type_traits>
 
 #include <boost/array.hpp>
 #include <boost/concept_check.hpp>
@@ -36,9 +39,11 @@
 #include <boost/geometry/algorithms/detail/overlay/segment_identifier.hpp>
 #include <boost/geometry/algorithms/detail/partition.hpp>
 #include <boost/geometry/algorithms/detail/recalculate.hpp>
+#include <boost/geometry/algorithms/detail/sections/cached_sections.hpp>
 #include <boost/geometry/algorithms/detail/sections/range_by_section.hpp>
 #include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
 #include <boost/geometry/algorithms/detail/sections/section_functions.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_pairs.hpp>
 #include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
 
 #include <boost/geometry/core/access.hpp>
@@ -66,6 +71,10 @@
 #include <boost/geometry/views/reversible_view.hpp>
 #include <boost/geometry/views/detail/range_type.hpp>
 
+#if defined(BOOST_GEOMETRY_PARALLEL_PARTITION)
+#include <boost/geometry/algorithms/detail/partition_parallel.hpp>
+#endif
+
 
 #ifdef BOOST_GEOMETRY_DEBUG_INTERSECTION
 #  include <sstream>
@@ -457,6 +466,18 @@ private :
     }
 };
 
+template
+<
+    typename Geometry1, typename Geometry2,
+    bool Reverse1, bool Reverse2,
+    typename TurnPolicy,
+    typename Strategy,
+    typename RobustPolicy,
+    typename Turns,
+    typename InterruptPolicy
+>
+struct section_task_visitor;
+
 template
 <
     typename Geometry1, typename Geometry2,
@@ -469,6 +490,15 @@ template
 >
 struct section_visitor
 {
+    typedef section_task_visitor
+        <
+            Geometry1, Geometry2,
+            Reverse1, Reverse2,
+            TurnPolicy,
+            Strategy, RobustPolicy,
+            Turns, InterruptPolicy
+        > task_visitor_type;
+
     int m_source_id1;
     Geometry1 const& m_geometry1;
     int m_source_id2;
@@ -517,6 +547,56 @@ struct section_visitor
         return true;
     }
 
+    // Appends the turns of a part of the sections, visited in parallel
+    inline void merge(task_visitor_type& task_visitor)
+    {
+        std::move(boost::begin(task_visitor.m_turns),
+                  boost::end(task_visitor.m_turns),
+                  std::back_inserter(m_turns));
+    }
+
+};
+
+// Visitor of a part of the sections, used by partition_parallel,
+// collecting the turns in its own turns
+template
+<
+    typename Geometry1, typename Geometry2,
+    bool Reverse1, bool Reverse2,
+    typename TurnPolicy,
+    typename Strategy,
+    typename RobustPolicy,
+    typename Turns,
+    typename InterruptPolicy
+>
+struct section_task_visitor
+{
+    typedef section_visitor
+        <
+            Geometry1, Geometry2,
+            Reverse1, Reverse2,
+            TurnPolicy,
+            Strategy, RobustPolicy,
+            Turns, InterruptPolicy
+        > visitor_type;
+
+    Turns m_turns;
+    InterruptPolicy m_interrupt_policy;
+    visitor_type m_visitor;
+
+    explicit section_task_visitor(visitor_type const& visitor)
+        : m_interrupt_policy(visitor.m_interrupt_policy)
+        , m_visitor(visitor.m_source_id1, visitor.m_geometry1,
+                    visitor.m_source_id2, visitor.m_geometry2,
+                    visitor.m_strategy, visitor.m_rescale_policy,
+                    m_turns, m_interrupt_policy)
+    {}
+
+    template <typename Section>
+    inline bool apply(Section const& sec1, Section const& sec2)
+    {
+        return m_visitor.apply(sec1, sec2);
+    }
 };
 
 template
@@ -551,15 +631,22 @@ public:
             > box_type;
         typedef geometry::sections<box_type, 2> sections_type;
 
-        sections_type sec1, sec2;
+        sections_type sections1, sections2;
         typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
 
-        geometry::sectionalize<Reverse1, dimensions>(geometry1, robust_policy,
-                                                     sec1, strategy, 0);
-        geometry::sectionalize<Reverse2, dimensions>(geometry2, robust_policy,
-                                                     sec2, strategy, 1);
+        // The strategy might carry the sections of a geometry
+        sections_type const& sec1 = detail::section::get_sections
+            <
+                Reverse1, dimensions
+            >(geometry1, robust_policy, sections1, strategy, 0);
+        sections_type const& sec2 = detail::section::get_sections
+            <
+                Reverse2, dimensions
+            >(geometry2, robust_policy, sections2, strategy, 1);
 
-        // ... and then partition them, intersecting overlapping sections in visitor method
+        // ... and then partition them, intersecting overlapping sections in visitor method.
+        // The turns are collected in the order of the sections, also if
+        // the sections are swept
         section_visitor
             <
                 Geometry1, Geometry2,
@@ -570,13 +657,51 @@ public:
             > visitor(source_id1, geometry1, source_id2, geometry2,
                       strategy, robust_policy, turns, interrupt_policy);
 
-        geometry::partition
+        partition_sections<box_type>(sec1, sec2, visitor, strategy,
+            std::integral_constant
+                <
+                    bool,
+#if defined(BOOST_GEOMETRY_PARALLEL_PARTITION)
+                    ! InterruptPolicy::enabled
+#else
+                    false
+#endif
+                >());
+    }
+
+private:
+    template <typename Box, typename Sections, typename Visitor, typename Strategy>
+    static inline void partition_sections(Sections const& sec1,
+                                          Sections const& sec2,
+                                          Visitor& visitor,
+                                          Strategy const& strategy,
+                                          std::false_type /*parallel*/)
+    {
+        detail::section::visit_section_pairs<Box>(sec1, sec2, visitor, strategy,
+                                                  visitor.m_turns);
+    }
+
+#if defined(BOOST_GEOMETRY_PARALLEL_PARTITION)
+    // Turns are found in multiple threads, in the same order
+    template <typename Box, typename Sections, typename Visitor, typename Strategy>
+    static inline void partition_sections(Sections const& sec1,
+                                          Sections const& sec2,
+                                          Visitor& visitor,
+                                          Strategy const& strategy,
+                                          std::true_type /*parallel*/)
+    {
+        detail::section::get_section_box<Strategy> const expand_policy(strategy);
+        detail::section::overlaps_section_box<Strategy> const overlaps_policy(strategy);
+
+        geometry::partition_parallel
             <
-                box_type
+                Box
             >::apply(sec1, sec2, visitor,
-                     detail::section::get_section_box<Strategy>(strategy),
-                     detail::section::overlaps_section_box<Strategy>(strategy));
+                     expand_policy, overlaps_policy,
+                     expand_policy, overlaps_policy,
+                     16, BOOST_GEOMETRY_PARALLEL_PARTITION_TASK_SIZE);
     }
+#endif
 };
 
 
@@ -20,10 +20,11 @@
 
 
 #include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
-#include <boost/geometry/algorithms/detail/partition.hpp>
 #include <boost/geometry/algorithms/detail/overlay/do_reverse.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+#include <boost/geometry/algorithms/detail/sections/cached_sections.hpp>
 #include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_pairs.hpp>
 
 #include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/coordinate_dimension.hpp>
@@ -151,9 +152,12 @@ struct get_turns
 
         typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
 
-        sections_type sec;
-        geometry::sectionalize<Reverse, dimensions>(geometry, robust_policy,
-                                                    sec, strategy);
+        // The strategy might carry the sections of the geometry
+        sections_type sections;
+        sections_type const& sec = detail::section::get_sections
+            <
+                Reverse, dimensions
+            >(geometry, robust_policy, sections, strategy);
 
         self_section_visitor
             <
@@ -162,13 +166,10 @@ struct get_turns
             > visitor(geometry, strategy, robust_policy, turns, interrupt_policy,
                       source_index, skip_adjacent);
 
-        // false if interrupted
-        geometry::partition
-            <
-                box_type
-            >::apply(sec, visitor,
-                     detail::section::get_section_box<Strategy>(strategy),
-                     detail::section::overlaps_section_box<Strategy>(strategy));
+        // false if interrupted, the turns are collected in the order of
+        // the sections, also if the sections are swept
+        detail::section::visit_section_pairs<box_type>(sec, visitor, strategy,
+                                                       turns);
 
         return ! interrupt_policy.has_intersections;
     }
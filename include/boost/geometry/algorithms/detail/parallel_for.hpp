@@ -0,0 +1,137 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARALLEL_FOR_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARALLEL_FOR_HPP
+
+
+#include <cstddef>
+
+#include <boost/config.hpp>
+#include <boost/core/ignore_unused.hpp>
+
+#if ! defined(BOOST_DISABLE_THREADS) && ! defined(BOOST_NO_CXX11_HDR_THREAD)
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Returns the number of threads to use for a requested number of threads,
+// where 0 means: the number of hardware threads.
+// If threads are disabled in Boost.Config (BOOST_DISABLE_THREADS) or not
+// available (BOOST_NO_CXX11_HDR_THREAD), this is always 1.
+inline std::size_t parallel_thread_count(std::size_t requested = 0)
+{
+#if defined(BOOST_DISABLE_THREADS) || defined(BOOST_NO_CXX11_HDR_THREAD)
+    return 1;
+#else
+    if (requested > 0)
+    {
+        return requested;
+    }
+    unsigned int const hardware = std::thread::hardware_concurrency();
+    return hardware > 0 ? hardware : 1;
+#endif
+}
+
+// Calls function(i) for all i in [0, count), using up to thread_count
+// threads, including the calling thread. Indexes are handed out one by one,
+// in ascending order, so the calls may differ in cost.
+// The function should be safe to call concurrently for different indexes.
+// If a call throws, no new indexes are handed out and the first exception
+// is rethrown in the calling thread, after all threads finished.
+template <typename Function>
+inline void parallel_for(std::size_t count, std::size_t thread_count,
+                         Function const& function)
+{
+#if ! defined(BOOST_DISABLE_THREADS) && ! defined(BOOST_NO_CXX11_HDR_THREAD)
+    if (thread_count > count)
+    {
+        thread_count = count;
+    }
+
+    if (thread_count > 1)
+    {
+        std::atomic<std::size_t> next(0);
+        std::atomic<bool> failed(false);
+        std::exception_ptr exception;
+        std::mutex exception_mutex;
+
+        auto worker = [&]()
+        {
+            try
+            {
+                for (std::size_t i = next++; i < count && ! failed; i = next++)
+                {
+                    function(i);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if (! exception)
+                {
+                    exception = std::current_exception();
+                }
+                failed = true;
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count - 1);
+        try
+        {
+            for (std::size_t t = 1; t < thread_count; t++)
+            {
+                threads.push_back(std::thread(worker));
+            }
+        }
+        catch (...)
+        {
+            // Not all threads could be started, the others do the work
+        }
+
+        worker();
+
+        for (std::size_t t = 0; t < threads.size(); t++)
+        {
+            threads[t].join();
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+        return;
+    }
+#else
+    boost::ignore_unused(thread_count);
+#endif
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        function(i);
+    }
+}
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARALLEL_FOR_HPP
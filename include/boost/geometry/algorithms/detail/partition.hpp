@@ -17,6 +17,7 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARTITION_HPP
 
 
+#include <algorithm>
 #include <cstddef>
 #include <type_traits>
 #include <vector>
@@ -57,6 +58,17 @@ struct divide_interval<T, true>
     }
 };
 
+template <int Dimension, typename Box>
+inline void divide_box(Box const& box,
+                       typename coordinate_type<Box>::type const& split,
+                       Box& lower_box, Box& upper_box)
+{
+    lower_box = box;
+    upper_box = box;
+    geometry::set<max_corner, Dimension>(lower_box, split);
+    geometry::set<min_corner, Dimension>(upper_box, split);
+}
+
 template <int Dimension, typename Box>
 inline void divide_box(Box const& box, Box& lower_box, Box& upper_box)
 {
@@ -67,10 +79,7 @@ inline void divide_box(Box const& box, Box& lower_box, Box& upper_box)
                     geometry::get<min_corner, Dimension>(box),
                     geometry::get<max_corner, Dimension>(box));
 
-    lower_box = box;
-    upper_box = box;
-    geometry::set<max_corner, Dimension>(lower_box, mid);
-    geometry::set<min_corner, Dimension>(upper_box, mid);
+    divide_box<Dimension>(box, mid, lower_box, upper_box);
 }
 
 // Divide forward_range into three subsets: lower, upper and oversized
@@ -236,11 +245,313 @@ inline bool recurse_ok(IteratorVector1 const& input1,
 }
 
 
-template <int Dimension, typename Box>
+// Divides the box at the middle, in the dimension of the recursion level,
+// such that dimensions alternate
+struct divide_at_middle
+{
+    template
+    <
+        int Dimension, typename Box,
+        typename IteratorVector, typename ExpandPolicy
+    >
+    static inline int apply(Box const& box, IteratorVector const& ,
+                            ExpandPolicy const& ,
+                            typename coordinate_type<Box>::type& split)
+    {
+        split = middle<Dimension>(box);
+        return Dimension;
+    }
+
+    template
+    <
+        int Dimension, typename Box,
+        typename IteratorVector1, typename IteratorVector2,
+        typename ExpandPolicy1, typename ExpandPolicy2
+    >
+    static inline int apply(Box const& box, IteratorVector1 const& ,
+                            IteratorVector2 const& ,
+                            ExpandPolicy1 const& , ExpandPolicy2 const& ,
+                            typename coordinate_type<Box>::type& split)
+    {
+        split = middle<Dimension>(box);
+        return Dimension;
+    }
+
+    template <int Dimension, typename Box>
+    static inline typename coordinate_type<Box>::type middle(Box const& box)
+    {
+        typedef typename coordinate_type<Box>::type ctype;
+        return divide_interval<ctype>::apply(
+                    geometry::get<min_corner, Dimension>(box),
+                    geometry::get<max_corner, Dimension>(box));
+    }
+};
+
+// Divides the box in the dimension, and at the position, with the lowest
+// estimated number of visits. Positions considered are the middle of the
+// box and the median of the centers of the items. The estimate assumes that
+// the subsets are matched quadratically, and adds the cost of dividing.
+// If no division is cheaper than matching the input quadratically, the input
+// is not divided. So for skewed input the divisions follow the items, and
+// the recursion stops where many items would exceed the division.
+// The median and the sizes of the subsets are estimated from a sample of the
+// items, such that the estimate takes constant time.
+struct divide_adaptive
+{
+    // Cost of dividing, per item, relative to the cost of visiting a pair
+    static const std::size_t division_cost = 4;
+
+    // Maximum number of items used for the estimate
+    static const std::size_t max_sample_count = 64;
+
+    template
+    <
+        int Dimension, typename Box,
+        typename IteratorVector, typename ExpandPolicy
+    >
+    static inline int apply(Box const& box, IteratorVector const& input,
+                            ExpandPolicy const& expand_policy,
+                            typename coordinate_type<Box>::type& split)
+    {
+        double const n = boost::size(input);
+        double const leaf_cost = n * (n - 1.0) / 2.0;
+        if (leaf_cost <= n * division_cost)
+        {
+            // No division can be cheaper
+            return -1;
+        }
+
+        std::vector<Box> sample;
+        add_sample(input, expand_policy, sample);
+
+        typename coordinate_type<Box>::type splits[4];
+        get_splits(box, sample, sample.size(), splits);
+
+        double costs[4];
+        for (std::size_t i = 0; i < 4; i++)
+        {
+            subset_sizes const s = get_sizes(sample, 0, sample.size(),
+                                             i / 2, splits[i], n);
+            costs[i] = n * division_cost
+                + s.lower * (s.lower - 1.0) / 2.0
+                + s.upper * (s.upper - 1.0) / 2.0
+                + s.exceeding * (s.exceeding - 1.0) / 2.0
+                + s.exceeding * (s.lower + s.upper);
+        }
+
+        return select(costs, leaf_cost, splits, split);
+    }
+
+    template
+    <
+        int Dimension, typename Box,
+        typename IteratorVector1, typename IteratorVector2,
+        typename ExpandPolicy1, typename ExpandPolicy2
+    >
+    static inline int apply(Box const& box, IteratorVector1 const& input1,
+                            IteratorVector2 const& input2,
+                            ExpandPolicy1 const& expand_policy1,
+                            ExpandPolicy2 const& expand_policy2,
+                            typename coordinate_type<Box>::type& split)
+    {
+        double const n1 = boost::size(input1);
+        double const n2 = boost::size(input2);
+        double const leaf_cost = n1 * n2;
+        if (leaf_cost <= (n1 + n2) * division_cost)
+        {
+            return -1;
+        }
+
+        std::vector<Box> sample;
+        add_sample(input1, expand_policy1, sample);
+        std::size_t const count1 = sample.size();
+        add_sample(input2, expand_policy2, sample);
+
+        typename coordinate_type<Box>::type splits[4];
+        get_splits(box, sample, count1, splits);
+
+        double costs[4];
+        for (std::size_t i = 0; i < 4; i++)
+        {
+            subset_sizes const s1 = get_sizes(sample, 0, count1,
+                                              i / 2, splits[i], n1);
+            subset_sizes const s2 = get_sizes(sample, count1, sample.size(),
+                                              i / 2, splits[i], n2);
+            costs[i] = (n1 + n2) * division_cost
+                + s1.lower * s2.lower
+                + s1.upper * s2.upper
+                + s1.exceeding * n2
+                + s2.exceeding * (s1.lower + s1.upper);
+        }
+
+        return select(costs, leaf_cost, splits, split);
+    }
+
+private :
+    // Estimated number of items in the lower, upper and exceeding subsets
+    struct subset_sizes
+    {
+        double lower;
+        double upper;
+        double exceeding;
+    };
+
+    template <typename IteratorVector, typename ExpandPolicy, typename Box>
+    static inline void add_sample(IteratorVector const& input,
+                                  ExpandPolicy const& expand_policy,
+                                  std::vector<Box>& sample)
+    {
+        std::size_t const n = boost::size(input);
+        std::size_t const step = n > max_sample_count ? n / max_sample_count : 1;
+        for (std::size_t i = 0; i < n; i += step)
+        {
+            Box item_box;
+            geometry::assign_inverse(item_box);
+            expand_policy.apply(item_box, *input[i]);
+            sample.push_back(item_box);
+        }
+    }
+
+    template <std::size_t Dimension, typename Box>
+    static inline typename coordinate_type<Box>::type
+        median(std::vector<Box> const& sample)
+    {
+        typedef typename coordinate_type<Box>::type ctype;
+
+        std::vector<ctype> centers;
+        centers.reserve(sample.size());
+        for (std::size_t i = 0; i < sample.size(); i++)
+        {
+            centers.push_back(divide_interval<ctype>::apply(
+                geometry::get<min_corner, Dimension>(sample[i]),
+                geometry::get<max_corner, Dimension>(sample[i])));
+        }
+
+        typename std::vector<ctype>::iterator mid
+            = centers.begin() + centers.size() / 2;
+        std::nth_element(centers.begin(), mid, centers.end());
+        return *mid;
+    }
+
+    // The splits are the middle and the median in dimension 0, and in 1.
+    // The median of two inputs is the median of the first input, if
+    // that is not empty. The first input is usually the largest, and the
+    // split is meant to divide it.
+    template <typename Box, typename Splits>
+    static inline void get_splits(Box const& box,
+                                  std::vector<Box> const& sample,
+                                  std::size_t count1,
+                                  Splits& splits)
+    {
+        std::vector<Box> const first(sample.begin(),
+            count1 > 0 ? sample.begin() + count1 : sample.end());
+        splits[0] = divide_at_middle::middle<0>(box);
+        splits[1] = median<0>(first);
+        splits[2] = divide_at_middle::middle<1>(box);
+        splits[3] = median<1>(first);
+    }
+
+    // Divides as overlaps policies of boxes: an item touching the
+    // division overlaps both parts
+    template <typename Box, typename T>
+    static inline subset_sizes get_sizes(std::vector<Box> const& sample,
+                                         std::size_t first, std::size_t last,
+                                         std::size_t dimension,
+                                         T const& split, double n)
+    {
+        subset_sizes result = { 0, 0, 0 };
+        if (first == last)
+        {
+            return result;
+        }
+
+        for (std::size_t i = first; i < last; i++)
+        {
+            Box const& b = sample[i];
+            T const min_value = dimension == 0
+                ? geometry::get<min_corner, 0>(b) : geometry::get<min_corner, 1>(b);
+            T const max_value = dimension == 0
+                ? geometry::get<max_corner, 0>(b) : geometry::get<max_corner, 1>(b);
+            if (max_value < split)
+            {
+                result.lower++;
+            }
+            else if (min_value > split)
+            {
+                result.upper++;
+            }
+            else
+            {
+                result.exceeding++;
+            }
+        }
+
+        double const factor = n / (last - first);
+        result.lower *= factor;
+        result.upper *= factor;
+        result.exceeding *= factor;
+        return result;
+    }
+
+    // Returns the dimension of the cheapest split, or -1 if not dividing
+    // is the cheapest
+    template <typename Splits, typename T>
+    static inline int select(double const* costs, double best_cost,
+                             Splits const& splits, T& split)
+    {
+        int result = -1;
+        for (std::size_t i = 0; i < 4; i++)
+        {
+            if (costs[i] < best_cost)
+            {
+                best_cost = costs[i];
+                result = int(i / 2);
+                split = splits[i];
+            }
+        }
+        return result;
+    }
+};
+
+// Divide policy used by default
+typedef divide_at_middle divide_default;
+
+
+// Returns true if the visitor defers the partition of (a part of) the input,
+// to execute it later. Normal visitors don't defer, the task collector of
+// partition_parallel does.
+template
+<
+    int Dimension, typename Box, typename DividePolicy,
+    typename VisitPolicy, typename ...Args
+>
+inline bool defer_one_range(VisitPolicy& , Args const& ...)
+{
+    return false;
+}
+
+template
+<
+    int Dimension, typename Box, typename DividePolicy,
+    typename VisitPolicy, typename ...Args
+>
+inline bool defer_two_ranges(VisitPolicy& , Args const& ...)
+{
+    return false;
+}
+
+
+template
+<
+    int Dimension, typename Box, typename DividePolicy = divide_at_middle
+>
 class partition_two_ranges;
 
 
-template <int Dimension, typename Box>
+template
+<
+    int Dimension, typename Box, typename DividePolicy = divide_at_middle
+>
 class partition_one_range
 {
     template <typename IteratorVector, typename ExpandPolicy>
@@ -273,8 +584,7 @@ class partition_one_range
         {
             return partition_one_range
                 <
-                    1 - Dimension,
-                    Box
+                    1 - Dimension, Box, DividePolicy
                 >::apply(box, input, level + 1, min_elements,
                          visitor, expand_policy, overlaps_policy, box_policy);
         }
@@ -307,7 +617,7 @@ class partition_one_range
         {
             return partition_two_ranges
                 <
-                    1 - Dimension, Box
+                    1 - Dimension, Box, DividePolicy
                 >::apply(box, input1, input2, level + 1, min_elements,
                          visitor, expand_policy, overlaps_policy,
                          expand_policy, overlaps_policy, box_policy);
@@ -335,11 +645,58 @@ public :
                              ExpandPolicy const& expand_policy,
                              OverlapsPolicy const& overlaps_policy,
                              VisitBoxPolicy& box_policy)
+    {
+        if (defer_one_range<Dimension, Box, DividePolicy>(visitor, box,
+                input, level, min_elements, expand_policy, overlaps_policy,
+                box_policy))
+        {
+            return true;
+        }
+
+        typename coordinate_type<Box>::type split = 0;
+        int const dimension = DividePolicy::template apply<Dimension>(box,
+                                input, expand_policy, split);
+        if (dimension < 0)
+        {
+            box_policy.apply(box, level);
+            return handle_one(input, visitor);
+        }
+        else if (dimension != Dimension)
+        {
+            return partition_one_range
+                <
+                    1 - Dimension, Box, DividePolicy
+                >::divide(box, split, input, level, min_elements,
+                          visitor, expand_policy, overlaps_policy, box_policy);
+        }
+
+        return divide(box, split, input, level, min_elements,
+                      visitor, expand_policy, overlaps_policy, box_policy);
+    }
+
+    // Divides the input at split, in this dimension, and processes the parts
+    template
+    <
+        typename IteratorVector,
+        typename VisitPolicy,
+        typename ExpandPolicy,
+        typename OverlapsPolicy,
+        typename VisitBoxPolicy
+    >
+    static inline bool divide(Box const& box,
+                              typename coordinate_type<Box>::type const& split,
+                              IteratorVector const& input,
+                              std::size_t level,
+                              std::size_t min_elements,
+                              VisitPolicy& visitor,
+                              ExpandPolicy const& expand_policy,
+                              OverlapsPolicy const& overlaps_policy,
+                              VisitBoxPolicy& box_policy)
     {
         box_policy.apply(box, level);
 
         Box lower_box, upper_box;
-        divide_box<Dimension>(box, lower_box, upper_box);
+        divide_box<Dimension>(box, split, lower_box, upper_box);
 
         IteratorVector lower, upper, exceeding;
         divide_into_subsets(lower_box, upper_box,
@@ -374,11 +731,7 @@ public :
     }
 };
 
-template
-<
-    int Dimension,
-    typename Box
->
+template <int Dimension, typename Box, typename DividePolicy>
 class partition_two_ranges
 {
     template
@@ -405,7 +758,7 @@ class partition_two_ranges
     {
         return partition_two_ranges
             <
-                1 - Dimension, Box
+                1 - Dimension, Box, DividePolicy
             >::apply(box, input1, input2, level + 1, min_elements,
                      visitor, expand_policy1, overlaps_policy1,
                      expand_policy2, overlaps_policy2, box_policy);
@@ -459,11 +812,68 @@ public :
                              ExpandPolicy2 const& expand_policy2,
                              OverlapsPolicy2 const& overlaps_policy2,
                              VisitBoxPolicy& box_policy)
+    {
+        if (defer_two_ranges<Dimension, Box, DividePolicy>(visitor, box,
+                input1, input2, level, min_elements,
+                expand_policy1, overlaps_policy1,
+                expand_policy2, overlaps_policy2, box_policy))
+        {
+            return true;
+        }
+
+        typename coordinate_type<Box>::type split = 0;
+        int const dimension = DividePolicy::template apply<Dimension>(box,
+                                input1, input2, expand_policy1, expand_policy2,
+                                split);
+        if (dimension < 0)
+        {
+            box_policy.apply(box, level);
+            return handle_two(input1, input2, visitor);
+        }
+        else if (dimension != Dimension)
+        {
+            return partition_two_ranges
+                <
+                    1 - Dimension, Box, DividePolicy
+                >::divide(box, split, input1, input2, level, min_elements,
+                          visitor, expand_policy1, overlaps_policy1,
+                          expand_policy2, overlaps_policy2, box_policy);
+        }
+
+        return divide(box, split, input1, input2, level, min_elements,
+                      visitor, expand_policy1, overlaps_policy1,
+                      expand_policy2, overlaps_policy2, box_policy);
+    }
+
+    // Divides the inputs at split, in this dimension, and processes the parts
+    template
+    <
+        typename IteratorVector1,
+        typename IteratorVector2,
+        typename VisitPolicy,
+        typename ExpandPolicy1,
+        typename OverlapsPolicy1,
+        typename ExpandPolicy2,
+        typename OverlapsPolicy2,
+        typename VisitBoxPolicy
+    >
+    static inline bool divide(Box const& box,
+                              typename coordinate_type<Box>::type const& split,
+                              IteratorVector1 const& input1,
+                              IteratorVector2 const& input2,
+                              std::size_t level,
+                              std::size_t min_elements,
+                              VisitPolicy& visitor,
+                              ExpandPolicy1 const& expand_policy1,
+                              OverlapsPolicy1 const& overlaps_policy1,
+                              ExpandPolicy2 const& expand_policy2,
+                              OverlapsPolicy2 const& overlaps_policy2,
+                              VisitBoxPolicy& box_policy)
     {
         box_policy.apply(box, level);
 
         Box lower_box, upper_box;
-        divide_box<Dimension>(box, lower_box, upper_box);
+        divide_box<Dimension>(box, split, lower_box, upper_box);
 
         IteratorVector1 lower1, upper1, exceeding1;
         IteratorVector2 lower2, upper2, exceeding2;
@@ -611,7 +1021,8 @@ template
 <
     typename Box,
     typename IncludePolicy1 = detail::partition::include_all_policy,
-    typename IncludePolicy2 = detail::partition::include_all_policy
+    typename IncludePolicy2 = detail::partition::include_all_policy,
+    typename DividePolicy = detail::partition::divide_default
 >
 class partition
 {
@@ -706,7 +1117,7 @@ public:
 
             return detail::partition::partition_one_range
                 <
-                    0, Box
+                    0, Box, DividePolicy
                 >::apply(total, iterator_vector, 0, min_elements,
                          visitor, expand_policy, overlaps_policy, box_visitor);
         }
@@ -841,7 +1252,7 @@ public:
 
             return detail::partition::partition_two_ranges
                 <
-                    0, Box
+                    0, Box, DividePolicy
                 >::apply(total, iterator_vector1, iterator_vector2,
                          0, min_elements, visitor, expand_policy1,
                          overlaps_policy1, expand_policy2, overlaps_policy2,
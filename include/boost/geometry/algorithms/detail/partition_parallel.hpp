@@ -0,0 +1,411 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARTITION_PARALLEL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARTITION_PARALLEL_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/empty.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+
+#if ! defined(BOOST_DISABLE_THREADS) && ! defined(BOOST_NO_CXX11_HDR_THREAD)
+#include <atomic>
+#endif
+
+// If BOOST_GEOMETRY_PARALLEL_PARTITION is defined, get_turns uses
+// partition_parallel, with this task size
+#if ! defined(BOOST_GEOMETRY_PARALLEL_PARTITION_TASK_SIZE)
+#define BOOST_GEOMETRY_PARALLEL_PARTITION_TASK_SIZE 256
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+namespace detail { namespace partition
+{
+
+// Visitor passed to the partition instead of the visitor of the caller.
+// It does not visit items, but collects the partition of all parts of the
+// input with at most task_size items, and all quadratic matches in the
+// larger parts, as tasks, in the order in which the sequential partition
+// executes them. Executing the tasks in this order, with the same visitor,
+// visits the same pairs in the same order.
+template <typename TaskVisitor>
+struct task_collector
+{
+    typedef std::function<bool(TaskVisitor&)> task_type;
+
+    explicit task_collector(std::size_t task_size)
+        : m_task_size(task_size)
+    {}
+
+    inline bool defer(std::size_t size) const
+    {
+        return size <= m_task_size;
+    }
+
+    std::size_t m_task_size;
+    std::vector<task_type> m_tasks;
+};
+
+template
+<
+    int Dimension, typename Box, typename DividePolicy, typename TaskVisitor,
+    typename IteratorVector,
+    typename ExpandPolicy, typename OverlapsPolicy, typename VisitBoxPolicy
+>
+inline bool defer_one_range(task_collector<TaskVisitor>& collector,
+                            Box const& box,
+                            IteratorVector const& input,
+                            std::size_t level, std::size_t min_elements,
+                            ExpandPolicy const& expand_policy,
+                            OverlapsPolicy const& overlaps_policy,
+                            VisitBoxPolicy const& box_policy)
+{
+    if (! collector.defer(boost::size(input)))
+    {
+        return false;
+    }
+
+    collector.m_tasks.push_back([=](TaskVisitor& visitor)
+    {
+        VisitBoxPolicy task_box_policy = box_policy;
+        return partition_one_range
+            <
+                Dimension, Box, DividePolicy
+            >::apply(box, input, level, min_elements, visitor,
+                     expand_policy, overlaps_policy, task_box_policy);
+    });
+    return true;
+}
+
+template
+<
+    int Dimension, typename Box, typename DividePolicy, typename TaskVisitor,
+    typename IteratorVector1, typename IteratorVector2,
+    typename ExpandPolicy1, typename OverlapsPolicy1,
+    typename ExpandPolicy2, typename OverlapsPolicy2,
+    typename VisitBoxPolicy
+>
+inline bool defer_two_ranges(task_collector<TaskVisitor>& collector,
+                             Box const& box,
+                             IteratorVector1 const& input1,
+                             IteratorVector2 const& input2,
+                             std::size_t level, std::size_t min_elements,
+                             ExpandPolicy1 const& expand_policy1,
+                             OverlapsPolicy1 const& overlaps_policy1,
+                             ExpandPolicy2 const& expand_policy2,
+                             OverlapsPolicy2 const& overlaps_policy2,
+                             VisitBoxPolicy const& box_policy)
+{
+    if (! collector.defer(boost::size(input1) + boost::size(input2)))
+    {
+        return false;
+    }
+
+    collector.m_tasks.push_back([=](TaskVisitor& visitor)
+    {
+        VisitBoxPolicy task_box_policy = box_policy;
+        return partition_two_ranges
+            <
+                Dimension, Box, DividePolicy
+            >::apply(box, input1, input2, level, min_elements, visitor,
+                     expand_policy1, overlaps_policy1,
+                     expand_policy2, overlaps_policy2, task_box_policy);
+    });
+    return true;
+}
+
+template <typename IteratorVector, typename TaskVisitor>
+inline bool handle_one(IteratorVector const& input,
+                       task_collector<TaskVisitor>& collector)
+{
+    if (boost::size(input) > 1)
+    {
+        collector.m_tasks.push_back([=](TaskVisitor& visitor)
+        {
+            return handle_one(input, visitor);
+        });
+    }
+    return true;
+}
+
+template
+<
+    typename IteratorVector1,
+    typename IteratorVector2,
+    typename TaskVisitor
+>
+inline bool handle_two(IteratorVector1 const& input1,
+                       IteratorVector2 const& input2,
+                       task_collector<TaskVisitor>& collector)
+{
+    if (! boost::empty(input1) && ! boost::empty(input2))
+    {
+        collector.m_tasks.push_back([=](TaskVisitor& visitor)
+        {
+            return handle_two(input1, input2, visitor);
+        });
+    }
+    return true;
+}
+
+// Executes the collected tasks, in consecutive groups with one task visitor
+// per group, and merges the task visitors into the visitor in the order of
+// the groups. Returns false if a task was interrupted, then only the
+// task visitors up to and including the interrupted one are merged.
+template <typename VisitPolicy, typename TaskVisitor>
+inline bool execute_tasks(task_collector<TaskVisitor> const& collector,
+                          VisitPolicy& visitor, std::size_t thread_count)
+{
+    typedef typename task_collector<TaskVisitor>::task_type task_type;
+    std::vector<task_type> const& tasks = collector.m_tasks;
+
+    // More groups than threads, to balance tasks with different costs
+    std::size_t const group_count = (std::min)(tasks.size(), thread_count * 8);
+    if (group_count == 0)
+    {
+        return true;
+    }
+
+    // Task visitors are not copied or moved, they might refer to themselves
+    std::deque<TaskVisitor> task_visitors;
+    for (std::size_t i = 0; i < group_count; i++)
+    {
+        task_visitors.emplace_back(visitor);
+    }
+
+#if ! defined(BOOST_DISABLE_THREADS) && ! defined(BOOST_NO_CXX11_HDR_THREAD)
+    std::atomic<std::size_t> interrupted(group_count);
+#else
+    std::size_t interrupted = group_count;
+#endif
+
+    detail::parallel_for(group_count, thread_count, [&](std::size_t group)
+    {
+        std::size_t const first = group * tasks.size() / group_count;
+        std::size_t const last = (group + 1) * tasks.size() / group_count;
+        for (std::size_t i = first; i < last && group < interrupted; i++)
+        {
+            if (! tasks[i](task_visitors[group]))
+            {
+#if ! defined(BOOST_DISABLE_THREADS) && ! defined(BOOST_NO_CXX11_HDR_THREAD)
+                std::size_t current = interrupted;
+                while (group < current
+                    && ! interrupted.compare_exchange_weak(current, group))
+                {}
+#else
+                interrupted = group;
+#endif
+                return;
+            }
+        }
+    });
+
+    bool const completed = interrupted == group_count;
+    std::size_t const merge_count = completed ? group_count : interrupted + 1;
+    for (std::size_t i = 0; i < merge_count; i++)
+    {
+        visitor.merge(task_visitors[i]);
+    }
+    return completed;
+}
+
+}} // namespace detail::partition
+
+
+/*!
+\brief Partition executing independent parts of the recursion in parallel
+\details Visits the same pairs as partition, in the same order, as seen by
+    the visitor after merging. The recursion is executed until the parts
+    have at most task_size items. These parts, and the remaining quadratic
+    matches, are executed as tasks in multiple threads, each group of
+    consecutive tasks with its own task visitor. The visitor should define
+    the type task_visitor_type, constructible from the visitor and having
+    the same apply function, and the member function merge(task_visitor),
+    which is called for all task visitors in order.
+    The apply functions of the task visitors and the policies should be safe
+    to call concurrently.
+    A thread_count of 0 means the number of hardware threads. If only one
+    thread is used, or the input is small, this is the same as partition.
+*/
+template
+<
+    typename Box,
+    typename IncludePolicy1 = detail::partition::include_all_policy,
+    typename IncludePolicy2 = detail::partition::include_all_policy,
+    typename DividePolicy = detail::partition::divide_default
+>
+class partition_parallel
+{
+    template
+    <
+        typename IncludePolicy,
+        typename ForwardRange,
+        typename IteratorVector,
+        typename ExpandPolicy
+    >
+    static inline void expand_to_range(ForwardRange const& forward_range,
+                                       Box& total,
+                                       IteratorVector& iterator_vector,
+                                       ExpandPolicy const& expand_policy)
+    {
+        for(typename boost::range_iterator<ForwardRange const>::type
+                it = boost::begin(forward_range);
+            it != boost::end(forward_range);
+            ++it)
+        {
+            if (IncludePolicy::apply(*it))
+            {
+                expand_policy.apply(total, *it);
+                iterator_vector.push_back(it);
+            }
+        }
+    }
+
+public:
+    template
+    <
+        typename ForwardRange,
+        typename VisitPolicy,
+        typename ExpandPolicy,
+        typename OverlapsPolicy
+    >
+    static inline bool apply(ForwardRange const& forward_range,
+                             VisitPolicy& visitor,
+                             ExpandPolicy const& expand_policy,
+                             OverlapsPolicy const& overlaps_policy,
+                             std::size_t min_elements,
+                             std::size_t task_size,
+                             std::size_t thread_count = 0)
+    {
+        typedef typename boost::range_iterator
+            <
+                ForwardRange const
+            >::type iterator_type;
+
+        std::size_t const size = boost::size(forward_range);
+        thread_count = detail::parallel_thread_count(thread_count);
+
+        if (thread_count < 2 || size <= min_elements || size <= task_size)
+        {
+            return geometry::partition
+                <
+                    Box, IncludePolicy1, IncludePolicy2, DividePolicy
+                >::apply(forward_range, visitor, expand_policy,
+                         overlaps_policy, min_elements);
+        }
+
+        std::vector<iterator_type> iterator_vector;
+        Box total;
+        assign_inverse(total);
+        expand_to_range<IncludePolicy1>(forward_range, total,
+                                        iterator_vector, expand_policy);
+
+        typedef typename VisitPolicy::task_visitor_type task_visitor_type;
+        detail::partition::task_collector<task_visitor_type> collector(task_size);
+        detail::partition::visit_no_policy box_policy;
+
+        detail::partition::partition_one_range
+            <
+                0, Box, DividePolicy
+            >::apply(total, iterator_vector, 0, min_elements,
+                     collector, expand_policy, overlaps_policy, box_policy);
+
+        return detail::partition::execute_tasks(collector, visitor,
+                                                thread_count);
+    }
+
+    template
+    <
+        typename ForwardRange1,
+        typename ForwardRange2,
+        typename VisitPolicy,
+        typename ExpandPolicy1,
+        typename OverlapsPolicy1,
+        typename ExpandPolicy2,
+        typename OverlapsPolicy2
+    >
+    static inline bool apply(ForwardRange1 const& forward_range1,
+                             ForwardRange2 const& forward_range2,
+                             VisitPolicy& visitor,
+                             ExpandPolicy1 const& expand_policy1,
+                             OverlapsPolicy1 const& overlaps_policy1,
+                             ExpandPolicy2 const& expand_policy2,
+                             OverlapsPolicy2 const& overlaps_policy2,
+                             std::size_t min_elements,
+                             std::size_t task_size,
+                             std::size_t thread_count = 0)
+    {
+        typedef typename boost::range_iterator
+            <
+                ForwardRange1 const
+            >::type iterator_type1;
+
+        typedef typename boost::range_iterator
+            <
+                ForwardRange2 const
+            >::type iterator_type2;
+
+        std::size_t const size1 = boost::size(forward_range1);
+        std::size_t const size2 = boost::size(forward_range2);
+        thread_count = detail::parallel_thread_count(thread_count);
+
+        if (thread_count < 2
+            || size1 <= min_elements || size2 <= min_elements
+            || size1 + size2 <= task_size)
+        {
+            return geometry::partition
+                <
+                    Box, IncludePolicy1, IncludePolicy2, DividePolicy
+                >::apply(forward_range1, forward_range2, visitor,
+                         expand_policy1, overlaps_policy1,
+                         expand_policy2, overlaps_policy2, min_elements);
+        }
+
+        std::vector<iterator_type1> iterator_vector1;
+        std::vector<iterator_type2> iterator_vector2;
+        Box total;
+        assign_inverse(total);
+        expand_to_range<IncludePolicy1>(forward_range1, total,
+                                        iterator_vector1, expand_policy1);
+        expand_to_range<IncludePolicy2>(forward_range2, total,
+                                        iterator_vector2, expand_policy2);
+
+        typedef typename VisitPolicy::task_visitor_type task_visitor_type;
+        detail::partition::task_collector<task_visitor_type> collector(task_size);
+        detail::partition::visit_no_policy box_policy;
+
+        detail::partition::partition_two_ranges
+            <
+                0, Box, DividePolicy
+            >::apply(total, iterator_vector1, iterator_vector2,
+                     0, min_elements, collector, expand_policy1,
+                     overlaps_policy1, expand_policy2, overlaps_policy2,
+                     box_policy);
+
+        return detail::partition::execute_tasks(collector, visitor,
+                                                thread_count);
+    }
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARTITION_PARALLEL_HPP
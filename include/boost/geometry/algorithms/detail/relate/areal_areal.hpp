@@ -77,14 +77,24 @@ public:
     template <typename Areal>
     bool operator()(Areal const& areal)
     {
-        using detail::within::point_in_geometry;
-
         // if those flags are set nothing will change
         if ( m_flags == 3 )
         {
             return false;
         }
 
+        return apply_flags(classify(areal));
+    }
+
+    // Returns 1 if the interior of the areal intersects the interior of
+    // the other_areal, 2 if it intersects its exterior, or 3 if both.
+    // Returns 0 if no point on the border of the areal is found.
+    // The result is not used, this may be called concurrently.
+    template <typename Areal>
+    int classify(Areal const& areal) const
+    {
+        using detail::within::point_in_geometry;
+
         typedef typename geometry::point_type<Areal>::type point_type;
         point_type pt;
         bool const ok = boost::geometry::point_on_border(pt, areal);
@@ -92,7 +102,7 @@ public:
         // TODO: for now ignore, later throw an exception?
         if ( !ok )
         {
-            return true;
+            return 0;
         }
 
         // check if the areal is inside the other_areal
@@ -102,93 +112,82 @@ public:
                                           m_other_areal,
                                           m_point_in_areal_strategy);
         //BOOST_GEOMETRY_ASSERT( pig != 0 );
-        
-        // inside
-        if ( pig > 0 )
+
+        // inside or outside, then a hole may be outside or inside
+        int const flags = pig > 0 ? 1 : 2;
+
+        // TODO: OPTIMIZE!
+        // Only the interior rings of other ONE single geometry must be checked
+        // NOT all geometries
+
+        ring_identifier ring_id(0, -1, 0);
+        std::size_t const irings_count = geometry::num_interior_rings(areal);
+        for ( ; static_cast<std::size_t>(ring_id.ring_index) < irings_count ;
+                ++ring_id.ring_index )
         {
-            update<interior, interior, '2', TransposeResult>(m_result);
-            update<boundary, interior, '1', TransposeResult>(m_result);
-            update<exterior, interior, '2', TransposeResult>(m_result);
-            m_flags |= 1;
+            typename detail::sub_range_return_type<Areal const>::type
+                range_ref = detail::sub_range(areal, ring_id);
+
+            if ( boost::empty(range_ref) )
+            {
+                // TODO: throw exception?
+                continue; // ignore
+            }
 
-            // TODO: OPTIMIZE!
-            // Only the interior rings of other ONE single geometry must be checked
-            // NOT all geometries
+            // TODO: O(N)
+            // Optimize!
+            int const hpig = point_in_geometry(range::front(range_ref),
+                                               m_other_areal,
+                                               m_point_in_areal_strategy);
 
-            // Check if any interior ring is outside
-            ring_identifier ring_id(0, -1, 0);
-            std::size_t const irings_count = geometry::num_interior_rings(areal);
-            for ( ; static_cast<std::size_t>(ring_id.ring_index) < irings_count ;
-                    ++ring_id.ring_index )
+            if ( pig > 0 ? hpig < 0 : hpig > 0 )
             {
-                typename detail::sub_range_return_type<Areal const>::type
-                    range_ref = detail::sub_range(areal, ring_id);
+                return 3;
+            }
+        }
 
-                if ( boost::empty(range_ref) )
-                {
-                    // TODO: throw exception?
-                    continue; // ignore
-                }
+        return flags;
+    }
 
-                // TODO: O(N)
-                // Optimize!
-                int const hpig = point_in_geometry(range::front(range_ref),
-                                                   m_other_areal,
-                                                   m_point_in_areal_strategy);
+    // Updates the result with the flags returned by classify
+    bool apply_flags(int flags)
+    {
+        if ( m_flags == 3 )
+        {
+            return false;
+        }
 
-                // hole outside
-                if ( hpig < 0 )
-                {
-                    update<interior, exterior, '2', TransposeResult>(m_result);
-                    update<boundary, exterior, '1', TransposeResult>(m_result);
-                    m_flags |= 2;
-                    break;
-                }
-            }
+        // inside
+        if ( flags & 1 )
+        {
+            update<interior, interior, '2', TransposeResult>(m_result);
+            update<boundary, interior, '1', TransposeResult>(m_result);
+            update<exterior, interior, '2', TransposeResult>(m_result);
         }
+
         // outside
-        else
+        if ( flags & 2 )
         {
             update<interior, exterior, '2', TransposeResult>(m_result);
             update<boundary, exterior, '1', TransposeResult>(m_result);
-            m_flags |= 2;
-
-            // Check if any interior ring is inside
-            ring_identifier ring_id(0, -1, 0);
-            std::size_t const irings_count = geometry::num_interior_rings(areal);
-            for ( ; static_cast<std::size_t>(ring_id.ring_index) < irings_count ;
-                    ++ring_id.ring_index )
-            {
-                typename detail::sub_range_return_type<Areal const>::type
-                    range_ref = detail::sub_range(areal, ring_id);
-
-                if ( boost::empty(range_ref) )
-                {
-                    // TODO: throw exception?
-                    continue; // ignore
-                }
+        }
 
-                // TODO: O(N)
-                // Optimize!
-                int const hpig = point_in_geometry(range::front(range_ref),
-                                                   m_other_areal,
-                                                   m_point_in_areal_strategy);
+        m_flags |= flags;
 
-                // hole inside
-                if ( hpig > 0 )
-                {
-                    update<interior, interior, '2', TransposeResult>(m_result);
-                    update<boundary, interior, '1', TransposeResult>(m_result);
-                    update<exterior, interior, '2', TransposeResult>(m_result);
-                    m_flags |= 1;
-                    break;
-                }
-            }
-        }
-                    
         return m_flags != 3 && !m_result.interrupt;
     }
 
+    // Returns true if applying the flags would end the checks, because
+    // nothing would change anymore or the result would be interrupted.
+    // The result is not changed, this may be called concurrently.
+    bool decided_by(int flags) const
+    {
+        Result result = m_result;
+        no_turns_aa_pred pred(m_other_areal, result, m_point_in_areal_strategy);
+        pred.m_flags = m_flags;
+        return ! pred.apply_flags(flags);
+    }
+
 private:
     Result & m_result;
     PointInArealStrategy const& m_point_in_areal_strategy;
@@ -196,6 +195,36 @@ private:
     int m_flags;
 };
 
+// Finds the turns and checks the geometries without turns for areal_areal,
+// in the calling thread
+struct areal_areal_sequential
+{
+    template
+    <
+        typename InterruptPolicy,
+        typename Geometry1, typename Geometry2,
+        typename Turns, typename Result, typename Strategy
+    >
+    static inline void get_turns(Turns & turns,
+                                 Geometry1 const& geometry1,
+                                 Geometry2 const& geometry2,
+                                 Result & result,
+                                 Strategy const& strategy)
+    {
+        InterruptPolicy interrupt_policy(geometry1, geometry2, result);
+
+        turns::get_turns<Geometry1, Geometry2>::apply(turns, geometry1, geometry2, interrupt_policy, strategy);
+    }
+
+    template <std::size_t OpId, typename Geometry, typename Turns, typename Pred>
+    static inline void for_each_disjoint_geometry(Turns const& turns,
+                                                  Geometry const& geometry,
+                                                  Pred & pred)
+    {
+        for_each_disjoint_geometry_if<OpId, Geometry>::apply(turns.begin(), turns.end(), geometry, pred);
+    }
+};
+
 // The implementation of an algorithm calculating relate() for A/A
 template <typename Geometry1, typename Geometry2>
 struct areal_areal
@@ -214,6 +243,17 @@ struct areal_areal
                              Result & result,
                              Strategy const& strategy)
     {
+        apply(geometry1, geometry2, result, strategy, areal_areal_sequential());
+    }
+
+    // The ExecutionPolicy finds the turns and checks the geometries without
+    // turns, see areal_areal_sequential
+    template <typename Result, typename Strategy, typename ExecutionPolicy>
+    static inline void apply(Geometry1 const& geometry1, Geometry2 const& geometry2,
+                             Result & result,
+                             Strategy const& strategy,
+                             ExecutionPolicy const& execution_policy)
+    {
 // TODO: If Areal geometry may have infinite size, change the following line:
 
         // The result should be FFFFFFFFF
@@ -229,9 +269,10 @@ struct areal_areal
             >::template turn_info_type<Strategy>::type turn_type;
         std::vector<turn_type> turns;
 
-        interrupt_policy_areal_areal<Result> interrupt_policy(geometry1, geometry2, result);
-
-        turns::get_turns<Geometry1, Geometry2>::apply(turns, geometry1, geometry2, interrupt_policy, strategy);
+        execution_policy.template get_turns
+            <
+                interrupt_policy_areal_areal<Result>
+            >(turns, geometry1, geometry2, result, strategy);
         if ( BOOST_GEOMETRY_CONDITION(result.interrupt) )
             return;
 
@@ -239,13 +280,13 @@ struct areal_areal
 
         no_turns_aa_pred<Geometry2, Result, Strategy, false>
             pred1(geometry2, result, strategy);
-        for_each_disjoint_geometry_if<0, Geometry1>::apply(turns.begin(), turns.end(), geometry1, pred1);
+        execution_policy.template for_each_disjoint_geometry<0>(turns, geometry1, pred1);
         if ( BOOST_GEOMETRY_CONDITION(result.interrupt) )
             return;
 
         no_turns_aa_pred<Geometry1, Result, Strategy, true>
             pred2(geometry1, result, strategy);
-        for_each_disjoint_geometry_if<1, Geometry2>::apply(turns.begin(), turns.end(), geometry2, pred2);
+        execution_policy.template for_each_disjoint_geometry<1>(turns, geometry2, pred2);
         if ( BOOST_GEOMETRY_CONDITION(result.interrupt) )
             return;
         
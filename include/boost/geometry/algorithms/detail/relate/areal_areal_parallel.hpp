@@ -0,0 +1,371 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_AREAL_AREAL_PARALLEL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_AREAL_AREAL_PARALLEL_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/overlay/do_reverse.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
+#include <boost/geometry/algorithms/detail/partition_parallel.hpp>
+#include <boost/geometry/algorithms/detail/relate/areal_areal.hpp>
+#include <boost/geometry/algorithms/detail/relate/follow_helpers.hpp>
+#include <boost/geometry/algorithms/detail/relate/turns.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+#include <boost/geometry/algorithms/relate.hpp>
+
+#include <boost/geometry/core/point_order.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
+#include <boost/geometry/policies/robustness/robust_point_type.hpp>
+
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/relate/services.hpp>
+
+#include <boost/geometry/util/type_traits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace relate
+{
+
+// Marks a result as interrupted, because a copy of it was interrupted.
+// Results which can not be interrupted are left as they are.
+template <typename Result>
+inline void set_interrupt(Result & result, std::true_type)
+{
+    result.interrupt = true;
+}
+
+template <typename Result>
+inline void set_interrupt(Result & , std::false_type)
+{}
+
+template <typename Result>
+inline void set_interrupt(Result & result)
+{
+    set_interrupt(result,
+        typename std::is_assignable
+            <
+                decltype((std::declval<Result&>().interrupt)), bool
+            >::type());
+}
+
+// Interrupt policy for turns found in multiple threads. Every copy updates
+// its own copy of the result with the turns it finds. The first copy of
+// which the result is interrupted stops all copies.
+template
+<
+    typename InterruptPolicy,
+    typename Geometry1, typename Geometry2,
+    typename Result
+>
+class parallel_interrupt_policy
+{
+public:
+    static bool const enabled = true;
+
+    parallel_interrupt_policy(Geometry1 const& geometry1,
+                              Geometry2 const& geometry2,
+                              Result const& result,
+                              std::atomic<bool> & stop)
+        : m_geometry1(geometry1)
+        , m_geometry2(geometry2)
+        , m_result(result)
+        , m_policy(m_geometry1, m_geometry2, m_result)
+        , m_stop(stop)
+    {}
+
+    parallel_interrupt_policy(parallel_interrupt_policy const& other)
+        : m_geometry1(other.m_geometry1)
+        , m_geometry2(other.m_geometry2)
+        , m_result(other.m_result)
+        , m_policy(m_geometry1, m_geometry2, m_result)
+        , m_stop(other.m_stop)
+    {}
+
+    template <typename Range>
+    inline bool apply(Range const& turns)
+    {
+        if ( m_stop )
+        {
+            return true;
+        }
+
+        if ( m_policy.apply(turns) )
+        {
+            m_stop = true;
+            return true;
+        }
+
+        return false;
+    }
+
+private:
+    Geometry1 const& m_geometry1;
+    Geometry2 const& m_geometry2;
+    Result m_result;
+    InterruptPolicy m_policy;
+    std::atomic<bool> & m_stop;
+};
+
+template <typename Geometry, bool IsMulti = util::is_multi<Geometry>::value>
+struct areal_component_type
+{
+    typedef Geometry type;
+};
+
+template <typename Geometry>
+struct areal_component_type<Geometry, true>
+{
+    typedef typename boost::range_value<Geometry>::type type;
+};
+
+// Collects the components passed to it by for_each_disjoint_geometry_if
+template <typename Component>
+struct component_collector
+{
+    bool operator()(Component const& component)
+    {
+        m_components.push_back(&component);
+        return true;
+    }
+
+    std::vector<Component const*> m_components;
+};
+
+// Finds the turns and checks the geometries without turns for areal_areal,
+// in multiple threads.
+// The turns are found with partition_parallel, every group of sections
+// with its own copy of the result. If a copy is interrupted, the others
+// stop and the result is interrupted. Otherwise the result is updated with
+// all turns, as if they were found sequentially. That is the same because
+// updates of the result only raise its values, and whether an update
+// interrupts depends on the mask only.
+// The components without turns are classified concurrently, and the result
+// is updated with these classifications in the order of the components,
+// until it is decided.
+struct areal_areal_parallel
+{
+    explicit areal_areal_parallel(std::size_t thread_count)
+        : m_thread_count(detail::parallel_thread_count(thread_count))
+    {}
+
+    template
+    <
+        typename InterruptPolicy,
+        typename Geometry1, typename Geometry2,
+        typename Turns, typename Result, typename Strategy
+    >
+    inline void get_turns(Turns & turns,
+                          Geometry1 const& geometry1,
+                          Geometry2 const& geometry2,
+                          Result & result,
+                          Strategy const& strategy) const
+    {
+        typedef typename turns::get_turns
+            <
+                Geometry1, Geometry2
+            >::template robust_policy_type<Strategy>::type robust_policy_type;
+
+        typedef detail::get_turns::get_turn_info_type
+            <
+                Geometry1, Geometry2, turns::assign_policy<>
+            > turn_policy;
+
+        static const bool reverse1 = detail::overlay::do_reverse
+            <
+                geometry::point_order<Geometry1>::value
+            >::value;
+
+        static const bool reverse2 = detail::overlay::do_reverse
+            <
+                geometry::point_order<Geometry2>::value
+            >::value;
+
+        typedef typename boost::range_value<Turns>::type turn_type;
+        typedef model::box
+            <
+                typename geometry::robust_point_type
+                <
+                    typename turn_type::point_type, robust_policy_type
+                >::type
+            > box_type;
+        typedef geometry::sections<box_type, 2> sections_type;
+        typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
+
+        typedef parallel_interrupt_policy
+            <
+                InterruptPolicy, Geometry1, Geometry2, Result
+            > interrupt_policy_type;
+
+        robust_policy_type robust_policy
+                = geometry::get_rescale_policy<robust_policy_type>(
+                    geometry1, geometry2, strategy);
+
+        sections_type sections1, sections2;
+        sections_type const& sec1 = detail::section::get_sections
+            <
+                reverse1, dimensions
+            >(geometry1, robust_policy, sections1, strategy, 0);
+        sections_type const& sec2 = detail::section::get_sections
+            <
+                reverse2, dimensions
+            >(geometry2, robust_policy, sections2, strategy, 1);
+
+        std::atomic<bool> stop(false);
+        interrupt_policy_type interrupt_policy(geometry1, geometry2, result, stop);
+
+        detail::get_turns::section_visitor
+            <
+                Geometry1, Geometry2,
+                reverse1, reverse2,
+                turn_policy,
+                Strategy, robust_policy_type,
+                Turns, interrupt_policy_type
+            > visitor(0, geometry1, 1, geometry2,
+                      strategy, robust_policy, turns, interrupt_policy);
+
+        detail::section::get_section_box<Strategy> const expand_policy(strategy);
+        detail::section::overlaps_section_box<Strategy> const overlaps_policy(strategy);
+
+        geometry::partition_parallel
+            <
+                box_type
+            >::apply(sec1, sec2, visitor,
+                     expand_policy, overlaps_policy,
+                     expand_policy, overlaps_policy,
+                     16, BOOST_GEOMETRY_PARALLEL_PARTITION_TASK_SIZE,
+                     m_thread_count);
+
+        if ( stop )
+        {
+            set_interrupt(result);
+            return;
+        }
+
+        InterruptPolicy(geometry1, geometry2, result).apply(turns);
+    }
+
+    template <std::size_t OpId, typename Geometry, typename Turns, typename Pred>
+    inline void for_each_disjoint_geometry(Turns const& turns,
+                                           Geometry const& geometry,
+                                           Pred & pred) const
+    {
+        typedef typename areal_component_type<Geometry>::type component_type;
+
+        component_collector<component_type> collector;
+        for_each_disjoint_geometry_if<OpId, Geometry>::apply(turns.begin(), turns.end(), geometry, collector);
+
+        std::vector<component_type const*> const& components = collector.m_components;
+        if ( components.empty() )
+        {
+            return;
+        }
+
+        // Components handed out after the flags of the classified components
+        // decide the result are skipped. A skipped component may come before
+        // the deciding ones, so the result is updated in order and the
+        // skipped components are classified here when they are reached.
+        std::vector<int> flags(components.size(), -1);
+        std::atomic<int> all_flags(0);
+        std::atomic<bool> stop(pred.decided_by(0));
+
+        detail::parallel_for(components.size(), m_thread_count,
+                             [&](std::size_t i)
+        {
+            if ( stop )
+            {
+                return;
+            }
+
+            flags[i] = pred.classify(*components[i]);
+            if ( pred.decided_by(all_flags.fetch_or(flags[i]) | flags[i]) )
+            {
+                stop = true;
+            }
+        });
+
+        for ( std::size_t i = 0 ; i < components.size() ; ++i )
+        {
+            if ( flags[i] < 0 )
+            {
+                flags[i] = pred.classify(*components[i]);
+            }
+
+            if ( ! pred.apply_flags(flags[i]) )
+            {
+                break;
+            }
+        }
+    }
+
+    std::size_t m_thread_count;
+};
+
+template
+<
+    typename Geometry1,
+    typename Geometry2,
+    bool IsPolygonal = util::is_polygonal<Geometry1>::value
+                    && util::is_polygonal<Geometry2>::value
+>
+struct relate_in_parallel
+{
+    template <typename Handler>
+    static inline void apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             Handler & handler,
+                             std::size_t )
+    {
+        resolve_strategy::relate
+            <
+                default_strategy
+            >::apply(geometry1, geometry2, handler, default_strategy());
+    }
+};
+
+template <typename Geometry1, typename Geometry2>
+struct relate_in_parallel<Geometry1, Geometry2, true>
+{
+    template <typename Handler>
+    static inline void apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             Handler & handler,
+                             std::size_t thread_count)
+    {
+        typedef typename strategies::relate::services::default_strategy
+            <
+                Geometry1,
+                Geometry2
+            >::type strategy_type;
+
+        areal_areal<Geometry1, Geometry2>::apply(geometry1, geometry2,
+            handler, strategy_type(), areal_areal_parallel(thread_count));
+    }
+};
+
+}} // namespace detail::relate
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_AREAL_AREAL_PARALLEL_HPP
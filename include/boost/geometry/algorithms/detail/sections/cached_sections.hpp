@@ -0,0 +1,147 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_CACHED_SECTIONS_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_CACHED_SECTIONS_HPP
+
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+
+#include <boost/geometry/policies/robustness/no_rescale_policy.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace section
+{
+
+// Strategies carrying sections of geometries, calculated beforehand, define
+// the member types cached_sections_tag and sections_type, and the member
+// function find_sections(geometry, reverse), returning a pointer to the
+// sections of the geometry or a null pointer.
+// The sections should be created in two dimensions, without rescaling,
+// using the default maximal count per section.
+template <typename Strategy, typename Enable = void>
+struct has_cached_sections
+    : std::false_type
+{};
+
+template <typename Strategy>
+struct has_cached_sections
+    <
+        Strategy,
+        typename std::conditional
+            <
+                true, void, typename Strategy::cached_sections_tag
+            >::type
+    >
+    : std::true_type
+{};
+
+template
+<
+    typename DimensionVector,
+    typename Sections,
+    typename RobustPolicy,
+    typename Strategy,
+    bool Enable = has_cached_sections<Strategy>::value
+>
+struct use_cached_sections
+    : std::false_type
+{};
+
+template
+<
+    typename DimensionVector,
+    typename Sections,
+    typename RobustPolicy,
+    typename Strategy
+>
+struct use_cached_sections<DimensionVector, Sections, RobustPolicy, Strategy, true>
+    : std::integral_constant
+        <
+            bool,
+            std::is_same<DimensionVector, std::integer_sequence<std::size_t, 0, 1> >::value
+            && std::is_same<RobustPolicy, detail::no_rescale_policy>::value
+            && std::is_same<Sections, typename Strategy::sections_type>::value
+        >
+{};
+
+template
+<
+    bool Reverse, typename DimensionVector,
+    typename Geometry, typename RobustPolicy, typename Sections, typename Strategy
+>
+inline Sections const& get_sections(Geometry const& geometry,
+                                    RobustPolicy const& robust_policy,
+                                    Sections& sections,
+                                    Strategy const& strategy,
+                                    int source_index,
+                                    std::false_type /*use_cached_sections*/)
+{
+    geometry::sectionalize<Reverse, DimensionVector>(geometry, robust_policy,
+                                                     sections, strategy,
+                                                     source_index);
+    return sections;
+}
+
+template
+<
+    bool Reverse, typename DimensionVector,
+    typename Geometry, typename RobustPolicy, typename Sections, typename Strategy
+>
+inline Sections const& get_sections(Geometry const& geometry,
+                                    RobustPolicy const& robust_policy,
+                                    Sections& sections,
+                                    Strategy const& strategy,
+                                    int source_index,
+                                    std::true_type /*use_cached_sections*/)
+{
+    Sections const* cached = strategy.find_sections(geometry, Reverse);
+    if (cached != nullptr)
+    {
+        return *cached;
+    }
+    return get_sections<Reverse, DimensionVector>(geometry, robust_policy,
+                sections, strategy, source_index, std::false_type());
+}
+
+// Returns the sections of a geometry, either the sections carried by the
+// strategy or, if there are none, the sections created in sections.
+// Algorithms do not use the source index of the sections.
+template
+<
+    bool Reverse, typename DimensionVector,
+    typename Geometry, typename RobustPolicy, typename Sections, typename Strategy
+>
+inline Sections const& get_sections(Geometry const& geometry,
+                                    RobustPolicy const& robust_policy,
+                                    Sections& sections,
+                                    Strategy const& strategy,
+                                    int source_index = 0)
+{
+    return get_sections<Reverse, DimensionVector>(geometry, robust_policy,
+                sections, strategy, source_index,
+                use_cached_sections
+                    <
+                        DimensionVector, Sections, RobustPolicy, Strategy
+                    >());
+}
+
+
+}} // namespace detail::section
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_CACHED_SECTIONS_HPP
@@ -0,0 +1,350 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_PAIRS_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_PAIRS_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/algorithms/detail/sweep_pairs.hpp>
+
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace section
+{
+
+// Strategies selecting the sweep to find the pairs of sections, instead of
+// partition, define the member type sweep_sections_tag
+template <typename Strategy, typename Enable = void>
+struct has_sweep_sections
+    : std::false_type
+{};
+
+template <typename Strategy>
+struct has_sweep_sections
+    <
+        Strategy,
+        typename std::conditional
+            <
+                true, void, typename Strategy::sweep_sections_tag
+            >::type
+    >
+    : std::true_type
+{};
+
+// Sections are swept instead of partitioned if the strategy selects it.
+// This is done for cartesian sections only, the boxes of the sections
+// should not wrap around.
+template <typename Box, typename Strategy>
+struct use_sweep_pairs
+    : std::integral_constant
+        <
+            bool,
+            has_sweep_sections<Strategy>::value
+            && std::is_same
+                <
+                    typename geometry::cs_tag<Box>::type,
+                    cartesian_tag
+                >::value
+        >
+{};
+
+template <typename Box, typename Sections, typename Visitor, typename Strategy>
+inline bool partition_or_sweep(Sections const& sections,
+                               Visitor& visitor,
+                               Strategy const& strategy,
+                               std::false_type /*sweep*/)
+{
+    return geometry::partition
+        <
+            Box
+        >::apply(sections, visitor,
+                 detail::section::get_section_box<Strategy>(strategy),
+                 detail::section::overlaps_section_box<Strategy>(strategy));
+}
+
+template <typename Box, typename Sections, typename Visitor, typename Strategy>
+inline bool partition_or_sweep(Sections const& sections,
+                               Visitor& visitor,
+                               Strategy const& strategy,
+                               std::true_type /*sweep*/)
+{
+    return geometry::sweep_pairs
+        <
+            Box
+        >::apply(sections, visitor,
+                 detail::section::get_section_box<Strategy>(strategy));
+}
+
+template
+<
+    typename Box, typename Sections1, typename Sections2,
+    typename Visitor, typename Strategy
+>
+inline bool partition_or_sweep(Sections1 const& sections1,
+                               Sections2 const& sections2,
+                               Visitor& visitor,
+                               Strategy const& strategy,
+                               std::false_type /*sweep*/)
+{
+    return geometry::partition
+        <
+            Box
+        >::apply(sections1, sections2, visitor,
+                 detail::section::get_section_box<Strategy>(strategy),
+                 detail::section::overlaps_section_box<Strategy>(strategy));
+}
+
+template
+<
+    typename Box, typename Sections1, typename Sections2,
+    typename Visitor, typename Strategy
+>
+inline bool partition_or_sweep(Sections1 const& sections1,
+                               Sections2 const& sections2,
+                               Visitor& visitor,
+                               Strategy const& strategy,
+                               std::true_type /*sweep*/)
+{
+    return geometry::sweep_pairs
+        <
+            Box
+        >::apply(sections1, sections2, visitor,
+                 detail::section::get_section_box<Strategy>(strategy));
+}
+
+// Visits the pairs of sections of which the boxes might overlap,
+// returns false if the visitor interrupted
+template <typename Box, typename Sections, typename Visitor, typename Strategy>
+inline bool visit_section_pairs(Sections const& sections,
+                                Visitor& visitor,
+                                Strategy const& strategy)
+{
+    return partition_or_sweep<Box>(sections, visitor, strategy,
+                                   use_sweep_pairs<Box, Strategy>());
+}
+
+template
+<
+    typename Box, typename Sections1, typename Sections2,
+    typename Visitor, typename Strategy
+>
+inline bool visit_section_pairs(Sections1 const& sections1,
+                                Sections2 const& sections2,
+                                Visitor& visitor,
+                                Strategy const& strategy)
+{
+    return partition_or_sweep<Box>(sections1, sections2, visitor, strategy,
+                                   use_sweep_pairs<Box, Strategy>());
+}
+
+
+// Visitor registering, for each visited pair of sections, the range of the
+// elements the visitor appended to the output (e.g. turns)
+template <typename Visitor, typename Output, typename Section1, typename Section2>
+class output_range_visitor
+{
+public :
+    struct pair_range
+    {
+        std::size_t index1, index2;
+        std::size_t begin, end;
+
+        inline bool operator<(pair_range const& other) const
+        {
+            return index1 != other.index1
+                ? index1 < other.index1
+                : index2 < other.index2;
+        }
+    };
+
+    inline output_range_visitor(Visitor& visitor, Output const& output,
+                                Section1 const* first1, Section2 const* first2)
+        : m_visitor(visitor)
+        , m_output(output)
+        , m_first1(first1)
+        , m_first2(first2)
+    {}
+
+    inline bool apply(Section1 const& sec1, Section2 const& sec2)
+    {
+        std::size_t const begin = m_output.size();
+        bool const result = m_visitor.apply(sec1, sec2);
+        if (m_output.size() > begin)
+        {
+            pair_range const range = { std::size_t(&sec1 - m_first1),
+                                       std::size_t(&sec2 - m_first2),
+                                       begin, m_output.size() };
+            m_ranges.push_back(range);
+        }
+        return result;
+    }
+
+    // Reorders the output as if all pairs were visited in the order of
+    // the sections. Elements appended for one pair keep their order.
+    template <typename OutputToReorder>
+    inline void reorder(OutputToReorder& output, std::size_t offset)
+    {
+        std::sort(m_ranges.begin(), m_ranges.end());
+
+        OutputToReorder ordered(output.begin(), output.begin() + offset);
+        for (pair_range const& range : m_ranges)
+        {
+            ordered.insert(ordered.end(),
+                std::make_move_iterator(output.begin() + range.begin),
+                std::make_move_iterator(output.begin() + range.end));
+        }
+        output.swap(ordered);
+    }
+
+private :
+    Visitor& m_visitor;
+    Output const& m_output;
+    Section1 const* m_first1;
+    Section2 const* m_first2;
+    std::vector<pair_range> m_ranges;
+};
+
+template
+<
+    typename Box, typename Sections,
+    typename Visitor, typename Strategy, typename Output
+>
+inline bool visit_section_pairs_ordered(Sections const& sections,
+                                        Visitor& visitor,
+                                        Strategy const& strategy,
+                                        Output& ,
+                                        std::false_type /*sweep*/)
+{
+    // Partition visits the pairs in a deterministic order
+    return partition_or_sweep<Box>(sections, visitor, strategy,
+                                   std::false_type());
+}
+
+template
+<
+    typename Box, typename Sections,
+    typename Visitor, typename Strategy, typename Output
+>
+inline bool visit_section_pairs_ordered(Sections const& sections,
+                                        Visitor& visitor,
+                                        Strategy const& strategy,
+                                        Output& output,
+                                        std::true_type /*sweep*/)
+{
+    typedef typename Sections::value_type section_type;
+    output_range_visitor
+        <
+            Visitor, Output, section_type, section_type
+        > range_visitor(visitor, output, sections.data(), sections.data());
+
+    std::size_t const offset = output.size();
+    bool const result = partition_or_sweep<Box>(sections, range_visitor,
+                                                strategy, std::true_type());
+    range_visitor.reorder(output, offset);
+    return result;
+}
+
+template
+<
+    typename Box, typename Sections1, typename Sections2,
+    typename Visitor, typename Strategy, typename Output
+>
+inline bool visit_section_pairs_ordered(Sections1 const& sections1,
+                                        Sections2 const& sections2,
+                                        Visitor& visitor,
+                                        Strategy const& strategy,
+                                        Output& ,
+                                        std::false_type /*sweep*/)
+{
+    // Partition visits the pairs in a deterministic order
+    return partition_or_sweep<Box>(sections1, sections2, visitor, strategy,
+                                   std::false_type());
+}
+
+template
+<
+    typename Box, typename Sections1, typename Sections2,
+    typename Visitor, typename Strategy, typename Output
+>
+inline bool visit_section_pairs_ordered(Sections1 const& sections1,
+                                        Sections2 const& sections2,
+                                        Visitor& visitor,
+                                        Strategy const& strategy,
+                                        Output& output,
+                                        std::true_type /*sweep*/)
+{
+    output_range_visitor
+        <
+            Visitor, Output,
+            typename Sections1::value_type,
+            typename Sections2::value_type
+        > range_visitor(visitor, output, sections1.data(), sections2.data());
+
+    std::size_t const offset = output.size();
+    bool const result = partition_or_sweep<Box>(sections1, sections2,
+                                                range_visitor, strategy,
+                                                std::true_type());
+    range_visitor.reorder(output, offset);
+    return result;
+}
+
+// Visits the pairs of sections of which the boxes might overlap, like
+// visit_section_pairs. The output, to which the visitor appends its results,
+// is ordered independently of the order in which the sweep finds the pairs.
+// Only the ranges of pairs having output are kept to do that.
+template
+<
+    typename Box, typename Sections,
+    typename Visitor, typename Strategy, typename Output
+>
+inline bool visit_section_pairs(Sections const& sections,
+                                Visitor& visitor,
+                                Strategy const& strategy,
+                                Output& output)
+{
+    return visit_section_pairs_ordered<Box>(sections,
+                                            visitor, strategy, output,
+                                            use_sweep_pairs<Box, Strategy>());
+}
+
+template
+<
+    typename Box, typename Sections1, typename Sections2,
+    typename Visitor, typename Strategy, typename Output
+>
+inline bool visit_section_pairs(Sections1 const& sections1,
+                                Sections2 const& sections2,
+                                Visitor& visitor,
+                                Strategy const& strategy,
+                                Output& output)
+{
+    return visit_section_pairs_ordered<Box>(sections1, sections2,
+                                            visitor, strategy, output,
+                                            use_sweep_pairs<Box, Strategy>());
+}
+
+
+}} // namespace detail::section
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_PAIRS_HPP
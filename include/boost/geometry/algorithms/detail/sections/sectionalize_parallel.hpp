@@ -0,0 +1,552 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTIONALIZE_PARALLEL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTIONALIZE_PARALLEL_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/core/addressof.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
+#include <boost/geometry/algorithms/detail/recalculate.hpp>
+#include <boost/geometry/algorithms/detail/ring_identifier.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+#include <boost/geometry/algorithms/detail/signed_size_type.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+
+#include <boost/geometry/policies/robustness/robust_point_type.hpp>
+
+#include <boost/geometry/util/sequence.hpp>
+
+#include <boost/geometry/views/closeable_view.hpp>
+#include <boost/geometry/views/reversible_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace sectionalize
+{
+
+// Below this number of points the threads are not worth their overhead.
+// It is also the minimal number of points handled by one thread.
+static std::size_t const parallel_min_point_count = 4096;
+
+// Collects the ranges of a geometry which are sectionalized, together with
+// their ring identifiers, in the order used by sectionalize
+template
+<
+    typename Geometry,
+    bool Reverse,
+    typename Tag = typename tag<Geometry>::type
+>
+struct collect_ranges
+{
+    // Other geometries (boxes) are sectionalized as a whole
+    static const bool enabled = false;
+};
+
+template <typename Range, closure_selector Closure, bool Reverse>
+struct collect_range
+{
+    static const bool enabled = true;
+    static const closure_selector closure = Closure;
+    static const bool reverse = Reverse;
+
+    typedef Range range_type;
+
+    template <typename Ranges>
+    static inline void apply(Range const& range, ring_identifier const& ring_id,
+                             Ranges& ranges)
+    {
+        ranges.push_back(std::make_pair(boost::addressof(range), ring_id));
+    }
+};
+
+template <typename LineString, bool Reverse>
+struct collect_ranges<LineString, Reverse, linestring_tag>
+    : collect_range<LineString, closed, false>
+{};
+
+template <typename Ring, bool Reverse>
+struct collect_ranges<Ring, Reverse, ring_tag>
+    : collect_range<Ring, geometry::closure<Ring>::value, Reverse>
+{};
+
+template <typename Polygon, bool Reverse>
+struct collect_ranges<Polygon, Reverse, polygon_tag>
+    : collect_range
+        <
+            typename ring_type<Polygon>::type,
+            geometry::closure<Polygon>::value, Reverse
+        >
+{
+    template <typename Ranges>
+    static inline void apply(Polygon const& polygon, ring_identifier ring_id,
+                             Ranges& ranges)
+    {
+        ring_id.ring_index = -1;
+        ranges.push_back(std::make_pair(boost::addressof(exterior_ring(polygon)),
+                                        ring_id));
+
+        ring_id.ring_index++;
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it, ++ring_id.ring_index)
+        {
+            ranges.push_back(std::make_pair(boost::addressof(*it), ring_id));
+        }
+    }
+};
+
+template <typename MultiGeometry, typename Single>
+struct collect_multi
+    : collect_range
+        <
+            typename Single::range_type, Single::closure, Single::reverse
+        >
+{
+    template <typename Ranges>
+    static inline void apply(MultiGeometry const& multi, ring_identifier ring_id,
+                             Ranges& ranges)
+    {
+        ring_id.multi_index = 0;
+        for (typename boost::range_iterator<MultiGeometry const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it, ++ring_id.multi_index)
+        {
+            Single::apply(*it, ring_id, ranges);
+        }
+    }
+};
+
+template <typename MultiPolygon, bool Reverse>
+struct collect_ranges<MultiPolygon, Reverse, multi_polygon_tag>
+    : collect_multi
+        <
+            MultiPolygon,
+            collect_ranges<typename boost::range_value<MultiPolygon>::type, Reverse>
+        >
+{};
+
+template <typename MultiLinestring, bool Reverse>
+struct collect_ranges<MultiLinestring, Reverse, multi_linestring_tag>
+    : collect_multi
+        <
+            MultiLinestring,
+            collect_ranges<typename boost::range_value<MultiLinestring>::type, Reverse>
+        >
+{};
+
+
+// Part of the work of sectionalize_parallel: either a number of complete
+// ranges, or a part of one range starting at a segment where
+// sectionalize_part starts a new section
+struct sectionalize_task
+{
+    std::size_t first_range;
+    std::size_t last_range;
+    signed_size_type first_segment;
+    signed_size_type last_segment;
+};
+
+
+template
+<
+    bool Reverse,
+    typename DimensionVector,
+    typename Geometry,
+    bool Enabled = collect_ranges<Geometry, Reverse>::enabled
+>
+struct sectionalize_parallel
+{
+    template <typename RobustPolicy, typename Sections, typename Strategy>
+    static inline void apply(Geometry const& geometry,
+                             RobustPolicy const& robust_policy,
+                             Sections& sections,
+                             Strategy const& strategy,
+                             int source_index, std::size_t max_count,
+                             std::size_t)
+    {
+        geometry::sectionalize<Reverse, DimensionVector>(geometry,
+            robust_policy, sections, strategy, source_index, max_count);
+    }
+};
+
+template <bool Reverse, typename DimensionVector, typename Geometry>
+struct sectionalize_parallel<Reverse, DimensionVector, Geometry, true>
+{
+    typedef collect_ranges<Geometry, Reverse> collector;
+    typedef typename collector::range_type range_type;
+    typedef typename point_type<Geometry>::type point_type;
+    typedef std::pair<range_type const*, ring_identifier> item_type;
+
+    typedef typename closeable_view
+        <
+            range_type const, collector::closure
+        >::type cview_type;
+    typedef typename reversible_view
+        <
+            cview_type const,
+            collector::reverse ? iterate_reverse : iterate_forward
+        >::type view_type;
+    typedef typename boost::range_iterator<view_type const>::type iterator_type;
+
+    static const std::size_t dimension_count
+        = util::sequence_size<DimensionVector>::value;
+
+    // Calculates the direction classes of a segment as sectionalize_part does
+    template <typename RobustPolicy>
+    static inline void get_classes(point_type const& p0, point_type const& p1,
+                                   RobustPolicy const& robust_policy,
+                                   int classes[dimension_count])
+    {
+        typedef typename geometry::robust_point_type
+            <
+                point_type, RobustPolicy
+            >::type robust_point_type;
+
+        robust_point_type rp0, rp1;
+        geometry::recalculate(rp0, p0, robust_policy);
+        geometry::recalculate(rp1, p1, robust_policy);
+        model::referring_segment<robust_point_type> segment(rp0, rp1);
+
+        get_direction_loop
+            <
+                point_type, DimensionVector, 0, dimension_count
+            >::apply(segment, classes);
+
+        if (classes[0] == 0
+            && check_duplicate_loop
+                <
+                    0, geometry::dimension<point_type>::type::value
+                >::apply(segment))
+        {
+            assign_loop<int, 0, dimension_count>::apply(classes, -99);
+        }
+    }
+
+    // Returns the first segment in [first, last) at which sectionalize_part
+    // always starts a new section, because its direction classes differ from
+    // the classes of the previous segment. Returns last if there is none.
+    template <typename RobustPolicy>
+    static inline signed_size_type next_section_start(iterator_type begin,
+            signed_size_type first, signed_size_type last,
+            RobustPolicy const& robust_policy)
+    {
+        iterator_type it = std::next(begin, first - 1);
+        point_type const* p0 = boost::addressof(*it++);
+        point_type const* p1 = boost::addressof(*it++);
+
+        int previous[dimension_count] = {0};
+        get_classes(*p0, *p1, robust_policy, previous);
+        for (signed_size_type segment = first; segment < last; ++segment, ++it)
+        {
+            int classes[dimension_count] = {0};
+            get_classes(*p1, *it, robust_policy, classes);
+            if (! compare_loop<int, 0, dimension_count>::apply(classes, previous))
+            {
+                return segment;
+            }
+            copy_loop<int, 0, dimension_count>::apply(classes, previous);
+            p1 = boost::addressof(*it);
+        }
+        return last;
+    }
+
+    template <typename RobustPolicy>
+    static inline void add_tasks(std::vector<item_type> const& ranges,
+                                 std::size_t chunk_size,
+                                 RobustPolicy const& robust_policy,
+                                 std::vector<sectionalize_task>& tasks)
+    {
+        std::size_t first_range = 0;
+        std::size_t point_count = 0;
+        for (std::size_t i = 0; i < ranges.size(); i++)
+        {
+            cview_type const cview(*ranges[i].first);
+            view_type const view(cview);
+            signed_size_type const segment_count
+                = static_cast<signed_size_type>(boost::size(view)) - 1;
+
+            if (segment_count < 2 * static_cast<signed_size_type>(chunk_size))
+            {
+                // Small ranges are combined into one task
+                point_count += boost::size(view);
+                if (point_count >= chunk_size)
+                {
+                    sectionalize_task const task = { first_range, i + 1, 0, 0 };
+                    tasks.push_back(task);
+                    first_range = i + 1;
+                    point_count = 0;
+                }
+                continue;
+            }
+
+            if (first_range < i)
+            {
+                sectionalize_task const task = { first_range, i, 0, 0 };
+                tasks.push_back(task);
+            }
+
+            // Large ranges are split at segments starting a new section
+            signed_size_type const size = static_cast<signed_size_type>(chunk_size);
+            signed_size_type first = 0;
+            while (first < segment_count)
+            {
+                signed_size_type last = segment_count;
+                if (segment_count - first >= 2 * size)
+                {
+                    last = next_section_start(boost::begin(view), first + size,
+                                              segment_count, robust_policy);
+                }
+                sectionalize_task const task = { i, i + 1, first, last };
+                tasks.push_back(task);
+                first = last;
+            }
+
+            first_range = i + 1;
+            point_count = 0;
+        }
+
+        if (first_range < ranges.size())
+        {
+            sectionalize_task const task = { first_range, ranges.size(), 0, 0 };
+            tasks.push_back(task);
+        }
+    }
+
+    template <typename RobustPolicy, typename Sections, typename Strategy>
+    static inline void apply_task(sectionalize_task const& task,
+                                  std::vector<item_type> const& ranges,
+                                  RobustPolicy const& robust_policy,
+                                  Sections& sections,
+                                  Strategy const& strategy,
+                                  std::size_t max_count)
+    {
+        typedef sectionalize_part<point_type, DimensionVector> part_type;
+
+        if (task.first_segment == task.last_segment)
+        {
+            for (std::size_t i = task.first_range; i < task.last_range; i++)
+            {
+                sectionalize_range
+                    <
+                        collector::closure, collector::reverse,
+                        point_type, DimensionVector
+                    >::apply(*ranges[i].first, robust_policy, sections,
+                             strategy, ranges[i].second, max_count);
+            }
+            return;
+        }
+
+        cview_type const cview(*ranges[task.first_range].first);
+        view_type const view(cview);
+
+        part_type::apply(sections,
+                         std::next(boost::begin(view), task.first_segment),
+                         std::next(boost::begin(view), task.last_segment + 1),
+                         robust_policy, strategy,
+                         ranges[task.first_range].second, max_count);
+
+        // Make the sections relative to the whole range
+        for (typename boost::range_iterator<Sections>::type it = boost::begin(sections);
+             it != boost::end(sections); ++it)
+        {
+            it->begin_index += task.first_segment;
+            it->end_index += task.first_segment;
+            it->range_count = boost::size(view);
+        }
+    }
+
+    // Sets the non duplicate indexes and the first/last flags of the sections
+    // of one range, which was split into tasks
+    template <typename Iterator>
+    static inline void fix_split_range(Iterator begin, Iterator end)
+    {
+        signed_size_type ndi = 0;
+        Iterator first = end, last = end;
+        for (Iterator it = begin; it != end; ++it)
+        {
+            it->is_non_duplicate_first = false;
+            it->is_non_duplicate_last = false;
+            if (! it->duplicate)
+            {
+                it->non_duplicate_index = ndi;
+                ndi += static_cast<signed_size_type>(it->count);
+                if (first == end)
+                {
+                    first = it;
+                }
+                last = it;
+            }
+            else
+            {
+                it->non_duplicate_index = ndi;
+            }
+        }
+        if (first != end)
+        {
+            first->is_non_duplicate_first = true;
+            last->is_non_duplicate_last = true;
+        }
+    }
+
+    template <typename RobustPolicy, typename Sections, typename Strategy>
+    static inline void apply(Geometry const& geometry,
+                             RobustPolicy const& robust_policy,
+                             Sections& sections,
+                             Strategy const& strategy,
+                             int source_index, std::size_t max_count,
+                             std::size_t thread_count)
+    {
+        ring_identifier ring_id;
+        ring_id.source_index = source_index;
+
+        std::vector<item_type> ranges;
+        collector::apply(geometry, ring_id, ranges);
+
+        std::size_t point_count = 0;
+        for (std::size_t i = 0; i < ranges.size(); i++)
+        {
+            point_count += boost::size(*ranges[i].first);
+        }
+
+        thread_count = parallel_thread_count(thread_count);
+        if (thread_count < 2 || point_count < 2 * parallel_min_point_count)
+        {
+            geometry::sectionalize<Reverse, DimensionVector>(geometry,
+                robust_policy, sections, strategy, source_index, max_count);
+            return;
+        }
+
+        // Divide the points over about four tasks per thread
+        std::size_t const chunk_size = (std::max)(parallel_min_point_count,
+                                                  point_count / (4 * thread_count));
+
+        std::vector<sectionalize_task> tasks;
+        add_tasks(ranges, chunk_size, robust_policy, tasks);
+
+        std::vector<Sections> parts(tasks.size());
+        parallel_for(tasks.size(), thread_count, [&](std::size_t i)
+        {
+            apply_task(tasks[i], ranges, robust_policy, parts[i],
+                       strategy, max_count);
+        });
+
+        std::size_t section_count = 0;
+        for (std::size_t i = 0; i < parts.size(); i++)
+        {
+            section_count += parts[i].size();
+        }
+
+        sections.clear();
+        sections.reserve(section_count);
+        for (std::size_t i = 0; i < parts.size(); i++)
+        {
+            std::size_t const offset = sections.size();
+            sections.insert(sections.end(), parts[i].begin(), parts[i].end());
+
+            sectionalize_task const& task = tasks[i];
+            bool const split = task.first_segment != task.last_segment;
+            bool const last_part = i + 1 == parts.size()
+                || tasks[i + 1].first_segment == 0;
+            if (split && last_part)
+            {
+                // The last part of a range which was split
+                std::size_t first = offset;
+                while (first > 0
+                       && sections[first - 1].ring_id == sections[offset].ring_id)
+                {
+                    first--;
+                }
+                fix_split_range(sections.begin() + first, sections.end());
+            }
+        }
+
+        detail::sectionalize::enlarge_sections(sections, strategy);
+    }
+};
+
+
+}} // namespace detail::sectionalize
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+    \brief Split a geometry into monotonic sections, using multiple threads
+    \ingroup sectionalize
+    \details The rings or linestrings of the geometry are divided over the
+        threads. Large rings or linestrings are split at segments where a
+        new section starts anyway. Therefore the sections are the same as
+        created by sectionalize, in the same order. Small geometries are
+        sectionalized in the calling thread.
+    \tparam Geometry type of geometry to check
+    \tparam Sections type of sections to create
+    \param geometry geometry to create sections from
+    \param robust_policy policy to handle robustness issues
+    \param sections structure with sections
+    \param strategy strategy for envelope calculation
+    \param source_index index to assign to the ring_identifiers
+    \param max_count maximal number of points per section
+    \param thread_count maximal number of threads to use, 0 means the number
+        of hardware threads
+ */
+template
+<
+    bool Reverse,
+    typename DimensionVector,
+    typename Geometry,
+    typename Sections,
+    typename RobustPolicy,
+    typename Strategy
+>
+inline void sectionalize_parallel(Geometry const& geometry,
+                RobustPolicy const& robust_policy,
+                Sections& sections,
+                Strategy const& strategy,
+                int source_index = 0,
+                std::size_t max_count = 10,
+                std::size_t thread_count = 0)
+{
+    concepts::check<Geometry const>();
+
+    detail::sectionalize::sectionalize_parallel
+        <
+            Reverse, DimensionVector, Geometry
+        >::apply(geometry, robust_policy, sections, strategy,
+                 source_index, max_count, thread_count);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTIONALIZE_PARALLEL_HPP
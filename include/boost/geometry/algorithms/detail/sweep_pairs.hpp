@@ -0,0 +1,352 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SWEEP_PAIRS_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SWEEP_PAIRS_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/core/access.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace sweep_pairs
+{
+
+template <typename Box, typename Iterator>
+struct sweep_item
+{
+    Box box;
+    Iterator it;
+    std::size_t index;
+};
+
+// Orders items on the minimum in the sweep dimension, and then on their
+// position in the input, such that the visiting order is deterministic
+template <std::size_t Dimension>
+struct sweep_less
+{
+    template <typename Item>
+    inline bool operator()(Item const& left, Item const& right) const
+    {
+        if (geometry::get<min_corner, Dimension>(left.box)
+                < geometry::get<min_corner, Dimension>(right.box))
+        {
+            return true;
+        }
+        if (geometry::get<min_corner, Dimension>(right.box)
+                < geometry::get<min_corner, Dimension>(left.box))
+        {
+            return false;
+        }
+        return left.index < right.index;
+    }
+};
+
+template <std::size_t Dimension, typename Box>
+inline bool overlaps_in(Box const& box1, Box const& box2)
+{
+    return ! (geometry::get<max_corner, Dimension>(box1)
+                < geometry::get<min_corner, Dimension>(box2)
+           || geometry::get<max_corner, Dimension>(box2)
+                < geometry::get<min_corner, Dimension>(box1));
+}
+
+template
+<
+    typename IncludePolicy,
+    typename ForwardRange,
+    typename Items,
+    typename ExpandPolicy,
+    typename Box
+>
+inline void fill_items(ForwardRange const& forward_range, Items& items,
+                       ExpandPolicy const& expand_policy, Box& total)
+{
+    typedef typename boost::range_value<Items>::type item_type;
+
+    std::size_t index = 0;
+    for (typename boost::range_iterator<ForwardRange const>::type
+            it = boost::begin(forward_range);
+        it != boost::end(forward_range);
+        ++it, ++index)
+    {
+        if (IncludePolicy::apply(*it))
+        {
+            item_type item;
+            geometry::assign_inverse(item.box);
+            expand_policy.apply(item.box, *it);
+            item.it = it;
+            item.index = index;
+            expand_policy.apply(total, *it);
+            items.push_back(item);
+        }
+    }
+}
+
+// Removes the items ending before the sweep position from the active set.
+// The active set is unordered.
+template <std::size_t Dimension, typename Active, typename Box>
+inline void prune(Active& active, Box const& box)
+{
+    for (std::size_t i = 0; i < active.size(); )
+    {
+        if (geometry::get<max_corner, Dimension>(active[i]->box)
+                < geometry::get<min_corner, Dimension>(box))
+        {
+            active[i] = active.back();
+            active.pop_back();
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+
+// Pairs are visited as soon as they are found, so they are not stored and
+// the visitor can interrupt the sweep. The visiting order depends on the
+// positions of the items.
+template <std::size_t Dimension>
+struct sweep_one_range
+{
+    template <typename Items, typename VisitPolicy>
+    static inline bool apply(Items& items, VisitPolicy& visitor)
+    {
+        typedef typename boost::range_value<Items>::type item_type;
+
+        std::sort(items.begin(), items.end(), sweep_less<Dimension>());
+
+        std::vector<item_type const*> active;
+        for (typename Items::const_iterator it = items.begin();
+             it != items.end(); ++it)
+        {
+            prune<Dimension>(active, it->box);
+
+            for (std::size_t i = 0; i < active.size(); i++)
+            {
+                if (overlaps_in<1 - Dimension>(active[i]->box, it->box))
+                {
+                    // The item first in the input is passed first
+                    bool const proceed = active[i]->index < it->index
+                        ? visitor.apply(*active[i]->it, *it->it)
+                        : visitor.apply(*it->it, *active[i]->it);
+                    if (! proceed)
+                    {
+                        return false; // interrupt
+                    }
+                }
+            }
+            active.push_back(&(*it));
+        }
+
+        return true;
+    }
+};
+
+template <std::size_t Dimension>
+struct sweep_two_ranges
+{
+    template <typename Items1, typename Items2, typename VisitPolicy>
+    static inline bool apply(Items1& items1, Items2& items2,
+                             VisitPolicy& visitor)
+    {
+        typedef typename boost::range_value<Items1>::type item_type1;
+        typedef typename boost::range_value<Items2>::type item_type2;
+
+        sweep_less<Dimension> const less;
+        std::sort(items1.begin(), items1.end(), less);
+        std::sort(items2.begin(), items2.end(), less);
+
+        std::vector<item_type1 const*> active1;
+        std::vector<item_type2 const*> active2;
+
+        // Merge the two sorted sequences, each item is compared with
+        // the active items of the other sequence
+        typename Items1::const_iterator it1 = items1.begin();
+        typename Items2::const_iterator it2 = items2.begin();
+        while (it1 != items1.end() || it2 != items2.end())
+        {
+            bool const take_first = it2 == items2.end()
+                || (it1 != items1.end()
+                    && ! (geometry::get<min_corner, Dimension>(it2->box)
+                            < geometry::get<min_corner, Dimension>(it1->box)));
+
+            if (take_first)
+            {
+                prune<Dimension>(active2, it1->box);
+                for (std::size_t i = 0; i < active2.size(); i++)
+                {
+                    if (overlaps_in<1 - Dimension>(active2[i]->box, it1->box)
+                        && ! visitor.apply(*it1->it, *active2[i]->it))
+                    {
+                        return false; // interrupt
+                    }
+                }
+                active1.push_back(&(*it1));
+                ++it1;
+            }
+            else
+            {
+                prune<Dimension>(active1, it2->box);
+                for (std::size_t i = 0; i < active1.size(); i++)
+                {
+                    if (overlaps_in<1 - Dimension>(active1[i]->box, it2->box)
+                        && ! visitor.apply(*active1[i]->it, *it2->it))
+                    {
+                        return false; // interrupt
+                    }
+                }
+                active2.push_back(&(*it2));
+                ++it2;
+            }
+        }
+
+        return true;
+    }
+};
+
+// Sweeping along the longest side of the total box keeps the active sets
+// small, for example for inputs following a river or a road
+template <typename Box>
+inline bool sweep_in_first_dimension(Box const& total)
+{
+    return geometry::get<max_corner, 1>(total) - geometry::get<min_corner, 1>(total)
+        <= geometry::get<max_corner, 0>(total) - geometry::get<min_corner, 0>(total);
+}
+
+}} // namespace detail::sweep_pairs
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+    \brief Finds the pairs of items with overlapping boxes, by sorting the items
+        along one axis and sweeping over them, keeping the set of items
+        overlapping the sweep position (sweep and prune).
+    \details Alternative to partition, visiting only pairs of which the boxes
+        overlap, using the same visitor and policy concepts (the expand policy
+        calculates the box of an item). Pairs are visited as soon as they are
+        found, without storing them, and the sweep stops as soon as the
+        visitor interrupts. The visiting order depends on the positions of
+        the items, the item first in the input (or of the first range) is
+        passed first.
+        The boxes are compared coordinate-wise, so they should not wrap around,
+        for example around the antimeridian.
+        Touching boxes are considered as overlapping.
+*/
+template
+<
+    typename Box,
+    typename IncludePolicy1 = detail::partition::include_all_policy,
+    typename IncludePolicy2 = detail::partition::include_all_policy
+>
+class sweep_pairs
+{
+    template <typename ForwardRange>
+    struct items_type
+    {
+        typedef std::vector
+            <
+                detail::sweep_pairs::sweep_item
+                    <
+                        Box,
+                        typename boost::range_iterator<ForwardRange const>::type
+                    >
+            > type;
+    };
+
+public:
+    template
+    <
+        typename ForwardRange,
+        typename VisitPolicy,
+        typename ExpandPolicy
+    >
+    static inline bool apply(ForwardRange const& forward_range,
+                             VisitPolicy& visitor,
+                             ExpandPolicy const& expand_policy)
+    {
+        typename items_type<ForwardRange>::type items;
+        Box total;
+        geometry::assign_inverse(total);
+        detail::sweep_pairs::fill_items<IncludePolicy1>(forward_range, items,
+                                                        expand_policy, total);
+        if (items.empty())
+        {
+            return true;
+        }
+
+        return detail::sweep_pairs::sweep_in_first_dimension(total)
+            ? detail::sweep_pairs::sweep_one_range<0>::apply(items, visitor)
+            : detail::sweep_pairs::sweep_one_range<1>::apply(items, visitor);
+    }
+
+    template
+    <
+        typename ForwardRange1,
+        typename ForwardRange2,
+        typename VisitPolicy,
+        typename ExpandPolicy1,
+        typename ExpandPolicy2
+    >
+    static inline bool apply(ForwardRange1 const& forward_range1,
+                             ForwardRange2 const& forward_range2,
+                             VisitPolicy& visitor,
+                             ExpandPolicy1 const& expand_policy1,
+                             ExpandPolicy2 const& expand_policy2)
+    {
+        typename items_type<ForwardRange1>::type items1;
+        typename items_type<ForwardRange2>::type items2;
+        Box total;
+        geometry::assign_inverse(total);
+        detail::sweep_pairs::fill_items<IncludePolicy1>(forward_range1, items1,
+                                                        expand_policy1, total);
+        detail::sweep_pairs::fill_items<IncludePolicy2>(forward_range2, items2,
+                                                        expand_policy2, total);
+        if (items1.empty() || items2.empty())
+        {
+            return true;
+        }
+
+        return detail::sweep_pairs::sweep_in_first_dimension(total)
+            ? detail::sweep_pairs::sweep_two_ranges<0>::apply(items1, items2, visitor)
+            : detail::sweep_pairs::sweep_two_ranges<1>::apply(items1, items2, visitor);
+    }
+
+    template
+    <
+        typename ForwardRange1,
+        typename ForwardRange2,
+        typename VisitPolicy,
+        typename ExpandPolicy
+    >
+    static inline bool apply(ForwardRange1 const& forward_range1,
+                             ForwardRange2 const& forward_range2,
+                             VisitPolicy& visitor,
+                             ExpandPolicy const& expand_policy)
+    {
+        return apply(forward_range1, forward_range2, visitor,
+                     expand_policy, expand_policy);
+    }
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SWEEP_PAIRS_HPP
@@ -0,0 +1,355 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_EDGE_INDEX_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_EDGE_INDEX_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/views/detail/normalized_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace within
+{
+
+
+/*!
+\brief Returns the range of coordinates for which the cartesian winding
+    strategy takes a segment with the specified coordinates into account
+\details The interval is enlarged slightly, to be consistent with
+    math::equals used in the winding strategy.
+*/
+template <typename T>
+inline std::pair<T, T> winding_interval(T const& c1, T const& c2)
+{
+    T const low = (std::min)(c1, c2);
+    T const high = (std::max)(c1, c2);
+    return std::pair<T, T>(low - 2 * math::scaled_epsilon(low),
+                           high + 2 * math::scaled_epsilon(high));
+}
+
+
+/*!
+\brief Divides the first axis into slabs of equal width and registers each
+    interval in all slabs it overlaps.
+\details All intervals possibly containing a coordinate are found by one
+    division. The number of slabs is chosen such that the total number of
+    registrations stays linear in the number of intervals, also for inputs
+    with many long intervals.
+*/
+template <typename CalculationType>
+class interval_slabs
+{
+public :
+    typedef CalculationType calculation_type;
+    typedef std::pair<std::size_t const*, std::size_t const*> candidates_type;
+
+    inline interval_slabs()
+        : m_min(0)
+        , m_max(0)
+        , m_scale(0)
+    {}
+
+    //! Intervals is a range of std::pair<T, T> containing (low, high).
+    //! Intervals with low > high are not registered.
+    template <typename Intervals>
+    inline void assign(Intervals const& intervals, std::size_t max_slab_count)
+    {
+        m_offsets.clear();
+        m_items.clear();
+
+        typedef typename boost::range_iterator<Intervals const>::type iterator;
+
+        std::size_t count = 0;
+        calculation_type sum_of_widths = 0;
+        for (iterator it = boost::begin(intervals); it != boost::end(intervals); ++it)
+        {
+            calculation_type const low = static_cast<calculation_type>(it->first);
+            calculation_type const high = static_cast<calculation_type>(it->second);
+            if (! (low <= high))
+            {
+                continue;
+            }
+            m_min = count == 0 ? low : (std::min)(m_min, low);
+            m_max = count == 0 ? high : (std::max)(m_max, high);
+            sum_of_widths += high - low;
+            count++;
+        }
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        calculation_type const width = m_max - m_min;
+
+        std::size_t slab_count = 1;
+        if (width > 0 && max_slab_count > 1)
+        {
+            // Average number of intervals overlapping a coordinate. Every
+            // slab holds at least this number, so limit the number of slabs
+            // such that there are at most four registrations per interval.
+            calculation_type const overlap
+                = (std::max)(sum_of_widths / width, calculation_type(1));
+            calculation_type const limit
+                = calculation_type(4) * calculation_type(count) / overlap;
+            slab_count = limit >= calculation_type(max_slab_count)
+                       ? max_slab_count
+                       : (std::max)(std::size_t(limit), std::size_t(1));
+        }
+
+        m_scale = width > 0
+                ? calculation_type(slab_count) / width
+                : calculation_type(0);
+
+        // Count per slab, then store the items slab by slab (compressed rows)
+        m_offsets.assign(slab_count + 1, 0);
+        for (iterator it = boost::begin(intervals); it != boost::end(intervals); ++it)
+        {
+            if (! (it->first <= it->second))
+            {
+                continue;
+            }
+            std::size_t const last = slab(it->second);
+            for (std::size_t s = slab(it->first); s <= last; s++)
+            {
+                m_offsets[s + 1]++;
+            }
+        }
+        for (std::size_t s = 0; s < slab_count; s++)
+        {
+            m_offsets[s + 1] += m_offsets[s];
+        }
+
+        m_items.resize(m_offsets.back());
+        std::vector<std::size_t> positions(m_offsets.begin(), m_offsets.end() - 1);
+        std::size_t index = 0;
+        for (iterator it = boost::begin(intervals); it != boost::end(intervals); ++it, ++index)
+        {
+            if (! (it->first <= it->second))
+            {
+                continue;
+            }
+            std::size_t const last = slab(it->second);
+            for (std::size_t s = slab(it->first); s <= last; s++)
+            {
+                m_items[positions[s]++] = index;
+            }
+        }
+    }
+
+    inline bool empty() const
+    {
+        return m_offsets.empty();
+    }
+
+    inline calculation_type min_value() const { return m_min; }
+    inline calculation_type max_value() const { return m_max; }
+
+    //! Returns the indexes (in ascending order) of all intervals which
+    //! might contain the specified value
+    template <typename T>
+    inline candidates_type candidates(T const& value) const
+    {
+        calculation_type const v = static_cast<calculation_type>(value);
+        if (m_offsets.empty() || ! (v >= m_min && v <= m_max))
+        {
+            return candidates_type(nullptr, nullptr);
+        }
+
+        std::size_t const s = slab(v);
+        std::size_t const* const items = m_items.data();
+        return candidates_type(items + m_offsets[s], items + m_offsets[s + 1]);
+    }
+
+private :
+    // NOTE: this function has to be monotonic, such that an interval
+    // [low, high] containing v is registered in the slab of v
+    template <typename T>
+    inline std::size_t slab(T const& value) const
+    {
+        calculation_type const v
+            = (static_cast<calculation_type>(value) - m_min) * m_scale;
+        std::size_t const last = m_offsets.size() - 2;
+        return v <= 0 ? 0
+             : v >= calculation_type(last) ? last
+             : static_cast<std::size_t>(v);
+    }
+
+    calculation_type m_min;
+    calculation_type m_max;
+    calculation_type m_scale;
+    std::vector<std::size_t> m_offsets;
+    std::vector<std::size_t> m_items;
+};
+
+
+/*!
+\brief Index of the segments of a ring, for repeated point in ring tests
+\details Stores a copy of the normalized ring and registers its segments
+    in slabs along the x-axis. A winding strategy only takes segments into
+    account of which the x-range contains the x-coordinate of the point,
+    so it is enough to visit the segments of one slab. Therefore the results
+    are identical to the results of point_in_range, for the cartesian
+    winding strategy.
+*/
+template <typename Point>
+class edge_index
+{
+    typedef typename geometry::coordinate_type<Point>::type coordinate_type;
+
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (std::is_same<typename cs_tag<Point>::type, cartesian_tag>::value),
+        "Only cartesian coordinate systems are supported.",
+        Point);
+
+public :
+    typedef typename select_most_precise
+        <
+            coordinate_type, double
+        >::type calculation_type;
+    typedef std::pair<coordinate_type, coordinate_type> interval_type;
+
+    inline edge_index()
+        : m_valid(false)
+    {}
+
+    template <typename Ring>
+    explicit inline edge_index(Ring const& ring)
+        : m_valid(false)
+    {
+        assign(ring);
+    }
+
+    template <typename Ring>
+    inline void assign(Ring const& ring)
+    {
+        m_points.clear();
+        m_valid = boost::size(ring) >= core_detail::closure::minimum_ring_size
+                                        <
+                                            geometry::closure<Ring>::value
+                                        >::value;
+        if (! m_valid)
+        {
+            m_slabs = interval_slabs<calculation_type>();
+            return;
+        }
+
+        detail::normalized_view<Ring const> view(ring);
+        m_points.assign(boost::begin(view), boost::end(view));
+
+        std::size_t const segment_count = m_points.size() - 1;
+        std::vector<interval_type> intervals;
+        intervals.reserve(segment_count);
+
+        m_y = winding_interval(geometry::get<1>(m_points.front()),
+                               geometry::get<1>(m_points.front()));
+        for (std::size_t i = 0; i < segment_count; i++)
+        {
+            Point const& p1 = m_points[i];
+            Point const& p2 = m_points[i + 1];
+            intervals.push_back(winding_interval(geometry::get<0>(p1),
+                                                 geometry::get<0>(p2)));
+            interval_type const y = winding_interval(geometry::get<1>(p2),
+                                                     geometry::get<1>(p2));
+            m_y.first = (std::min)(m_y.first, y.first);
+            m_y.second = (std::max)(m_y.second, y.second);
+        }
+
+        m_slabs.assign(intervals, segment_count);
+    }
+
+    //! Returns the range of x-coordinates, slightly enlarged, or an
+    //! inverse interval if the ring is empty
+    inline std::pair<calculation_type, calculation_type> x_range() const
+    {
+        return m_slabs.empty()
+            ? std::make_pair(calculation_type(1), calculation_type(0))
+            : std::make_pair(m_slabs.min_value(), m_slabs.max_value());
+    }
+
+    inline interval_type const& y_range() const
+    {
+        return m_y;
+    }
+
+    inline bool empty() const
+    {
+        return ! m_valid;
+    }
+
+    inline std::size_t segment_count() const
+    {
+        return m_points.empty() ? 0 : m_points.size() - 1;
+    }
+
+    //! Returns 1 if the point is in the interior, 0 if it is on the boundary
+    //! and -1 if it is in the exterior of the ring (as point_in_range)
+    //! \tparam Strategy point-segment winding strategy
+    template <typename P, typename Strategy>
+    inline int apply(P const& point, Strategy const& strategy) const
+    {
+        if (! m_valid)
+        {
+            return -1;
+        }
+
+        coordinate_type const y = geometry::get<1>(point);
+        if (y < m_y.first || y > m_y.second)
+        {
+            return -1;
+        }
+
+        typename interval_slabs<calculation_type>::candidates_type const
+            candidates = m_slabs.candidates(geometry::get<0>(point));
+
+        typename Strategy::state_type state;
+        for (std::size_t const* it = candidates.first; it != candidates.second; ++it)
+        {
+            if (! strategy.apply(point, m_points[*it], m_points[*it + 1], state))
+            {
+                break;
+            }
+        }
+        return strategy.result(state);
+    }
+
+private :
+    bool m_valid;
+    std::vector<Point> m_points;
+    interval_type m_y;
+    interval_slabs<calculation_type> m_slabs;
+};
+
+
+}} // namespace detail::within
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_EDGE_INDEX_HPP
@@ -12,6 +12,7 @@
 
 
 #include <algorithm>
+#include <type_traits>
 #include <vector>
 
 #include <boost/range/begin.hpp>
@@ -23,6 +24,7 @@
 #include <boost/geometry/algorithms/detail/disjoint/point_box.hpp>
 #include <boost/geometry/algorithms/detail/expand_by_epsilon.hpp>
 #include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry_batch.hpp>
 #include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/detail/partition.hpp>
 #include <boost/geometry/core/tag.hpp>
@@ -109,10 +111,8 @@ struct multi_point_multi_point
 // TODO: the complexity could be lesser
 //   the second geometry could be "prepared"/sorted
 // For Linear geometries partition could be used
-// For Areal geometries point_in_geometry() would have to call the winding
-//   strategy differently, currently it linearly calls the strategy for each
-//   segment. So the segments would have to be sorted in a way consistent with
-//   the strategy and then the strategy called only for the segments in range.
+// For Areal geometries and the cartesian winding strategy the points are
+//   sorted and the segments are visited once, see point_in_geometry_batch.
 template <bool Within>
 struct multi_point_single_geometry
 {
@@ -120,6 +120,22 @@ struct multi_point_single_geometry
     static inline bool apply(MultiPoint const& multi_point,
                              LinearOrAreal const& linear_or_areal,
                              Strategy const& strategy)
+    {
+        typedef typename boost::range_value<MultiPoint>::type point1_type;
+
+        return apply(multi_point, linear_or_areal, strategy,
+                     use_point_in_geometry_sweep
+                        <
+                            point1_type, LinearOrAreal, Strategy
+                        >());
+    }
+
+private:
+    template <typename MultiPoint, typename LinearOrAreal, typename Strategy>
+    static inline bool apply(MultiPoint const& multi_point,
+                             LinearOrAreal const& linear_or_areal,
+                             Strategy const& strategy,
+                             std::false_type /*sweep*/)
     {
         //typedef typename boost::range_value<MultiPoint>::type point1_type;
         typedef typename point_type<LinearOrAreal>::type point2_type;
@@ -158,6 +174,55 @@ struct multi_point_single_geometry
 
         return result;
     }
+
+    template <typename MultiPoint, typename Areal, typename Strategy>
+    static inline bool apply(MultiPoint const& multi_point,
+                             Areal const& areal,
+                             Strategy const& strategy,
+                             std::true_type /*sweep*/)
+    {
+        typedef typename point_type<Areal>::type point2_type;
+        typedef model::box<point2_type> box2_type;
+
+        // Create envelope of geometry
+        box2_type box;
+        geometry::envelope(areal, box, strategy);
+        geometry::detail::expand_by_epsilon(box);
+
+        // If a Point is in the exterior of the envelope, break
+        typedef typename boost::range_const_iterator<MultiPoint>::type iterator;
+        for ( iterator it = boost::begin(multi_point) ; it != boost::end(multi_point) ; ++it )
+        {
+            typedef decltype(strategy.covered_by(*it, box)) point_in_box_type;
+
+            if (! point_in_box_type::apply(*it, box))
+            {
+                return false;
+            }
+        }
+
+        // Test all Points with the geometry at once
+        std::vector<int> codes;
+        point_in_geometry_batch(multi_point, areal, codes, strategy);
+
+        bool result = false;
+        for (std::vector<int>::const_iterator it = codes.begin(); it != codes.end(); ++it)
+        {
+            // exterior of geometry
+            if (*it < 0)
+            {
+                return false;
+            }
+
+            // interior : interior/boundary
+            if (Within ? *it > 0 : *it >= 0)
+            {
+                result = true;
+            }
+        }
+
+        return result;
+    }
 };
 
 
@@ -20,6 +20,8 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_POINT_IN_GEOMETRY_HPP
 
 
+#include <type_traits>
+
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
@@ -63,6 +65,46 @@ int point_in_range(Point const& point, Range const& range, Strategy const& strat
     return strategy.result(state);
 }
 
+// Strategies answering point in ring queries for a whole ring at once,
+// e.g. using a precomputed index, define the member type ring_index_tag
+// and the member function apply_ring(point, ring, result), returning false
+// for rings it can not answer for, which are then processed as by the
+// point-segment strategy
+template <typename Strategy, typename Enable = void>
+struct has_ring_index
+    : std::false_type
+{};
+
+template <typename Strategy>
+struct has_ring_index
+    <
+        Strategy,
+        typename std::conditional
+            <
+                true, void, typename Strategy::ring_index_tag
+            >::type
+    >
+    : std::true_type
+{};
+
+template <typename Point, typename Ring, typename Strategy> inline
+int point_in_ring(Point const& point, Ring const& ring, Strategy const& strategy,
+                  std::false_type /*has_ring_index*/)
+{
+    detail::normalized_view<Ring const> view(ring);
+    return detail::within::point_in_range(point, view, strategy);
+}
+
+template <typename Point, typename Ring, typename Strategy> inline
+int point_in_ring(Point const& point, Ring const& ring, Strategy const& strategy,
+                  std::true_type /*has_ring_index*/)
+{
+    int result = -1;
+    return strategy.apply_ring(point, ring, result)
+        ? result
+        : point_in_ring(point, ring, strategy, std::false_type());
+}
+
 }} // namespace detail::within
 
 namespace detail_dispatch { namespace within {
@@ -180,9 +222,10 @@ struct point_in_geometry<Ring, ring_tag>
             return -1;
         }
 
-        detail::normalized_view<Ring const> view(ring);
-        return detail::within::point_in_range(point, view,
-                                              strategy.relate(point, ring));
+        typedef decltype(strategy.relate(point, ring)) strategy_type;
+        return detail::within::point_in_ring(point, ring,
+                    strategy.relate(point, ring),
+                    detail::within::has_ring_index<strategy_type>());
     }
 };
 
@@ -0,0 +1,431 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_POINT_IN_GEOMETRY_BATCH_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_POINT_IN_GEOMETRY_BATCH_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/core/addressof.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/within/edge_index.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+
+#include <boost/geometry/strategies/cartesian/point_in_poly_winding.hpp>
+
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/views/detail/normalized_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace within
+{
+
+// The sweep is valid for strategies only taking segments into account of
+// which the x-range contains the point, which is the case for the cartesian
+// winding strategy (and strategies derived from it)
+template <typename P1, typename P2, typename CalculationType>
+inline std::true_type is_cartesian_winding(
+        strategy::within::cartesian_winding<P1, P2, CalculationType> const*)
+{
+    return std::true_type();
+}
+
+inline std::false_type is_cartesian_winding(...)
+{
+    return std::false_type();
+}
+
+
+//! Points sorted by x-coordinate, with their original positions
+template <typename Point, typename CalculationType>
+struct sorted_points
+{
+    std::vector<CalculationType> xs;
+    std::vector<std::size_t> ids;
+
+    inline std::size_t size() const
+    {
+        return ids.size();
+    }
+
+    //! Returns the positions of the points with x in [low, high]
+    inline std::pair<std::size_t, std::size_t>
+        equal_range(CalculationType const& low, CalculationType const& high) const
+    {
+        typename std::vector<CalculationType>::const_iterator const first
+            = std::lower_bound(xs.begin(), xs.end(), low);
+        typename std::vector<CalculationType>::const_iterator const last
+            = std::upper_bound(first, xs.end(), high);
+        return std::make_pair(std::size_t(first - xs.begin()),
+                              std::size_t(last - xs.begin()));
+    }
+
+    inline void push_back(CalculationType const& x, std::size_t id)
+    {
+        xs.push_back(x);
+        ids.push_back(id);
+    }
+};
+
+
+template <typename Point, typename CalculationType>
+class point_in_geometry_sweep
+{
+    typedef sorted_points<Point, CalculationType> sorted_type;
+
+public :
+    template <typename Points>
+    explicit inline point_in_geometry_sweep(Points const& points)
+    {
+        m_points.reserve(boost::size(points));
+        for (typename boost::range_iterator<Points const>::type
+                it = boost::begin(points); it != boost::end(points); ++it)
+        {
+            m_points.push_back(boost::addressof(*it));
+        }
+
+        std::vector<std::pair<CalculationType, std::size_t> > order;
+        order.reserve(m_points.size());
+        for (std::size_t i = 0; i < m_points.size(); i++)
+        {
+            order.push_back(std::make_pair(
+                static_cast<CalculationType>(geometry::get<0>(*m_points[i])), i));
+        }
+        std::sort(order.begin(), order.end());
+
+        m_all.xs.reserve(order.size());
+        m_all.ids.reserve(order.size());
+        for (std::size_t i = 0; i < order.size(); i++)
+        {
+            m_all.push_back(order[i].first, order[i].second);
+        }
+    }
+
+    //! Assigns point_in_geometry codes of all points, in their original order
+    template <typename Geometry, typename Strategy>
+    inline void apply(Geometry const& geometry, std::vector<int>& codes,
+                      Strategy const& strategy) const
+    {
+        codes.assign(m_points.size(), -1);
+        apply(geometry, m_all, codes, strategy,
+              typename geometry::tag<Geometry>::type());
+    }
+
+private :
+    template <typename Ring, typename Strategy>
+    inline void apply(Ring const& ring, sorted_type const& subset,
+                      std::vector<int>& codes, Strategy const& strategy,
+                      ring_tag) const
+    {
+        std::vector<int> ring_codes;
+        apply_ring(ring, subset, ring_codes, strategy);
+        for (std::size_t i = 0; i < subset.size(); i++)
+        {
+            codes[subset.ids[i]] = ring_codes[i];
+        }
+    }
+
+    // Polygon: in exterior ring, and if so, not within interior ring(s)
+    template <typename Polygon, typename Strategy>
+    inline void apply(Polygon const& polygon, sorted_type const& subset,
+                      std::vector<int>& codes, Strategy const& strategy,
+                      polygon_tag) const
+    {
+        std::vector<int> ring_codes;
+        apply_ring(exterior_ring(polygon), subset, ring_codes, strategy);
+
+        sorted_type inside;
+        for (std::size_t i = 0; i < subset.size(); i++)
+        {
+            codes[subset.ids[i]] = ring_codes[i];
+            if (ring_codes[i] == 1)
+            {
+                inside.push_back(subset.xs[i], subset.ids[i]);
+            }
+        }
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings);
+             it != boost::end(rings) && inside.size() > 0; ++it)
+        {
+            apply_ring(*it, inside, ring_codes, strategy);
+
+            // Points in or on the interior ring are decided, the others
+            // are checked against the next interior rings
+            sorted_type remaining;
+            for (std::size_t i = 0; i < inside.size(); i++)
+            {
+                if (ring_codes[i] != -1)
+                {
+                    codes[inside.ids[i]] = -ring_codes[i];
+                }
+                else
+                {
+                    remaining.push_back(inside.xs[i], inside.ids[i]);
+                }
+            }
+            inside = std::move(remaining);
+        }
+    }
+
+    template <typename MultiPolygon, typename Strategy>
+    inline void apply(MultiPolygon const& multi_polygon, sorted_type const& subset,
+                      std::vector<int>& codes, Strategy const& strategy,
+                      multi_polygon_tag) const
+    {
+        typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+        std::vector<int> polygon_codes(codes.size(), -1);
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi_polygon); it != boost::end(multi_polygon); ++it)
+        {
+            typedef typename ring_type<polygon_type>::type ring_type;
+            ring_type const& exterior = exterior_ring(*it);
+            if (boost::size(exterior) == 0)
+            {
+                continue;
+            }
+
+            // Only points within the x-range of the exterior ring, and not
+            // yet found in or on one of the previous polygons, are checked
+            std::pair<CalculationType, CalculationType> range = x_range(exterior);
+            std::pair<std::size_t, std::size_t> const positions
+                = subset.equal_range(range.first, range.second);
+
+            sorted_type candidates;
+            for (std::size_t i = positions.first; i < positions.second; i++)
+            {
+                if (codes[subset.ids[i]] == -1)
+                {
+                    candidates.push_back(subset.xs[i], subset.ids[i]);
+                }
+            }
+            if (candidates.size() == 0)
+            {
+                continue;
+            }
+
+            apply(*it, candidates, polygon_codes, strategy, polygon_tag());
+            for (std::size_t i = 0; i < candidates.size(); i++)
+            {
+                codes[candidates.ids[i]] = polygon_codes[candidates.ids[i]];
+            }
+        }
+    }
+
+    template <typename Ring>
+    static inline std::pair<CalculationType, CalculationType> x_range(Ring const& ring)
+    {
+        typedef typename boost::range_iterator<Ring const>::type iterator;
+        iterator it = boost::begin(ring);
+        CalculationType low = static_cast<CalculationType>(geometry::get<0>(*it));
+        CalculationType high = low;
+        for (++it; it != boost::end(ring); ++it)
+        {
+            CalculationType const x = static_cast<CalculationType>(geometry::get<0>(*it));
+            low = (std::min)(low, x);
+            high = (std::max)(high, x);
+        }
+        return winding_interval(low, high);
+    }
+
+    // Visits all segments once, and for each segment all points within its
+    // x-range. The winding strategy is commutative in the segments, so the
+    // result is identical to calling point_in_range for each point.
+    template <typename Ring, typename Strategy>
+    inline void apply_ring(Ring const& ring, sorted_type const& subset,
+                           std::vector<int>& ring_codes,
+                           Strategy const& strategy) const
+    {
+        ring_codes.assign(subset.size(), -1);
+
+        if (boost::size(ring) < core_detail::closure::minimum_ring_size
+                                    <
+                                        geometry::closure<Ring>::value
+                                    >::value)
+        {
+            return;
+        }
+
+        typedef decltype(strategy.relate(*m_points.front(), ring)) winding_type;
+        typedef typename winding_type::state_type state_type;
+        winding_type const winding = strategy.relate(*m_points.front(), ring);
+
+        std::vector<state_type> states(subset.size());
+        // Points touching the ring are not passed to the strategy anymore,
+        // as in point_in_range
+        std::vector<char> touching(subset.size(), 0);
+
+        detail::normalized_view<Ring const> view(ring);
+        typedef typename boost::range_iterator
+            <
+                detail::normalized_view<Ring const> const
+            >::type iterator;
+
+        iterator it = boost::begin(view);
+        for (iterator previous = it++; it != boost::end(view); ++previous, ++it)
+        {
+            std::pair<CalculationType, CalculationType> const range
+                = winding_interval(
+                    static_cast<CalculationType>(geometry::get<0>(*previous)),
+                    static_cast<CalculationType>(geometry::get<0>(*it)));
+
+            std::pair<std::size_t, std::size_t> const positions
+                = subset.equal_range(range.first, range.second);
+
+            for (std::size_t i = positions.first; i < positions.second; i++)
+            {
+                if (touching[i] == 0
+                    && ! winding.apply(*m_points[subset.ids[i]],
+                                       *previous, *it, states[i]))
+                {
+                    touching[i] = 1;
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < subset.size(); i++)
+        {
+            ring_codes[i] = winding.result(states[i]);
+        }
+    }
+
+    std::vector<Point const*> m_points;
+    sorted_type m_all;
+};
+
+
+template <typename Points, typename Geometry, typename Strategy>
+inline void point_in_geometry_batch(Points const& points,
+                                    Geometry const& geometry,
+                                    std::vector<int>& codes,
+                                    Strategy const& strategy,
+                                    std::true_type /*sweep*/)
+{
+    typedef typename boost::range_value<Points>::type point_type;
+    typedef typename select_most_precise
+        <
+            typename geometry::coordinate_type<point_type>::type,
+            typename geometry::coordinate_type<Geometry>::type,
+            double
+        >::type calculation_type;
+
+    point_in_geometry_sweep<point_type, calculation_type> const sweep(points);
+    sweep.apply(geometry, codes, strategy);
+}
+
+template <typename Points, typename Geometry, typename Strategy>
+inline void point_in_geometry_batch(Points const& points,
+                                    Geometry const& geometry,
+                                    std::vector<int>& codes,
+                                    Strategy const& strategy,
+                                    std::false_type /*sweep*/)
+{
+    codes.clear();
+    codes.reserve(boost::size(points));
+    for (typename boost::range_iterator<Points const>::type
+            it = boost::begin(points); it != boost::end(points); ++it)
+    {
+        codes.push_back(point_in_geometry(*it, geometry, strategy));
+    }
+}
+
+template
+<
+    typename Point, typename Geometry, typename Strategy,
+    typename Tag = typename tag<Geometry>::type
+>
+struct use_point_in_geometry_sweep
+    : std::false_type
+{};
+
+template <typename Point, typename Ring, typename Strategy>
+struct use_point_in_geometry_sweep<Point, Ring, Strategy, ring_tag>
+    : decltype(is_cartesian_winding(
+        static_cast
+            <
+                decltype(std::declval<Strategy>().relate(std::declval<Point>(),
+                                                         std::declval<Ring>())) const*
+            >(nullptr)))
+{};
+
+template <typename Point, typename Polygon, typename Strategy>
+struct use_point_in_geometry_sweep<Point, Polygon, Strategy, polygon_tag>
+    : use_point_in_geometry_sweep
+        <
+            Point, typename ring_type<Polygon>::type, Strategy
+        >
+{};
+
+template <typename Point, typename MultiPolygon, typename Strategy>
+struct use_point_in_geometry_sweep<Point, MultiPolygon, Strategy, multi_polygon_tag>
+    : use_point_in_geometry_sweep
+        <
+            Point, typename boost::range_value<MultiPolygon>::type, Strategy
+        >
+{};
+
+/*!
+\brief Calculates point_in_geometry for all points of a range
+\details For areal geometries and the cartesian winding strategy the points
+    are sorted once and the segments of each ring are visited once,
+    instead of visiting all segments for each point. Other combinations
+    call point_in_geometry for each point.
+\param codes Output: for each point 1 if it is in the interior, 0 if it is on
+    the boundary and -1 if it is in the exterior of the geometry
+*/
+template <typename Points, typename Geometry, typename Strategy>
+inline void point_in_geometry_batch(Points const& points,
+                                    Geometry const& geometry,
+                                    std::vector<int>& codes,
+                                    Strategy const& strategy)
+{
+    typedef typename boost::range_value<Points>::type point_type;
+
+    if (boost::size(points) == 0)
+    {
+        codes.clear();
+        return;
+    }
+
+    point_in_geometry_batch(points, geometry, codes, strategy,
+        use_point_in_geometry_sweep<point_type, Geometry, Strategy>());
+}
+
+
+}} // namespace detail::within
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_POINT_IN_GEOMETRY_BATCH_HPP
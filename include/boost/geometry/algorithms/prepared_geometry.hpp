@@ -0,0 +1,657 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_PREPARED_GEOMETRY_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_PREPARED_GEOMETRY_HPP
+
+
+#include <cstddef>
+#include <deque>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/empty.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/areal_areal.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/linear_linear.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/segment_box.hpp>
+#include <boost/geometry/algorithms/detail/for_each_range.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/overlay/do_reverse.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+#include <boost/geometry/algorithms/detail/overlay/turn_info.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/detail/point_on_border.hpp>
+#include <boost/geometry/algorithms/detail/sections/range_by_section.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+#include <boost/geometry/algorithms/detail/within/edge_index.hpp>
+
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+
+#include <boost/geometry/policies/disjoint_interrupt_policy.hpp>
+#include <boost/geometry/policies/robustness/no_rescale_policy.hpp>
+#include <boost/geometry/policies/robustness/segment_ratio.hpp>
+
+#include <boost/geometry/strategies/relate/cartesian.hpp>
+#include <boost/geometry/strategies/relate/services.hpp>
+
+#include <boost/geometry/util/type_traits.hpp>
+
+#include <boost/geometry/views/closeable_view.hpp>
+#include <boost/geometry/views/reversible_view.hpp>
+#include <boost/geometry/views/detail/range_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared
+{
+
+
+// Indexes of the rings of one polygon. Interior rings are registered by
+// their x-range as well, such that only few of them are visited per point.
+template <typename Point>
+class polygon_index
+{
+    typedef detail::within::edge_index<Point> ring_index;
+    typedef typename ring_index::calculation_type calculation_type;
+
+public :
+    template <typename Ring>
+    inline void assign_exterior(Ring const& ring)
+    {
+        m_exterior.assign(ring);
+    }
+
+    template <typename Polygon>
+    inline void assign(Polygon const& polygon)
+    {
+        m_exterior.assign(exterior_ring(polygon));
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+
+        m_interiors.clear();
+        m_interiors.reserve(boost::size(rings));
+        std::vector<std::pair<calculation_type, calculation_type> > intervals;
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            m_interiors.push_back(ring_index(*it));
+            intervals.push_back(m_interiors.back().x_range());
+        }
+        m_interior_slabs.assign(intervals, m_interiors.size());
+    }
+
+    inline ring_index const& exterior() const
+    {
+        return m_exterior;
+    }
+
+    // Same semantics as point_in_geometry for polygons
+    template <typename P, typename Strategy>
+    inline int apply(P const& point, Strategy const& strategy) const
+    {
+        int const code = m_exterior.apply(point, strategy);
+        if (code != 1)
+        {
+            return code;
+        }
+
+        typename detail::within::interval_slabs
+            <
+                calculation_type
+            >::candidates_type const candidates
+                = m_interior_slabs.candidates(geometry::get<0>(point));
+
+        for (std::size_t const* it = candidates.first; it != candidates.second; ++it)
+        {
+            int const interior_code = m_interiors[*it].apply(point, strategy);
+            if (interior_code != -1)
+            {
+                // If 0, return 0 (touch)
+                // If 1 (inside hole) return -1 (outside polygon)
+                return -interior_code;
+            }
+        }
+        return code;
+    }
+
+private :
+    ring_index m_exterior;
+    std::vector<ring_index> m_interiors;
+    detail::within::interval_slabs<calculation_type> m_interior_slabs;
+};
+
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct assign_polygons
+    : not_implemented<Tag>
+{};
+
+template <typename Ring>
+struct assign_polygons<Ring, ring_tag>
+{
+    template <typename Polygons>
+    static inline void apply(Ring const& ring, Polygons& polygons)
+    {
+        polygons.resize(1);
+        polygons.front().assign_exterior(ring);
+    }
+};
+
+template <typename Polygon>
+struct assign_polygons<Polygon, polygon_tag>
+{
+    template <typename Polygons>
+    static inline void apply(Polygon const& polygon, Polygons& polygons)
+    {
+        polygons.resize(1);
+        polygons.front().assign(polygon);
+    }
+};
+
+template <typename MultiPolygon>
+struct assign_polygons<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Polygons>
+    static inline void apply(MultiPolygon const& multi_polygon, Polygons& polygons)
+    {
+        polygons.resize(boost::size(multi_polygon));
+        std::size_t index = 0;
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi_polygon);
+             it != boost::end(multi_polygon);
+             ++it, ++index)
+        {
+            polygons[index].assign(*it);
+        }
+    }
+};
+
+
+// Intersects of a prepared geometry and another geometry
+template
+<
+    typename Geometry2,
+    typename Tag2 = typename tag_cast
+        <
+            typename tag<Geometry2>::type,
+            box_tag, pointlike_tag, linear_tag, areal_tag
+        >::type,
+    bool IsMulti = util::is_multi<Geometry2>::value
+>
+struct intersects
+{
+    // Linear or areal geometries
+    template <typename Prepared>
+    static inline bool apply(Prepared const& prepared, Geometry2 const& geometry2)
+    {
+        typedef typename Prepared::box_type box_type;
+        box_type box2;
+        geometry::envelope(geometry2, box2, prepared.strategy());
+        if (detail::disjoint::disjoint_box_box(prepared.envelope(), box2,
+                                               prepared.strategy()))
+        {
+            return false;
+        }
+
+        if (prepared.has_turns(geometry2))
+        {
+            return true;
+        }
+
+        // There are no intersections of segments, but one might be located
+        // inside the other
+        if (geometry::detail::any_range_of(geometry2, [&](auto const& range)
+            {
+                typename geometry::point_type<Geometry2>::type point;
+                return geometry::point_on_border(point, range)
+                    && prepared.relate_point(point) >= 0;
+            }))
+        {
+            return true;
+        }
+
+        return std::is_same<Tag2, areal_tag>::value
+            && detail::disjoint::rings_containing(geometry2, prepared.geometry(),
+                                                  prepared.strategy());
+    }
+};
+
+template <typename Box>
+struct intersects<Box, box_tag, false>
+{
+    template <typename Prepared>
+    static inline bool apply(Prepared const& prepared, Box const& box)
+    {
+        typedef typename Prepared::geometry_type geometry_type;
+        typedef typename closeable_view
+            <
+                typename range_type<geometry_type>::type const,
+                closure<geometry_type>::value
+            >::type cview_type;
+        typedef typename reversible_view
+            <
+                cview_type const,
+                Prepared::reverse ? iterate_reverse : iterate_forward
+            >::type view_type;
+        typedef typename boost::range_iterator<view_type const>::type iterator;
+        typedef typename geometry::point_type<geometry_type>::type point_type;
+
+        if (detail::disjoint::disjoint_box_box(prepared.envelope(), box,
+                                               prepared.strategy()))
+        {
+            return false;
+        }
+
+        // Check the segments of the sections overlapping the box
+        for (auto const& section : prepared.sections())
+        {
+            if (detail::disjoint::disjoint_box_box(section.bounding_box, box,
+                                                   prepared.strategy()))
+            {
+                continue;
+            }
+
+            cview_type cview(range_by_section(prepared.geometry(), section));
+            view_type view(cview);
+            iterator it = boost::begin(view) + section.begin_index;
+            iterator const end = boost::begin(view) + section.end_index;
+            for (iterator prev = it++; prev != end; prev = it++)
+            {
+                model::referring_segment<point_type const> segment(*prev, *it);
+                if (! detail::disjoint::disjoint_segment_box::apply(segment, box,
+                                                prepared.strategy()))
+                {
+                    return true;
+                }
+            }
+        }
+
+        // The box might be located inside the prepared geometry or vice versa
+        point_type corner;
+        return (geometry::point_on_border(corner, box)
+                && prepared.relate_point(corner) >= 0)
+            || detail::disjoint::rings_containing(box, prepared.geometry(),
+                                                  prepared.strategy());
+    }
+};
+
+template <typename Point>
+struct intersects<Point, pointlike_tag, false>
+{
+    template <typename Prepared>
+    static inline bool apply(Prepared const& prepared, Point const& point)
+    {
+        return prepared.relate_point(point) >= 0;
+    }
+};
+
+template <typename MultiPoint>
+struct intersects<MultiPoint, pointlike_tag, true>
+{
+    template <typename Prepared>
+    static inline bool apply(Prepared const& prepared, MultiPoint const& multi_point)
+    {
+        for (typename boost::range_iterator<MultiPoint const>::type
+                it = boost::begin(multi_point);
+             it != boost::end(multi_point);
+             ++it)
+        {
+            if (prepared.relate_point(*it) >= 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+
+// Within and covered by, a prepared geometry
+template
+<
+    typename Geometry1,
+    typename Tag1 = typename tag_cast
+        <
+            typename tag<Geometry1>::type, pointlike_tag
+        >::type,
+    bool IsMulti = util::is_multi<Geometry1>::value
+>
+struct within
+{
+    template <typename Prepared>
+    static inline bool apply(Geometry1 const& geometry1, Prepared const& prepared,
+                             bool covered)
+    {
+        typedef typename Prepared::box_type box_type;
+        box_type box1;
+        geometry::envelope(geometry1, box1, prepared.strategy());
+        if (! geometry::covered_by(box1, prepared.envelope(), prepared.strategy()))
+        {
+            return false;
+        }
+
+        return covered
+            ? geometry::covered_by(geometry1, prepared.geometry(), prepared.strategy())
+            : geometry::within(geometry1, prepared.geometry(), prepared.strategy());
+    }
+};
+
+template <typename Point>
+struct within<Point, pointlike_tag, false>
+{
+    template <typename Prepared>
+    static inline bool apply(Point const& point, Prepared const& prepared,
+                             bool covered)
+    {
+        int const code = prepared.relate_point(point);
+        return covered ? code >= 0 : code > 0;
+    }
+};
+
+template <typename MultiPoint>
+struct within<MultiPoint, pointlike_tag, true>
+{
+    template <typename Prepared>
+    static inline bool apply(MultiPoint const& multi_point, Prepared const& prepared,
+                             bool covered)
+    {
+        // All points should be covered, for within at least one of them
+        // should be located in the interior
+        bool found_interior = false;
+        for (typename boost::range_iterator<MultiPoint const>::type
+                it = boost::begin(multi_point);
+             it != boost::end(multi_point);
+             ++it)
+        {
+            int const code = prepared.relate_point(*it);
+            if (code < 0)
+            {
+                return false;
+            }
+            if (code > 0)
+            {
+                found_interior = true;
+            }
+        }
+        return covered ? ! boost::empty(multi_point) : found_interior;
+    }
+};
+
+
+}} // namespace detail::prepared
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Areal geometry prepared for repeated predicates
+\details Calculates the envelope, monotonic sections and an index of the
+    segments of all rings of an areal geometry once. Point in geometry
+    queries visit only the segments of a slab containing the point.
+    Intersects tests reuse the sections of the prepared geometry, only the
+    other geometry is sectionalized per call.
+\tparam Geometry \tparam_geometry (ring, polygon or multi_polygon)
+\tparam Strategy relate strategy (cartesian)
+\note The geometry is referred to and should not be modified or destroyed
+    as long as the prepared geometry is used.
+\note Point in geometry results are identical to the results of the
+    cartesian winding strategy.
+*/
+template
+<
+    typename Geometry,
+    typename Strategy = typename strategies::relate::services::default_strategy
+        <
+            Geometry, Geometry
+        >::type
+>
+class prepared_geometry
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (util::is_polygonal<Geometry>::value),
+        "Only rings, polygons and multi polygons can be prepared.",
+        Geometry);
+
+public :
+    typedef Geometry geometry_type;
+    typedef Strategy strategy_type;
+    typedef typename geometry::point_type<Geometry>::type point_type;
+    typedef model::box<point_type> box_type;
+    typedef geometry::sections<box_type, 2> sections_type;
+
+    static const bool reverse
+        = detail::overlay::do_reverse<geometry::point_order<Geometry>::value>::value;
+
+    explicit prepared_geometry(Geometry const& geometry,
+                               Strategy const& strategy = Strategy())
+        : m_geometry(geometry)
+        , m_strategy(strategy)
+    {
+        concepts::check<Geometry const>();
+
+        geometry::envelope(m_geometry, m_envelope, m_strategy);
+
+        detail::prepared::assign_polygons<Geometry>::apply(m_geometry, m_polygons);
+
+        std::vector<std::pair<calculation_type, calculation_type> > intervals;
+        intervals.reserve(m_polygons.size());
+        for (std::size_t i = 0; i < m_polygons.size(); i++)
+        {
+            intervals.push_back(m_polygons[i].exterior().x_range());
+        }
+        m_polygon_slabs.assign(intervals, m_polygons.size());
+
+        typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
+        geometry::sectionalize<reverse, dimensions>(m_geometry,
+                detail::no_rescale_policy(), m_sections, m_strategy, 0);
+    }
+
+    inline Geometry const& geometry() const { return m_geometry; }
+    inline Strategy const& strategy() const { return m_strategy; }
+    inline box_type const& envelope() const { return m_envelope; }
+    inline sections_type const& sections() const { return m_sections; }
+
+    /*!
+    \brief Returns 1 if the point is in the interior, 0 if it is on the
+        boundary and -1 if it is in the exterior of the prepared geometry
+    */
+    template <typename Point>
+    inline int relate_point(Point const& point) const
+    {
+        auto const winding = m_strategy.relate(point, m_geometry);
+
+        typename detail::within::interval_slabs
+            <
+                calculation_type
+            >::candidates_type const candidates
+                = m_polygon_slabs.candidates(geometry::get<0>(point));
+
+        for (std::size_t const* it = candidates.first; it != candidates.second; ++it)
+        {
+            int const code = m_polygons[*it].apply(point, winding);
+            if (code >= 0)
+            {
+                return code;
+            }
+        }
+        return -1;
+    }
+
+    /*!
+    \brief Returns true if any segment of the other geometry intersects
+        or touches a segment of the prepared geometry
+    */
+    template <typename Geometry2>
+    inline bool has_turns(Geometry2 const& geometry2) const
+    {
+        typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
+
+        static const bool reverse2 = detail::overlay::do_reverse
+            <
+                geometry::point_order<Geometry2>::value
+            >::value;
+
+        sections_type sections2;
+        geometry::sectionalize<reverse2, dimensions>(geometry2,
+                detail::no_rescale_policy(), sections2, m_strategy, 1);
+
+        detail::disjoint::disjoint_interrupt_policy interrupt_policy;
+
+        // The linear geometry is passed first, to get linear/areal turns
+        if (util::is_linear<Geometry2>::value)
+        {
+            visit_sections<reverse2, reverse>(geometry2, sections2,
+                                              m_geometry, m_sections,
+                                              interrupt_policy);
+        }
+        else
+        {
+            visit_sections<reverse, reverse2>(m_geometry, m_sections,
+                                              geometry2, sections2,
+                                              interrupt_policy);
+        }
+        return interrupt_policy.has_intersections;
+    }
+
+private :
+    typedef detail::within::edge_index<point_type> ring_index;
+    typedef typename ring_index::calculation_type calculation_type;
+
+    template
+    <
+        bool Reverse1, bool Reverse2,
+        typename Geometry1, typename Geometry2, typename InterruptPolicy
+    >
+    inline void visit_sections(Geometry1 const& geometry1,
+                               sections_type const& sections1,
+                               Geometry2 const& geometry2,
+                               sections_type const& sections2,
+                               InterruptPolicy& interrupt_policy) const
+    {
+        typedef segment_ratio<typename coordinate_type<point_type>::type> ratio_type;
+        typedef detail::overlay::turn_info
+            <
+                point_type,
+                ratio_type,
+                typename detail::get_turns::turn_operation_type
+                    <
+                        Geometry1, Geometry2, ratio_type
+                    >::type
+            > turn_info_type;
+
+        std::deque<turn_info_type> turns;
+
+        detail::get_turns::section_visitor
+            <
+                Geometry1, Geometry2,
+                Reverse1, Reverse2,
+                detail::get_turns::get_turn_info_type
+                    <
+                        Geometry1, Geometry2,
+                        detail::disjoint::assign_disjoint_policy
+                    >,
+                Strategy, detail::no_rescale_policy,
+                std::deque<turn_info_type>, InterruptPolicy
+            > visitor(0, geometry1, 1, geometry2, m_strategy,
+                      detail::no_rescale_policy(), turns, interrupt_policy);
+
+        geometry::partition
+            <
+                box_type
+            >::apply(sections1, sections2, visitor,
+                     detail::section::get_section_box<Strategy>(m_strategy),
+                     detail::section::overlaps_section_box<Strategy>(m_strategy));
+    }
+
+    Geometry const& m_geometry;
+    Strategy m_strategy;
+    box_type m_envelope;
+    sections_type m_sections;
+    std::vector<detail::prepared::polygon_index<point_type> > m_polygons;
+    detail::within::interval_slabs<calculation_type> m_polygon_slabs;
+};
+
+
+/*!
+\brief Checks if a geometry is completely inside a prepared geometry
+\ingroup within
+\note Points and multi points are checked using the index of the prepared
+    geometry, other geometries are checked against the original geometry
+    after comparing envelopes.
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline bool within(Geometry1 const& geometry1,
+                   prepared_geometry<Geometry2, Strategy> const& prepared)
+{
+    return detail::prepared::within<Geometry1>::apply(geometry1, prepared, false);
+}
+
+/*!
+\brief Checks if a geometry is inside or on the border of a prepared geometry
+\ingroup covered_by
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline bool covered_by(Geometry1 const& geometry1,
+                       prepared_geometry<Geometry2, Strategy> const& prepared)
+{
+    return detail::prepared::within<Geometry1>::apply(geometry1, prepared, true);
+}
+
+/*!
+\brief Checks if a geometry has at least one point in common with
+    a prepared geometry
+\ingroup intersects
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline bool intersects(Geometry1 const& geometry1,
+                       prepared_geometry<Geometry2, Strategy> const& prepared)
+{
+    return detail::prepared::intersects<Geometry1>::apply(prepared, geometry1);
+}
+
+/*!
+\brief Checks if a geometry has no point in common with a prepared geometry
+\ingroup disjoint
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline bool disjoint(Geometry1 const& geometry1,
+                     prepared_geometry<Geometry2, Strategy> const& prepared)
+{
+    return ! detail::prepared::intersects<Geometry1>::apply(prepared, geometry1);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_PREPARED_GEOMETRY_HPP
@@ -0,0 +1,111 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_RELATE_PARALLEL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_RELATE_PARALLEL_HPP
+
+
+#include <cstddef>
+
+#include <boost/geometry/algorithms/detail/relate/areal_areal_parallel.hpp>
+#include <boost/geometry/algorithms/detail/relate/de9im.hpp>
+#include <boost/geometry/algorithms/relate.hpp>
+#include <boost/geometry/algorithms/relation.hpp>
+
+#include <boost/geometry/core/coordinate_dimension.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Checks relation between a pair of geometries defined by a mask,
+    using multiple threads.
+\ingroup relate
+\details For two polygonal geometries the turns are found, and the
+    components without turns are checked, in multiple threads. All threads
+    stop as soon as the mask is known not to match. Other geometries are
+    related as by relate.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Mask An intersection model Mask type.
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param mask An intersection model mask object.
+\param thread_count maximal number of threads to use, 0 means the number
+    of hardware threads
+\return true if the relation is compatible with the mask, false otherwise.
+ */
+template <typename Geometry1, typename Geometry2, typename Mask>
+inline bool relate_parallel(Geometry1 const& geometry1,
+                            Geometry2 const& geometry2,
+                            Mask const& mask,
+                            std::size_t thread_count = 0)
+{
+    concepts::check<Geometry1 const>();
+    concepts::check<Geometry2 const>();
+    assert_dimension_equal<Geometry1, Geometry2>();
+
+    typename detail::relate::result_handler_type
+        <
+            Geometry1,
+            Geometry2,
+            Mask
+        >::type handler(mask);
+
+    detail::relate::relate_in_parallel
+        <
+            Geometry1, Geometry2
+        >::apply(geometry1, geometry2, handler, thread_count);
+
+    return handler.result();
+}
+
+/*!
+\brief Calculates the relation between a pair of geometries as defined
+    in DE-9IM, using multiple threads.
+\ingroup relation
+\details See relate_parallel.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param thread_count maximal number of threads to use, 0 means the number
+    of hardware threads
+\return The DE-9IM matrix expressing the relation between geometries.
+ */
+template <typename Geometry1, typename Geometry2>
+inline de9im::matrix relation_parallel(Geometry1 const& geometry1,
+                                       Geometry2 const& geometry2,
+                                       std::size_t thread_count = 0)
+{
+    concepts::check<Geometry1 const>();
+    concepts::check<Geometry2 const>();
+    assert_dimension_equal<Geometry1, Geometry2>();
+
+    typename detail::relate::result_handler_type
+        <
+            Geometry1,
+            Geometry2,
+            de9im::matrix
+        >::type handler;
+
+    detail::relate::relate_in_parallel
+        <
+            Geometry1, Geometry2
+        >::apply(geometry1, geometry2, handler, thread_count);
+
+    return handler.result();
+}
+
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_RELATE_PARALLEL_HPP
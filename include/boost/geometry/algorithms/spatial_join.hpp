@@ -0,0 +1,283 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_SPATIAL_JOIN_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_SPATIAL_JOIN_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/strategies/relate/services.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace spatial_join
+{
+
+// Envelope of a geometry of one of the ranges, with its index in that range
+template <typename Box>
+struct item
+{
+    Box box;
+    std::size_t index;
+};
+
+template <typename Strategy>
+struct expand_item
+{
+    expand_item(Strategy const& strategy)
+        : m_strategy(strategy)
+    {}
+
+    template <typename Box, typename Item>
+    inline void apply(Box& total, Item const& item) const
+    {
+        geometry::expand(total, item.box, m_strategy);
+    }
+
+    Strategy const& m_strategy;
+};
+
+template <typename Strategy>
+struct overlaps_item
+{
+    overlaps_item(Strategy const& strategy)
+        : m_strategy(strategy)
+    {}
+
+    template <typename Box, typename Item>
+    inline bool apply(Box const& box, Item const& item) const
+    {
+        return ! detail::disjoint::disjoint_box_box(box, item.box, m_strategy);
+    }
+
+    Strategy const& m_strategy;
+};
+
+// Collects the pairs of indexes of geometries of which the envelopes overlap
+template <typename Strategy>
+struct candidate_visitor
+{
+    std::vector<std::pair<std::size_t, std::size_t> >& m_candidates;
+    Strategy const& m_strategy;
+
+    candidate_visitor(std::vector<std::pair<std::size_t, std::size_t> >& candidates,
+                      Strategy const& strategy)
+        : m_candidates(candidates)
+        , m_strategy(strategy)
+    {}
+
+    template <typename Item1, typename Item2>
+    inline bool apply(Item1 const& item1, Item2 const& item2)
+    {
+        if (! detail::disjoint::disjoint_box_box(item1.box, item2.box, m_strategy))
+        {
+            m_candidates.push_back(std::make_pair(item1.index, item2.index));
+        }
+        return true;
+    }
+};
+
+template <typename Range, typename Item, typename Strategy>
+inline void fill_items(Range const& range, std::vector<Item>& items,
+                       Strategy const& strategy)
+{
+    items.reserve(boost::size(range));
+    for (std::size_t i = 0; i < boost::size(range); i++)
+    {
+        // Empty geometries have no envelope, and are never joined
+        if (geometry::is_empty(range::at(range, i)))
+        {
+            continue;
+        }
+        Item item;
+        item.index = i;
+        geometry::envelope(range::at(range, i), item.box, strategy);
+        items.push_back(item);
+    }
+}
+
+template
+<
+    typename Range1, typename Range2, typename Predicate,
+    typename OutputIterator, typename Strategy
+>
+inline OutputIterator apply(Range1 const& range1, Range2 const& range2,
+                            Predicate const& predicate, OutputIterator out,
+                            Strategy const& strategy, std::size_t thread_count)
+{
+    typedef typename boost::range_value<Range1>::type geometry1_type;
+    typedef model::box<typename point_type<geometry1_type>::type> box_type;
+    typedef item<box_type> item_type;
+    typedef std::pair<std::size_t, std::size_t> pair_type;
+
+    std::vector<item_type> items1, items2;
+    fill_items(range1, items1, strategy);
+    fill_items(range2, items2, strategy);
+
+    std::vector<pair_type> candidates;
+    candidate_visitor<Strategy> visitor(candidates, strategy);
+    geometry::partition
+        <
+            box_type
+        >::apply(items1, items2, visitor,
+                 expand_item<Strategy>(strategy),
+                 overlaps_item<Strategy>(strategy),
+                 expand_item<Strategy>(strategy),
+                 overlaps_item<Strategy>(strategy));
+
+    std::sort(candidates.begin(), candidates.end());
+
+    // One char per candidate, std::vector<bool> can not be written by
+    // multiple threads
+    std::vector<char> joined(candidates.size(), 0);
+
+    // Candidates are refined in blocks, handed out to the threads one by one
+    std::size_t const refine_block_size = 64;
+    std::size_t const block_count
+        = (candidates.size() + refine_block_size - 1) / refine_block_size;
+
+    detail::parallel_for(block_count,
+        detail::parallel_thread_count(thread_count),
+        [&](std::size_t block)
+        {
+            std::size_t const end = (std::min)(candidates.size(),
+                                               (block + 1) * refine_block_size);
+            for (std::size_t i = block * refine_block_size; i < end; i++)
+            {
+                joined[i] = predicate(range::at(range1, candidates[i].first),
+                                      range::at(range2, candidates[i].second))
+                          ? 1 : 0;
+            }
+        });
+
+    for (std::size_t i = 0; i < candidates.size(); i++)
+    {
+        if (joined[i])
+        {
+            *out++ = candidates[i];
+        }
+    }
+    return out;
+}
+
+}} // namespace detail::spatial_join
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Joins two ranges of geometries on a spatial predicate
+\ingroup spatial_join
+\details Writes the pairs of indexes (i, j) for which the predicate is true
+    for the geometry i of the first range and the geometry j of the second
+    range. The envelopes of both ranges are partitioned, and the predicate
+    is only called for the pairs of which the envelopes intersect. Therefore
+    the predicate should only be true for geometries which are not disjoint,
+    as for intersects, within, covered_by, contains, overlaps, touches,
+    crosses, equals and masks requiring an intersection.
+    Empty geometries are never joined.
+    The pairs are written in ascending order, for any number of threads.
+\tparam Range1 Range of geometries
+\tparam Range2 Range of geometries
+\tparam Predicate Function object taking a geometry of both ranges,
+    returning bool. If multiple threads are used, it is called concurrently.
+\tparam OutputIterator Output iterator to which a std::pair of std::size_t
+    is written for each joined pair
+\tparam Strategy \tparam_strategy{Relate}, used for the envelopes
+\param range1 First range of geometries
+\param range2 Second range of geometries
+\param predicate The predicate
+\param out The output iterator
+\param strategy \param_strategy{relate}, used for the envelopes
+\param thread_count maximal number of threads calling the predicate,
+    0 means the number of hardware threads
+\return The output iterator
+ */
+template
+<
+    typename Range1, typename Range2, typename Predicate,
+    typename OutputIterator, typename Strategy
+>
+inline OutputIterator spatial_join(Range1 const& range1, Range2 const& range2,
+                                   Predicate const& predicate, OutputIterator out,
+                                   Strategy const& strategy,
+                                   std::size_t thread_count)
+{
+    concepts::check<typename boost::range_value<Range1>::type const>();
+    concepts::check<typename boost::range_value<Range2>::type const>();
+
+    return detail::spatial_join::apply(range1, range2, predicate, out,
+                                       strategy, thread_count);
+}
+
+/*!
+\brief Joins two ranges of geometries on a spatial predicate
+\ingroup spatial_join
+\details Writes the pairs of indexes (i, j) for which the predicate is true
+    for the geometry i of the first range and the geometry j of the second
+    range. The predicate is only called for the pairs of which the envelopes
+    intersect, so it should only be true for geometries which are not
+    disjoint. The pairs are written in ascending order.
+\tparam Range1 Range of geometries
+\tparam Range2 Range of geometries
+\tparam Predicate Function object taking a geometry of both ranges,
+    returning bool. If multiple threads are used, it is called concurrently.
+\tparam OutputIterator Output iterator to which a std::pair of std::size_t
+    is written for each joined pair
+\param range1 First range of geometries
+\param range2 Second range of geometries
+\param predicate The predicate
+\param out The output iterator
+\param thread_count maximal number of threads calling the predicate,
+    0 means the number of hardware threads
+\return The output iterator
+ */
+template
+<
+    typename Range1, typename Range2, typename Predicate,
+    typename OutputIterator
+>
+inline OutputIterator spatial_join(Range1 const& range1, Range2 const& range2,
+                                   Predicate const& predicate, OutputIterator out,
+                                   std::size_t thread_count = 1)
+{
+    typedef typename strategies::relate::services::default_strategy
+        <
+            typename boost::range_value<Range1>::type,
+            typename boost::range_value<Range2>::type
+        >::type strategy_type;
+
+    return spatial_join(range1, range2, predicate, out, strategy_type(),
+                        thread_count);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_SPATIAL_JOIN_HPP
@@ -0,0 +1,262 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_WITHIN_POINTS_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_WITHIN_POINTS_HPP
+
+
+#include <type_traits>
+#include <vector>
+
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/within/point_in_geometry_batch.hpp>
+
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/detail.hpp>
+#include <boost/geometry/strategies/relate/services.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace within
+{
+
+template <bool Within, typename Points, typename Geometry,
+          typename OutputIterator, typename Strategy>
+inline OutputIterator points_in_geometry(Points const& points,
+                                         Geometry const& geometry,
+                                         OutputIterator out,
+                                         Strategy const& strategy)
+{
+    std::vector<int> codes;
+    point_in_geometry_batch(points, geometry, codes, strategy);
+    for (std::vector<int>::const_iterator it = codes.begin(); it != codes.end(); ++it)
+    {
+        *out++ = Within ? *it > 0 : *it >= 0;
+    }
+    return out;
+}
+
+}} // namespace detail::within
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace resolve_strategy
+{
+
+template
+<
+    typename Strategy,
+    bool IsUmbrella = strategies::detail::is_umbrella_strategy<Strategy>::value
+>
+struct points_in_geometry
+{
+    template <bool Within, typename Points, typename Geometry, typename OutputIterator>
+    static inline OutputIterator apply(Points const& points,
+                                       Geometry const& geometry,
+                                       OutputIterator out,
+                                       Strategy const& strategy)
+    {
+        return detail::within::points_in_geometry<Within>(points, geometry,
+                                                          out, strategy);
+    }
+};
+
+template <typename Strategy>
+struct points_in_geometry<Strategy, false>
+{
+    template <bool Within, typename Points, typename Geometry, typename OutputIterator>
+    static inline OutputIterator apply(Points const& points,
+                                       Geometry const& geometry,
+                                       OutputIterator out,
+                                       Strategy const& strategy)
+    {
+        using strategies::relate::services::strategy_converter;
+
+        return points_in_geometry
+            <
+                decltype(strategy_converter<Strategy>::get(strategy))
+            >::template apply<Within>(points, geometry, out,
+                                      strategy_converter<Strategy>::get(strategy));
+    }
+};
+
+template <>
+struct points_in_geometry<default_strategy, false>
+{
+    template <bool Within, typename Points, typename Geometry, typename OutputIterator>
+    static inline OutputIterator apply(Points const& points,
+                                       Geometry const& geometry,
+                                       OutputIterator out,
+                                       default_strategy)
+    {
+        typedef typename strategies::relate::services::default_strategy
+            <
+                typename boost::range_value<Points>::type,
+                Geometry
+            >::type strategy_type;
+
+        return points_in_geometry
+            <
+                strategy_type
+            >::template apply<Within>(points, geometry, out, strategy_type());
+    }
+};
+
+} // namespace resolve_strategy
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace within
+{
+
+template <typename Points, typename Geometry>
+inline void check_points_in_geometry()
+{
+    typedef typename boost::range_value<Points>::type point_type;
+
+    concepts::check<point_type const>();
+    concepts::check<Geometry const>();
+    assert_dimension_equal<point_type, Geometry>();
+
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (std::is_same<typename tag<point_type>::type, point_tag>::value),
+        "Points should be a range of points.",
+        Points);
+}
+
+}} // namespace detail::within
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Checks for each point of a range if it is completely inside a geometry
+\ingroup within
+\details The results are the same as calling within for each point,
+    but the geometry is processed once for all points. For areal
+    geometries in a cartesian coordinate system the points are sorted
+    and each segment is visited once, instead of once per point.
+\tparam Points Range of points
+\tparam Geometry \tparam_geometry
+\tparam OutputIterator Output iterator to which a bool is written for each point
+\tparam Strategy \tparam_strategy{Within}
+\param points Range of points
+\param geometry \param_geometry which might contain the points
+\param out The output iterator, one bool is written per point, in order
+\param strategy \param_strategy{within}
+\return The output iterator
+ */
+template
+<
+    typename Points, typename Geometry,
+    typename OutputIterator, typename Strategy
+>
+inline OutputIterator within_points(Points const& points,
+                                    Geometry const& geometry,
+                                    OutputIterator out,
+                                    Strategy const& strategy)
+{
+    detail::within::check_points_in_geometry<Points, Geometry>();
+
+    return resolve_strategy::points_in_geometry
+        <
+            Strategy
+        >::template apply<true>(points, geometry, out, strategy);
+}
+
+/*!
+\brief Checks for each point of a range if it is completely inside a geometry
+\ingroup within
+\details The results are the same as calling within for each point,
+    but the geometry is processed once for all points.
+\tparam Points Range of points
+\tparam Geometry \tparam_geometry
+\tparam OutputIterator Output iterator to which a bool is written for each point
+\param points Range of points
+\param geometry \param_geometry which might contain the points
+\param out The output iterator, one bool is written per point, in order
+\return The output iterator
+ */
+template <typename Points, typename Geometry, typename OutputIterator>
+inline OutputIterator within_points(Points const& points,
+                                    Geometry const& geometry,
+                                    OutputIterator out)
+{
+    return within_points(points, geometry, out, default_strategy());
+}
+
+/*!
+\brief Checks for each point of a range if it is inside or on the border
+    of a geometry
+\ingroup covered_by
+\details The results are the same as calling covered_by for each point,
+    but the geometry is processed once for all points. For areal
+    geometries in a cartesian coordinate system the points are sorted
+    and each segment is visited once, instead of once per point.
+\tparam Points Range of points
+\tparam Geometry \tparam_geometry
+\tparam OutputIterator Output iterator to which a bool is written for each point
+\tparam Strategy \tparam_strategy{Covered_by}
+\param points Range of points
+\param geometry \param_geometry which might cover the points
+\param out The output iterator, one bool is written per point, in order
+\param strategy \param_strategy{covered_by}
+\return The output iterator
+ */
+template
+<
+    typename Points, typename Geometry,
+    typename OutputIterator, typename Strategy
+>
+inline OutputIterator covered_by_points(Points const& points,
+                                        Geometry const& geometry,
+                                        OutputIterator out,
+                                        Strategy const& strategy)
+{
+    detail::within::check_points_in_geometry<Points, Geometry>();
+
+    return resolve_strategy::points_in_geometry
+        <
+            Strategy
+        >::template apply<false>(points, geometry, out, strategy);
+}
+
+/*!
+\brief Checks for each point of a range if it is inside or on the border
+    of a geometry
+\ingroup covered_by
+\details The results are the same as calling covered_by for each point,
+    but the geometry is processed once for all points.
+\tparam Points Range of points
+\tparam Geometry \tparam_geometry
+\tparam OutputIterator Output iterator to which a bool is written for each point
+\param points Range of points
+\param geometry \param_geometry which might cover the points
+\param out The output iterator, one bool is written per point, in order
+\return The output iterator
+ */
+template <typename Points, typename Geometry, typename OutputIterator>
+inline OutputIterator covered_by_points(Points const& points,
+                                        Geometry const& geometry,
+                                        OutputIterator out)
+{
+    return covered_by_points(points, geometry, out, default_strategy());
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_WITHIN_POINTS_HPP
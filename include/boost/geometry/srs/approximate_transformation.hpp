@@ -0,0 +1,457 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_APPROXIMATE_TRANSFORMATION_HPP
+#define BOOST_GEOMETRY_SRS_APPROXIMATE_TRANSFORMATION_HPP
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/srs/projections/impl/parallel_ranges.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace projections
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Leaf cell of the mesh of approximate_transformation
+template <typename CT>
+struct approximation_cell
+{
+    approximation_cell()
+        : exact(true)
+    {}
+
+    // The points of the cell are transformed exactly
+    bool exact;
+    // Coefficients of the bilinear interpolation
+    // c[0] + c[1] * u + c[2] * v + c[3] * u * v
+    CT x[4];
+    CT y[4];
+};
+
+// Exactly transformed control point of the mesh
+template <typename CT>
+struct approximation_control_point
+{
+    CT x;
+    CT y;
+    bool valid;
+};
+
+template <typename Approximation>
+struct approximate_range_visitor
+{
+    explicit approximate_range_visitor(Approximation const& approximation)
+        : m_approximation(approximation)
+        , result(true)
+    {}
+
+    template <typename RangeIn, typename RangeOut>
+    inline void apply(RangeIn const& in, RangeOut & out)
+    {
+        if (boost::size(out) != boost::size(in))
+        {
+            range::resize(out, boost::size(in));
+        }
+
+        auto it_out = boost::begin(out);
+        for (auto it = boost::begin(in); it != boost::end(in); ++it, ++it_out)
+        {
+            if (! m_approximation.forward(*it, *it_out))
+            {
+                result = false;
+            }
+        }
+    }
+
+private:
+    Approximation const& m_approximation;
+
+public:
+    bool result;
+};
+
+template
+<
+    typename Geometry,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct approximate_transform
+{
+    template <typename Approximation, typename GeometryIn, typename GeometryOut>
+    static inline bool apply(Approximation const& approximation,
+                             GeometryIn const& in, GeometryOut & out)
+    {
+        approximate_range_visitor<Approximation> visitor(approximation);
+        visit_range_pairs<Geometry>::apply(in, out, visitor);
+        return visitor.result;
+    }
+};
+
+template <typename Point>
+struct approximate_transform<Point, point_tag>
+{
+    template <typename Approximation, typename PointIn, typename PointOut>
+    static inline bool apply(Approximation const& approximation,
+                             PointIn const& in, PointOut & out)
+    {
+        return approximation.forward(in, out);
+    }
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+} // namespace projections
+
+
+namespace srs
+{
+
+
+/*!
+    \brief Transformation approximated by interpolation in an adaptive mesh
+    \details The exact transformation is calculated at the control points
+        of a mesh covering the extent of the source coordinates. Each cell
+        is divided into four until the bilinear interpolation of its
+        corners differs from the exact transformation of the middles of
+        its edges and of its centre by at most max_error, in the units of
+        the target coordinates. The points inside the extent are then
+        transformed by interpolation in their cell. The points outside the
+        extent, in cells containing control points which can not be
+        transformed and in cells too large at max_depth are transformed
+        exactly. Grids are not used. The inverse transformation can be
+        approximated by a transformation constructed with swapped
+        coordinate systems.
+    \ingroup projection
+    \tparam PointIn 2D source point type, also defining the units of the extent
+    \tparam PointOut 2D target point type
+    \tparam Proj1 default_dynamic or static projection parameters
+    \tparam Proj2 default_dynamic or static projection parameters
+    \tparam CT calculation type used internally
+*/
+template
+<
+    typename PointIn,
+    typename PointOut,
+    typename Proj1 = srs::dynamic,
+    typename Proj2 = srs::dynamic,
+    typename CT = double
+>
+class approximate_transformation
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (geometry::dimension<PointIn>::value == 2
+      && geometry::dimension<PointOut>::value == 2),
+        "Only 2D points are supported.",
+        PointIn, PointOut);
+
+    typedef typename projections::detail::promote_to_double<CT>::type calc_t;
+    typedef projections::detail::approximation_cell<calc_t> cell_type;
+    typedef projections::detail::approximation_control_point<calc_t> control_point;
+
+    // The control points sample the extent at least with this depth
+    static const std::size_t min_depth = 2;
+    // The indexes of the smallest cells of a row have to fit in size_t
+    static const std::size_t max_supported_depth = 24;
+
+public:
+    typedef srs::transformation<Proj1, Proj2, CT> transformation_type;
+
+    template <typename Box>
+    approximate_transformation(transformation_type const& tr,
+                               Box const& extent,
+                               calc_t const& max_error,
+                               std::size_t max_depth = 10)
+        : m_transformation(tr)
+        , m_min_x(geometry::get<min_corner, 0>(extent))
+        , m_min_y(geometry::get<min_corner, 1>(extent))
+        , m_max_x(geometry::get<max_corner, 0>(extent))
+        , m_max_y(geometry::get<max_corner, 1>(extent))
+        , m_max_error(max_error)
+        , m_max_depth((std::min)(max_depth, std::size_t(max_supported_depth)))
+        , m_leaf_count(0)
+    {
+        m_children.push_back(0);
+        m_cells.push_back(cell_type());
+
+        std::size_t const n = std::size_t(1) << m_max_depth;
+        m_scale_x = calc_t(n) / (m_max_x - m_min_x);
+        m_scale_y = calc_t(n) / (m_max_y - m_min_y);
+        for (std::size_t i = 0; i <= m_max_depth; i++)
+        {
+            m_inv_sizes.push_back(calc_t(1) / calc_t(std::size_t(1) << i));
+        }
+
+        if (! (m_min_x < m_max_x && m_min_y < m_max_y))
+        {
+            // Every point is transformed exactly
+            m_min_x = m_min_y = 1;
+            m_max_x = m_max_y = 0;
+            m_leaf_count = 1;
+            return;
+        }
+
+        control_point const corners[4] = {
+            transform(m_min_x, m_min_y), transform(m_max_x, m_min_y),
+            transform(m_min_x, m_max_y), transform(m_max_x, m_max_y) };
+
+        build(0, m_min_x, m_min_y, m_max_x, m_max_y, corners, 0);
+    }
+
+    //! Returns the number of leaf cells of the mesh
+    std::size_t size() const
+    {
+        return m_leaf_count;
+    }
+
+    bool forward(PointIn const& in, PointOut & out) const
+    {
+        calc_t x = geometry::get<0>(in);
+        calc_t y = geometry::get<1>(in);
+
+        // Also false for NaN
+        if (x >= m_min_x && x <= m_max_x && y >= m_min_y && y <= m_max_y)
+        {
+            // Position in the units of the smallest cells, the bits of
+            // the indexes select the children without branching
+            std::size_t const last = (std::size_t(1) << m_max_depth) - 1;
+            calc_t const fx = (x - m_min_x) * m_scale_x;
+            calc_t const fy = (y - m_min_y) * m_scale_y;
+            std::size_t const ix = (std::min)(std::size_t(fx), last);
+            std::size_t const iy = (std::min)(std::size_t(fy), last);
+
+            std::size_t index = 0;
+            std::size_t shift = m_max_depth;
+            while (m_children[index] != 0)
+            {
+                --shift;
+                index = m_children[index]
+                      + ((ix >> shift) & 1) + 2 * ((iy >> shift) & 1);
+            }
+
+            cell_type const& cell = m_cells[index];
+            if (! cell.exact)
+            {
+                // Position inside the cell
+                calc_t const u = (fx - calc_t(ix >> shift << shift)) * m_inv_sizes[shift];
+                calc_t const v = (fy - calc_t(iy >> shift << shift)) * m_inv_sizes[shift];
+                geometry::set<0>(out, interpolate(cell.x, u, v));
+                geometry::set<1>(out, interpolate(cell.y, u, v));
+                return true;
+            }
+        }
+
+        return m_transformation.forward(in, out);
+    }
+
+    template <typename GeometryIn, typename GeometryOut>
+    bool forward(GeometryIn const& in, GeometryOut & out) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+            "Not supported combination of Geometries.",
+            GeometryIn, GeometryOut);
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (std::is_same<typename geometry::point_type<GeometryIn>::type, PointIn>::value
+          && std::is_same<typename geometry::point_type<GeometryOut>::type, PointOut>::value),
+            "Geometries of other point types than the approximation.",
+            GeometryIn, GeometryOut);
+
+        return projections::detail::approximate_transform
+                <
+                    GeometryOut
+                >::apply(*this, in, out);
+    }
+
+private:
+    static inline calc_t interpolate(calc_t const (&c)[4], calc_t const& u, calc_t const& v)
+    {
+        return c[0] + c[1] * u + (c[2] + c[3] * u) * v;
+    }
+
+    // Coefficients of the bilinear interpolation of the corners
+    // (0, 0), (1, 0), (0, 1) and (1, 1)
+    static inline void coefficients(calc_t const (&corners)[4], calc_t (&c)[4])
+    {
+        c[0] = corners[0];
+        c[1] = corners[1] - corners[0];
+        c[2] = corners[2] - corners[0];
+        c[3] = corners[3] - corners[2] - corners[1] + corners[0];
+    }
+
+    control_point transform(calc_t const& x, calc_t const& y) const
+    {
+        PointIn in;
+        geometry::set<0>(in, x);
+        geometry::set<1>(in, y);
+        PointOut out;
+
+        control_point result;
+        result.valid = m_transformation.forward(in, out);
+        result.x = geometry::get<0>(out);
+        result.y = geometry::get<1>(out);
+        result.valid = result.valid
+                    && geometry::math::abs(result.x) < HUGE_VAL
+                    && geometry::math::abs(result.y) < HUGE_VAL;
+        return result;
+    }
+
+    static inline calc_t deviation(control_point const (&corners)[4],
+                                   calc_t const& u, calc_t const& v,
+                                   control_point const& p)
+    {
+        calc_t x[4], y[4];
+        coefficients({ corners[0].x, corners[1].x, corners[2].x, corners[3].x }, x);
+        coefficients({ corners[0].y, corners[1].y, corners[2].y, corners[3].y }, y);
+        calc_t const dx = interpolate(x, u, v) - p.x;
+        calc_t const dy = interpolate(y, u, v) - p.y;
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+    void make_leaf(std::size_t index, control_point const (&corners)[4], bool exact)
+    {
+        cell_type & cell = m_cells[index];
+        cell.exact = exact;
+        coefficients({ corners[0].x, corners[1].x, corners[2].x, corners[3].x }, cell.x);
+        coefficients({ corners[0].y, corners[1].y, corners[2].y, corners[3].y }, cell.y);
+        ++m_leaf_count;
+    }
+
+    void build(std::size_t index,
+               calc_t const& min_x, calc_t const& min_y,
+               calc_t const& max_x, calc_t const& max_y,
+               control_point const (&corners)[4],
+               std::size_t depth)
+    {
+        calc_t const mid_x = (min_x + max_x) / 2;
+        calc_t const mid_y = (min_y + max_y) / 2;
+
+        // The corners of the children which are not the corners of the cell
+        control_point const bottom = transform(mid_x, min_y);
+        control_point const left = transform(min_x, mid_y);
+        control_point const center = transform(mid_x, mid_y);
+        control_point const right = transform(max_x, mid_y);
+        control_point const top = transform(mid_x, max_y);
+
+        control_point const* const points[9] = {
+            &corners[0], &corners[1], &corners[2], &corners[3],
+            &bottom, &left, &center, &right, &top };
+        std::size_t valid_count = 0;
+        for (std::size_t i = 0; i < 9; i++)
+        {
+            if (points[i]->valid)
+            {
+                ++valid_count;
+            }
+        }
+
+        // Assume that the cell is outside of the domain of the transformation
+        if (valid_count == 0)
+        {
+            make_leaf(index, corners, true);
+            return;
+        }
+
+        if (valid_count == 9 && depth >= min_depth)
+        {
+            calc_t const error = (std::max)(
+                (std::max)(deviation(corners, 0.5, 0, bottom),
+                           deviation(corners, 0, 0.5, left)),
+                (std::max)(deviation(corners, 0.5, 0.5, center),
+                           (std::max)(deviation(corners, 1, 0.5, right),
+                                      deviation(corners, 0.5, 1, top))));
+            if (error <= m_max_error)
+            {
+                make_leaf(index, corners, false);
+                return;
+            }
+
+            // The error of bilinear interpolation decreases with the square
+            // of the size, don't divide if max_error can't be reached
+            if (depth < m_max_depth
+             && std::ldexp(error, -2 * int(m_max_depth - depth)) > m_max_error)
+            {
+                make_leaf(index, corners, true);
+                return;
+            }
+        }
+
+        if (depth >= m_max_depth)
+        {
+            make_leaf(index, corners, true);
+            return;
+        }
+
+        std::size_t const first = m_cells.size();
+        m_children[index] = static_cast<std::uint32_t>(first);
+        m_children.resize(first + 4, 0);
+        m_cells.resize(first + 4);
+
+        control_point const corners0[4] = { corners[0], bottom, left, center };
+        control_point const corners1[4] = { bottom, corners[1], center, right };
+        control_point const corners2[4] = { left, center, corners[2], top };
+        control_point const corners3[4] = { center, right, top, corners[3] };
+
+        build(first, min_x, min_y, mid_x, mid_y, corners0, depth + 1);
+        build(first + 1, mid_x, min_y, max_x, mid_y, corners1, depth + 1);
+        build(first + 2, min_x, mid_y, mid_x, max_y, corners2, depth + 1);
+        build(first + 3, mid_x, mid_y, max_x, max_y, corners3, depth + 1);
+    }
+
+    transformation_type m_transformation;
+    calc_t m_min_x;
+    calc_t m_min_y;
+    calc_t m_max_x;
+    calc_t m_max_y;
+    calc_t m_max_error;
+    std::size_t m_max_depth;
+    std::size_t m_leaf_count;
+    calc_t m_scale_x;
+    calc_t m_scale_y;
+    // 1 / 2^i for the cells at depth m_max_depth - i
+    std::vector<calc_t> m_inv_sizes;
+    // The index of the first child of each cell, 0 for leaves, stored
+    // separately so the cells are found without loading the leaves
+    std::vector<std::uint32_t> m_children;
+    // Indexed like m_children, only the leaves are used
+    std::vector<cell_type> m_cells;
+};
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_APPROXIMATE_TRANSFORMATION_HPP
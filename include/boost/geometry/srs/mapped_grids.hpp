@@ -0,0 +1,282 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_MAPPED_GRIDS_HPP
+#define BOOST_GEOMETRY_SRS_MAPPED_GRIDS_HPP
+
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_NO_CXX14_HDR_SHARED_MUTEX
+#error "C++14 <shared_mutex> header required."
+#endif
+
+#include <boost/geometry/srs/projections/grids.hpp>
+#include <boost/geometry/srs/projections/impl/mapped_file.hpp>
+#include <boost/geometry/srs/projections/impl/pj_apply_gridshift.hpp>
+#include <boost/geometry/srs/projections/impl/pj_gridinfo.hpp>
+#include <boost/geometry/srs/projections/impl/pj_gridlist.hpp>
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+/*!
+    \brief Grids stored in memory-mapped files
+    \details The grid files are opened by name and mapped read-only when
+        the grids are initialized. Only the headers are parsed then, the
+        shift values are decoded from the mapped files on demand, so the
+        grids are never loaded into the heap. The pages of a file are
+        shared by all grids and processes mapping the same file. The
+        stream policy of grids_storage is not used. Mapped grids can be
+        used by multiple threads, the files are unmapped at destruction.
+        The files are mapped with mmap() on POSIX systems and with
+        Boost.Interprocess on other systems, or on all systems if
+        BOOST_GEOMETRY_MAPPED_FILE_INTERPROCESS is defined.
+    \ingroup projection
+*/
+class mapped_grids
+{
+
+// VS 2015 Update 2
+#if defined(_MSC_FULL_VER) && (_MSC_FULL_VER >= 190023918)
+    typedef std::shared_mutex mutex_type;
+// Other C++17
+#elif !defined(BOOST_NO_CXX14_HDR_SHARED_MUTEX) && (__cplusplus > 201402L)
+    typedef std::shared_mutex mutex_type;
+#else
+    typedef std::shared_timed_mutex mutex_type;
+#endif
+
+public:
+    typedef projections::detail::mapped_file region_type;
+
+    std::size_t size() const
+    {
+        std::shared_lock<mutex_type> lock(mutex);
+        return gridinfo.size();
+    }
+
+    bool empty() const
+    {
+        std::shared_lock<mutex_type> lock(mutex);
+        return gridinfo.empty();
+    }
+
+    typedef projections::detail::mapped_grids_tag tag;
+
+    struct read_locked
+    {
+        read_locked(mapped_grids & g)
+            : gridinfo(g.gridinfo)
+            , lock(g.mutex)
+        {}
+
+        // should be const&
+        projections::detail::pj_gridinfo & gridinfo;
+
+    private:
+        std::shared_lock<mutex_type> lock;
+    };
+
+    struct write_locked
+    {
+        write_locked(mapped_grids & g)
+            : gridinfo(g.gridinfo)
+            , regions(g.regions)
+            , lock(g.mutex)
+        {}
+
+        projections::detail::pj_gridinfo & gridinfo;
+        std::vector<std::shared_ptr<region_type> > & regions;
+
+    private:
+        std::unique_lock<mutex_type> lock;
+    };
+
+private:
+    projections::detail::pj_gridinfo gridinfo;
+    // Mapped files referenced by gridinfo
+    std::vector<std::shared_ptr<region_type> > regions;
+    mutable mutex_type mutex;
+};
+
+
+} // namespace srs
+
+
+namespace projections { namespace detail
+{
+
+// Stream reading the headers of a grid from a mapped file
+class pj_mapped_stream
+    : public memory_istream
+{
+public:
+    pj_mapped_stream(char const* data, std::size_t size)
+        : memory_istream(data, size)
+    {}
+
+    bool is_open() const
+    {
+        return true;
+    }
+};
+
+// Map the whole file read-only, returns an empty pointer on failure
+inline std::shared_ptr<srs::mapped_grids::region_type>
+    pj_gridinfo_map(std::string const& gridname)
+{
+    std::shared_ptr<srs::mapped_grids::region_type> const
+        region = std::make_shared<srs::mapped_grids::region_type>(gridname);
+    return region->is_mapped()
+         ? region
+         : std::shared_ptr<srs::mapped_grids::region_type>();
+}
+
+// Generic stream policy and mapped grids
+template <typename StreamPolicy, typename MappedGrids>
+inline bool pj_gridlist_merge_gridfile(std::string const& gridname,
+                                       StreamPolicy const& ,
+                                       MappedGrids & grids,
+                                       std::vector<std::size_t> & gridindexes,
+                                       mapped_grids_tag)
+{
+    // Try to find in the existing list of mapped grids.  Add all
+    // matching grids as with NTv2 we can get many grids from one
+    // file (one shared gridname).
+    {
+        typename MappedGrids::read_locked lck_grids(grids);
+
+        if (pj_gridlist_find_all(gridname, lck_grids.gridinfo, gridindexes))
+            return true;
+    }
+
+    // Try to map the named grid.
+    std::shared_ptr<typename MappedGrids::region_type> const
+        region = pj_gridinfo_map(gridname);
+    if (! region)
+    {
+        return false;
+    }
+
+    char const* data = region->data();
+    std::size_t const size = region->size();
+
+    pj_mapped_stream is(data, size);
+    pj_gridinfo new_grids;
+
+    if (! pj_gridinfo_init(gridname, is, new_grids))
+    {
+        return false;
+    }
+
+    // Check the sizes once instead of the reads done by pj_gridinfo_load()
+    for (std::size_t i = 0 ; i < new_grids.size() ; ++i)
+    {
+        if (! pj_gridinfo_mapped_check(new_grids[i], size))
+        {
+            return false;
+        }
+        pj_gridinfo_mapped_assign(new_grids[i], data);
+    }
+
+    // Add the grid now that it is mapped.
+
+    std::size_t orig_size = 0;
+    std::size_t new_size = 0;
+
+    {
+        typename MappedGrids::write_locked lck_grids(grids);
+
+        // Try to find in the existing list of mapped grids again
+        // in case other thread already added it.
+        if (pj_gridlist_find_all(gridname, lck_grids.gridinfo, gridindexes))
+            return true;
+
+        orig_size = lck_grids.gridinfo.size();
+        new_size = orig_size + new_grids.size();
+
+        lck_grids.gridinfo.resize(new_size);
+        for (std::size_t i = 0 ; i < new_grids.size() ; ++ i)
+            new_grids[i].swap(lck_grids.gridinfo[i + orig_size]);
+
+        lck_grids.regions.push_back(region);
+    }
+
+    pj_gridlist_add_seq_inc(gridindexes, orig_size, new_size);
+
+    return true;
+}
+
+// Generic stream policy and mapped grids
+template <bool Inverse, typename CalcT, typename StreamPolicy, typename Range, typename MappedGrids>
+inline bool pj_apply_gridshift_3(StreamPolicy const& ,
+                                 Range & range,
+                                 MappedGrids & grids,
+                                 std::vector<std::size_t> const& gridindexes,
+                                 mapped_grids_tag)
+{
+    typedef typename boost::range_size<Range>::type size_type;
+
+    // If the grids are empty the indexes are as well
+    if (gridindexes.empty())
+    {
+        return false;
+    }
+
+    size_type point_count = boost::size(range);
+
+    // Nothing is loaded so the lock is held for the whole range
+    typename MappedGrids::read_locked lck_grids(grids);
+
+    for (size_type i = 0 ; i < point_count ; ++i)
+    {
+        typename boost::range_reference<Range>::type
+            point = range::at(range, i);
+
+        CalcT in_lon = geometry::get_as_radian<0>(point);
+        CalcT in_lat = geometry::get_as_radian<1>(point);
+
+        pj_gi * gip = find_grid(in_lon, in_lat, lck_grids.gridinfo, gridindexes);
+
+        if (gip != NULL)
+        {
+            // TODO: use set_invalid_point() or similar mechanism
+            CalcT out_lon = HUGE_VAL;
+            CalcT out_lat = HUGE_VAL;
+
+            nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, *gip,
+                             pj_mapped_cvs(*gip));
+
+            // TODO: check differently
+            if (out_lon != HUGE_VAL)
+            {
+                geometry::set_from_radian<0>(point, out_lon);
+                geometry::set_from_radian<1>(point, out_lat);
+            }
+        }
+    }
+
+    return true;
+}
+
+}} // namespace projections::detail
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_MAPPED_GRIDS_HPP
@@ -14,8 +14,10 @@
 #define BOOST_GEOMETRY_SRS_PROJECTION_HPP
 
 
+#include <cstddef>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <boost/smart_ptr/shared_ptr.hpp>
 #include <boost/throw_exception.hpp>
@@ -24,18 +26,23 @@
 #include <boost/geometry/algorithms/detail/convert_point_to_point.hpp>
 
 #include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/static_assert.hpp>
 
+#include <boost/geometry/srs/projections/adaptive_densify.hpp>
 #include <boost/geometry/srs/projections/dpar.hpp>
 #include <boost/geometry/srs/projections/exception.hpp>
 #include <boost/geometry/srs/projections/factory.hpp>
 #include <boost/geometry/srs/projections/impl/base_dynamic.hpp>
 #include <boost/geometry/srs/projections/impl/base_static.hpp>
+#include <boost/geometry/srs/projections/impl/parallel_ranges.hpp>
 #include <boost/geometry/srs/projections/impl/pj_init.hpp>
 #include <boost/geometry/srs/projections/invalid_point.hpp>
 #include <boost/geometry/srs/projections/proj4.hpp>
 #include <boost/geometry/srs/projections/spar.hpp>
 
+#include <boost/geometry/util/math.hpp>
+
 #include <boost/geometry/views/detail/indexed_point_view.hpp>
 
 
@@ -68,6 +75,21 @@ struct promote_to_double
         > type;
 };
 
+// Factors converting angles in Units to radians and back
+template <typename Units, typename T>
+inline T to_radian()
+{
+    return std::is_same<Units, geometry::degree>::value
+        ? geometry::math::d2r<T>() : T(1);
+}
+
+template <typename Units, typename T>
+inline T from_radian()
+{
+    return std::is_same<Units, geometry::degree>::value
+        ? geometry::math::r2d<T>() : T(1);
+}
+
 // Copy coordinates of dimensions >= MinDim
 template <std::size_t MinDim, typename Point1, typename Point2>
 inline void copy_higher_dimensions(Point1 const& point1, Point2 & point2)
@@ -128,6 +150,24 @@ struct project_point
     }
 };
 
+// Projects single points, e.g. the points inserted by densify_geometry
+template <typename PointPolicy, typename Proj>
+struct project_point_function
+{
+    explicit project_point_function(Proj const& proj)
+        : m_proj(proj)
+    {}
+
+    template <typename P1, typename P2>
+    inline bool operator()(P1 const& p1, P2 & p2) const
+    {
+        return project_point<PointPolicy>::apply(p1, p2, m_proj);
+    }
+
+private:
+    Proj const& m_proj;
+};
+
 template <typename PointPolicy>
 struct project_range
 {
@@ -286,6 +326,112 @@ struct project_geometry<MultiPolygon, PointPolicy, multi_polygon_tag>
 {};
 
 
+// Projects the points of pairs of ranges, split into chunks,
+// using multiple threads
+template <typename PointPolicy, typename Range1, typename Range2>
+class project_range_pairs
+{
+public:
+    // Resizes range2 as range_to_range would fill it
+    inline void apply(Range1 const& range1, Range2 & range2)
+    {
+        std::size_t const size1 = boost::size(range1);
+        std::size_t size2 = size1;
+        if (geometry::closure<Range1>::value == geometry::open && size1 > 0)
+        {
+            size2++;
+        }
+        if (geometry::closure<Range2>::value == geometry::open && size2 > 0)
+        {
+            size2--;
+        }
+
+        range::resize(range2, size2);
+
+        m_ranges1.push_back(boost::addressof(range1));
+        m_ranges2.push_back(boost::addressof(range2));
+        m_sizes.push_back(size2);
+    }
+
+    template <typename Proj>
+    inline bool apply(Proj const& proj, std::size_t thread_count) const
+    {
+        static const bool reverse = geometry::point_order<Range1>::value
+                                 != geometry::point_order<Range2>::value;
+
+        return parallel_range_chunks(m_sizes, thread_count,
+            [&](range_chunk const& chunk)
+            {
+                Range1 const& range1 = *m_ranges1[chunk.index];
+                Range2 & range2 = *m_ranges2[chunk.index];
+                std::size_t const size1 = boost::size(range1);
+
+                bool result = true;
+                for (std::size_t i = chunk.first; i < chunk.last; i++)
+                {
+                    // The closing point of an open range is its first point
+                    std::size_t const j = i < size1 ? i : 0;
+                    if (! project_point<PointPolicy>::apply(
+                            range::at(range1, reverse ? size1 - 1 - j : j),
+                            range::at(range2, i), proj))
+                    {
+                        result = false;
+                    }
+                }
+                return result;
+            });
+    }
+
+private:
+    std::vector<Range1 const*> m_ranges1;
+    std::vector<Range2*> m_ranges2;
+    std::vector<std::size_t> m_sizes;
+};
+
+// As project_geometry, using multiple threads for the points of the
+// ranges of the geometry
+template
+<
+    typename Geometry,
+    typename PointPolicy,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct project_geometry_parallel
+{
+    template <typename G1, typename G2, typename Proj>
+    static inline bool apply(G1 const& g1, G2 & g2, Proj const& proj,
+                             std::size_t thread_count)
+    {
+        project_range_pairs
+            <
+                PointPolicy,
+                typename visit_range_pairs<G1>::range_type,
+                typename visit_range_pairs<G2>::range_type
+            > ranges;
+
+        visit_range_pairs<G1>::apply(g1, g2, ranges);
+
+        return ranges.apply(proj, thread_count);
+    }
+};
+
+template <typename Geometry, typename PointPolicy>
+struct project_geometry_parallel<Geometry, PointPolicy, point_tag>
+{
+    template <typename G1, typename G2, typename Proj>
+    static inline bool apply(G1 const& g1, G2 & g2, Proj const& proj,
+                             std::size_t )
+    {
+        return project_geometry<Geometry, PointPolicy>::apply(g1, g2, proj);
+    }
+};
+
+template <typename Geometry, typename PointPolicy>
+struct project_geometry_parallel<Geometry, PointPolicy, segment_tag>
+    : project_geometry_parallel<Geometry, PointPolicy, point_tag>
+{};
+
+
 } // namespace detail
 #endif // DOXYGEN_NO_DETAIL
 
@@ -447,6 +593,9 @@ class projection
     typedef proj_wrapper<Proj, CT> base_t;
 
 public:
+    /// Type of the coordinates of the arrays projected at once
+    typedef typename projections::detail::promote_to_double<CT>::type calculation_type;
+
     projection()
     {}
 
@@ -490,6 +639,148 @@ public:
                     projections::detail::inverse_point_projection_policy
                 >::apply(xy, ll, base_t::proj());
     }
+
+    /*!
+    \brief Forward projection, from Latitude-Longitude to Cartesian,
+        using multiple threads
+    \details The points of the ranges of the geometry are split into chunks,
+        projected by up to thread_count threads (0: the number of hardware
+        threads). The result is the same as of the forward projection with
+        one thread: points which can not be projected are set to HUGE_VAL
+        and false is returned.
+    */
+    template <typename LL, typename XY>
+    inline bool forward(LL const& ll, XY& xy, std::size_t thread_count) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (projections::detail::same_tags<LL, XY>::value),
+            "Not supported combination of Geometries.",
+            LL, XY);
+
+        concepts::check_concepts_and_equal_dimensions<LL const, XY>();
+
+        return projections::detail::project_geometry_parallel
+                <
+                    LL,
+                    projections::detail::forward_point_projection_policy
+                >::apply(ll, xy, base_t::proj(), thread_count);
+    }
+
+    /*!
+    \brief Inverse projection, from Cartesian to Latitude-Longitude,
+        using multiple threads
+    \details See forward
+    */
+    template <typename XY, typename LL>
+    inline bool inverse(XY const& xy, LL& ll, std::size_t thread_count) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (projections::detail::same_tags<XY, LL>::value),
+            "Not supported combination of Geometries.",
+            XY, LL);
+
+        concepts::check_concepts_and_equal_dimensions<XY const, LL>();
+
+        return projections::detail::project_geometry_parallel
+                <
+                    XY,
+                    projections::detail::inverse_point_projection_policy
+                >::apply(xy, ll, base_t::proj(), thread_count);
+    }
+
+    /*!
+    \brief Forward projection, from Latitude-Longitude to Cartesian,
+        with adaptive densification
+    \details The points are projected as with one thread, then points are
+        inserted into the segments of the projected linestrings and rings
+        where the projection of the middle point of the segment deviates
+        from the projected segment, see srs::adaptive_densify.
+        Only the inserted points are projected additionally.
+    */
+    template <typename LL, typename XY, typename T>
+    inline bool forward(LL const& ll, XY& xy,
+                        srs::adaptive_densify<T> const& densify) const
+    {
+        bool const result = forward(ll, xy);
+
+        typedef projections::detail::project_point_function
+            <
+                projections::detail::forward_point_projection_policy,
+                typename std::remove_reference<decltype(base_t::proj())>::type
+            > function_type;
+
+        projections::detail::densify_geometry
+            <
+                XY
+            >::apply(ll, xy, function_type(base_t::proj()), densify);
+
+        return result;
+    }
+
+    /*!
+    \brief Inverse projection, from Cartesian to Latitude-Longitude,
+        with adaptive densification
+    \details See forward, the deviation is measured in the units of the
+        Latitude-Longitude coordinates
+    */
+    template <typename XY, typename LL, typename T>
+    inline bool inverse(XY const& xy, LL& ll,
+                        srs::adaptive_densify<T> const& densify) const
+    {
+        bool const result = inverse(xy, ll);
+
+        typedef projections::detail::project_point_function
+            <
+                projections::detail::inverse_point_projection_policy,
+                typename std::remove_reference<decltype(base_t::proj())>::type
+            > function_type;
+
+        projections::detail::densify_geometry
+            <
+                LL
+            >::apply(xy, ll, function_type(base_t::proj()), densify);
+
+        return result;
+    }
+
+    /*!
+    \brief Forward projection of count points, from Latitude-Longitude
+        to Cartesian
+    \details The projection is dispatched once for all points. The i-th
+        point is read from lon[i * stride] and lat[i * stride] and written
+        to x[i * stride] and y[i * stride], so the coordinates can be stored
+        in separate arrays (stride 1) or interleaved (stride 2). Points which
+        can not be projected are set to HUGE_VAL.
+    \tparam Units angle units of lon and lat, degree or radian
+    \return true if all points were projected
+    */
+    template <typename Units = geometry::degree>
+    inline bool forward(calculation_type const* lon, calculation_type const* lat,
+                        calculation_type* x, calculation_type* y,
+                        std::size_t count, std::size_t stride = 1) const
+    {
+        return base_t::proj().forward_n(lon, lat, x, y, count, stride,
+            projections::detail::to_radian<Units, calculation_type>());
+    }
+
+    /*!
+    \brief Inverse projection of count points, from Cartesian to
+        Latitude-Longitude
+    \details The projection is dispatched once for all points. The i-th
+        point is read from x[i * stride] and y[i * stride] and written
+        to lon[i * stride] and lat[i * stride]. Points which can not be
+        projected are set to HUGE_VAL.
+    \tparam Units angle units of lon and lat, degree or radian
+    \return true if all points were projected
+    */
+    template <typename Units = geometry::degree>
+    inline bool inverse(calculation_type const* x, calculation_type const* y,
+                        calculation_type* lon, calculation_type* lat,
+                        std::size_t count, std::size_t stride = 1) const
+    {
+        return base_t::proj().inverse_n(x, y, lon, lat, count, stride,
+            projections::detail::from_radian<Units, calculation_type>());
+    }
 };
 
 } // namespace projections
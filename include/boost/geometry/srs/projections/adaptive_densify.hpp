@@ -0,0 +1,321 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_PROJECTIONS_ADAPTIVE_DENSIFY_HPP
+#define BOOST_GEOMETRY_PROJECTIONS_ADAPTIVE_DENSIFY_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/arithmetic/arithmetic.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/srs/projections/impl/parallel_ranges.hpp>
+#include <boost/geometry/srs/projections/invalid_point.hpp>
+
+#include <boost/geometry/strategies/geographic/line_interpolate.hpp>
+#include <boost/geometry/strategies/spherical/line_interpolate.hpp>
+
+#include <boost/geometry/util/normalize_spheroidal_coordinates.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+/*!
+    \brief Adaptive densification of projected or transformed geometries
+    \details Each segment of the linestrings and rings is divided in the
+        middle as long as the projected middle point deviates from the
+        projected segment by more than max_deviation, in the units of the
+        output coordinates. For geographic and spherical input the middle
+        of the geodesic is taken, also for segments crossing the
+        antimeridian, for cartesian input the middle of the straight segment. The halves
+        are divided recursively, at most max_depth times, so up to
+        2^max_depth - 1 points can be inserted into a segment.
+    \ingroup projection
+*/
+template <typename T = double>
+class adaptive_densify
+{
+public:
+    explicit adaptive_densify(T const& max_deviation,
+                              std::size_t max_depth = 10)
+        : m_max_deviation(max_deviation)
+        , m_max_depth(max_depth)
+    {}
+
+    T const& max_deviation() const { return m_max_deviation; }
+    std::size_t max_depth() const { return m_max_depth; }
+
+private:
+    T m_max_deviation;
+    std::size_t m_max_depth;
+};
+
+} // namespace srs
+
+
+namespace projections
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Calculates the middle point of a segment of the input geometry
+template <typename CsTag>
+struct densify_midpoint
+{
+    template <typename Point>
+    static inline void apply(Point const& p1, Point const& p2, Point & mid)
+    {
+        mid = p1;
+        geometry::add_point(mid, p2);
+        geometry::divide_value(mid, 2);
+    }
+};
+
+// The middle of the geodesic, with the longitude normalized, so segments
+// crossing the antimeridian are divided there and not at the other side.
+// It is calculated from the lexicographically smaller point, so reversed
+// segments, e.g. of reversed rings, are divided at the same point.
+template <typename Strategy>
+struct densify_midpoint_angular
+{
+    template <typename Point>
+    static inline void apply(Point const& p1, Point const& p2, Point & mid)
+    {
+        typedef typename geometry::detail::cs_angular_units
+            <
+                Point
+            >::type units_type;
+
+        bool const reversed = geometry::get<0>(p2) < geometry::get<0>(p1)
+                           || (geometry::get<0>(p2) == geometry::get<0>(p1)
+                               && geometry::get<1>(p2) < geometry::get<1>(p1));
+        Point const& first = reversed ? p2 : p1;
+        Point const& second = reversed ? p1 : p2;
+
+        Strategy const strategy;
+        strategy.apply(first, second, 0.5, mid,
+                       strategy.get_distance_pp_strategy().apply(first, second));
+
+        typename geometry::coordinate_type<Point>::type lon = geometry::get<0>(mid);
+        math::normalize_longitude<units_type>(lon);
+        geometry::set<0>(mid, lon);
+    }
+};
+
+template <>
+struct densify_midpoint<spherical_equatorial_tag>
+    : densify_midpoint_angular
+        <
+            strategy::line_interpolate::services::default_strategy
+                <
+                    spherical_equatorial_tag
+                >::type
+        >
+{};
+
+// Vincenty's formulas, the midpoints of the default ones are off by meters
+// for long segments, more than the deviations usually densified for
+template <>
+struct densify_midpoint<geographic_tag>
+    : densify_midpoint_angular
+        <
+            strategy::line_interpolate::geographic<strategy::vincenty>
+        >
+{};
+
+// Inserts points into the ranges of projected points, projecting the middle
+// points of the segments of the input ranges with PointFunction
+template <typename PointFunction, typename T>
+class densify_range_visitor
+{
+public:
+    densify_range_visitor(PointFunction const& function,
+                          srs::adaptive_densify<T> const& densify)
+        : m_function(function)
+        , m_max_deviation_sqr(densify.max_deviation() * densify.max_deviation())
+        , m_max_depth(densify.max_depth())
+    {}
+
+    template <typename RangeIn, typename RangeOut>
+    inline void apply(RangeIn const& in, RangeOut & out)
+    {
+        apply(in, out, typename geometry::tag<RangeIn>::type());
+    }
+
+private:
+    // The points of multi points are not connected
+    template <typename RangeIn, typename RangeOut>
+    inline void apply(RangeIn const& , RangeOut & , multi_point_tag)
+    {}
+
+    template <typename RangeIn, typename RangeOut, typename Tag>
+    inline void apply(RangeIn const& in, RangeOut & out, Tag)
+    {
+        typedef typename boost::range_value<RangeOut>::type point_type;
+
+        static const bool reverse = geometry::point_order<RangeIn>::value
+                                 != geometry::point_order<RangeOut>::value;
+
+        std::size_t const size_in = boost::size(in);
+        std::size_t const size_out = boost::size(out);
+        if (size_in < 2 || size_out < 2 || m_max_depth == 0)
+        {
+            return;
+        }
+
+        // The i-th output point is projected from the in_index(i)-th input
+        // point, as in range_to_range, the closing point of an open range
+        // is its first point
+        auto in_index = [&](std::size_t i)
+        {
+            std::size_t const j = i < size_in ? i : 0;
+            return reverse ? size_in - 1 - j : j;
+        };
+
+        std::vector<point_type> points;
+        points.reserve(size_out);
+        for (std::size_t i = 0; i + 1 < size_out; i++)
+        {
+            points.push_back(range::at(out, i));
+            densify(range::at(in, in_index(i)), range::at(in, in_index(i + 1)),
+                    range::at(out, i), range::at(out, i + 1),
+                    m_max_depth, points);
+        }
+        points.push_back(range::at(out, size_out - 1));
+
+        // The closing segment of an open ring
+        if (geometry::closure<RangeOut>::value == geometry::open)
+        {
+            densify(range::at(in, in_index(size_out - 1)), range::at(in, in_index(0)),
+                    range::at(out, size_out - 1), range::at(out, 0),
+                    m_max_depth, points);
+        }
+
+        if (points.size() == size_out)
+        {
+            return;
+        }
+
+        range::clear(out);
+        for (point_type const& point : points)
+        {
+            range::push_back(out, point);
+        }
+    }
+
+    template <typename PointIn, typename PointOut>
+    inline void densify(PointIn const& in1, PointIn const& in2,
+                        PointOut const& out1, PointOut const& out2,
+                        std::size_t depth, std::vector<PointOut> & points) const
+    {
+        if (depth == 0 || is_invalid_point(out1) || is_invalid_point(out2))
+        {
+            return;
+        }
+
+        PointIn in_mid;
+        densify_midpoint
+            <
+                typename geometry::cs_tag<PointIn>::type
+            >::apply(in1, in2, in_mid);
+
+        PointOut out_mid;
+        if (! m_function(in_mid, out_mid))
+        {
+            return;
+        }
+
+        // Distance of the projected middle point to the projected segment,
+        // so points are not inserted into straight but unevenly scaled
+        // segments
+        T const x1 = T(geometry::get<0>(out1));
+        T const y1 = T(geometry::get<1>(out1));
+        T const sx = T(geometry::get<0>(out2)) - x1;
+        T const sy = T(geometry::get<1>(out2)) - y1;
+        T const mx = T(geometry::get<0>(out_mid)) - x1;
+        T const my = T(geometry::get<1>(out_mid)) - y1;
+        T const length_sqr = sx * sx + sy * sy;
+        T t = length_sqr > 0 ? (mx * sx + my * sy) / length_sqr : T(0);
+        t = t < 0 ? T(0) : t > 1 ? T(1) : t;
+        T const dx = mx - t * sx;
+        T const dy = my - t * sy;
+        // Not divided if the deviation is NaN
+        if (! (dx * dx + dy * dy > m_max_deviation_sqr))
+        {
+            return;
+        }
+
+        densify(in1, in_mid, out1, out_mid, depth - 1, points);
+        points.push_back(out_mid);
+        densify(in_mid, in2, out_mid, out2, depth - 1, points);
+    }
+
+    PointFunction const& m_function;
+    T m_max_deviation_sqr;
+    std::size_t m_max_depth;
+};
+
+// Densifies the geometry of points projected from the input geometry
+template
+<
+    typename Geometry,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct densify_geometry
+{
+    template <typename G1, typename G2, typename PointFunction, typename T>
+    static inline void apply(G1 const& g1, G2 & g2,
+                             PointFunction const& function,
+                             srs::adaptive_densify<T> const& densify)
+    {
+        densify_range_visitor<PointFunction, T> visitor(function, densify);
+        visit_range_pairs<Geometry>::apply(g1, g2, visitor);
+    }
+};
+
+// Points can not be inserted into points and segments
+template <typename Point>
+struct densify_geometry<Point, point_tag>
+{
+    template <typename G1, typename G2, typename PointFunction, typename T>
+    static inline void apply(G1 const& , G2 & , PointFunction const& ,
+                             srs::adaptive_densify<T> const& )
+    {}
+};
+
+template <typename Segment>
+struct densify_geometry<Segment, segment_tag>
+    : densify_geometry<Segment, point_tag>
+{};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+} // namespace projections
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_PROJECTIONS_ADAPTIVE_DENSIFY_HPP
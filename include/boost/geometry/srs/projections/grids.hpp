@@ -27,6 +27,8 @@ namespace projections { namespace detail
 
 struct grids_tag {};
 struct shared_grids_tag {};
+struct mapped_grids_tag {};
+struct snapshot_grids_tag {};
 
 
 }} // namespace projections::detail
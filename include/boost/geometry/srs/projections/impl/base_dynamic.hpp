@@ -13,6 +13,7 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/srs/projections/exception.hpp>
@@ -63,6 +64,16 @@ public :
         }
     }
 
+    /// Forward projection of count points, lon / lat multiplied by to_radian
+    virtual bool forward_n(CT const* lon, CT const* lat, CT* x, CT* y,
+                           std::size_t count, std::size_t stride,
+                           CT const& to_radian) const = 0;
+
+    /// Inverse projection of count points, lon / lat multiplied by from_radian
+    virtual bool inverse_n(CT const* x, CT const* y, CT* lon, CT* lat,
+                           std::size_t count, std::size_t stride,
+                           CT const& from_radian) const = 0;
+
     /// Inverse projection, from Cartesian to Latitude-Longitude
     template <typename LL, typename XY>
     inline bool inverse(XY const& xy, LL& lp) const
@@ -126,6 +137,20 @@ public:
         BOOST_THROW_EXCEPTION(projection_not_invertible_exception(this->name()));
     }
 
+    virtual bool forward_n(CT const* lon, CT const* lat, CT* x, CT* y,
+                           std::size_t count, std::size_t stride,
+                           CT const& to_radian) const
+    {
+        // The projection is called directly, not virtually, for each point
+        return pj_fwd_n(prj(), this->m_par, lon, lat, x, y, count, stride, to_radian);
+    }
+
+    virtual bool inverse_n(CT const* , CT const* , CT* , CT* ,
+                           std::size_t , std::size_t , CT const& ) const
+    {
+        BOOST_THROW_EXCEPTION(projection_not_invertible_exception(this->name()));
+    }
+
 protected:
     Prj const& prj() const { return *this; }
 };
@@ -151,6 +176,13 @@ public:
     {
         this->prj().inv(par, xy_x, xy_y, lp_lon, lp_lat);
     }
+
+    virtual bool inverse_n(CT const* x, CT const* y, CT* lon, CT* lat,
+                           std::size_t count, std::size_t stride,
+                           CT const& from_radian) const
+    {
+        return pj_inv_n(this->prj(), this->m_par, x, y, lon, lat, count, stride, from_radian);
+    }
 };
 
 } // namespace detail
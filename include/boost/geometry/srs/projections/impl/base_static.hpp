@@ -19,6 +19,7 @@
 #endif // defined(_MSC_VER)
 
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/core/assert.hpp>
@@ -125,6 +126,14 @@ public:
         }
     }
 
+    template <typename T>
+    inline bool forward_n(T const* lon, T const* lat, T* x, T* y,
+                          std::size_t count, std::size_t stride,
+                          T const& to_radian) const
+    {
+        return pj_fwd_n(*this, this->m_par, lon, lat, x, y, count, stride, to_radian);
+    }
+
     template <typename XY, typename LL>
     inline bool inverse(XY const&, LL&) const
     {
@@ -133,6 +142,16 @@ public:
             Prj);
         return false;
     }
+
+    template <typename T>
+    inline bool inverse_n(T const* , T const* , T* , T* ,
+                          std::size_t , std::size_t , T const& ) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT_FALSE(
+            "This projection is not invertable.",
+            Prj);
+        return false;
+    }
 };
 
 // Forward/inverse
@@ -159,6 +178,14 @@ public:
             return false;
         }
     }
+
+    template <typename T>
+    inline bool inverse_n(T const* x, T const* y, T* lon, T* lat,
+                          std::size_t count, std::size_t stride,
+                          T const& from_radian) const
+    {
+        return pj_inv_n(*this, this->m_par, x, y, lon, lat, count, stride, from_radian);
+    }
 };
 
 } // namespace detail
@@ -0,0 +1,200 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_PROJECTIONS_IMPL_MAPPED_FILE_HPP
+#define BOOST_GEOMETRY_SRS_PROJECTIONS_IMPL_MAPPED_FILE_HPP
+
+
+#include <boost/config.hpp>
+
+// Files are mapped with mmap() on POSIX systems. Boost.Interprocess is used
+// on other systems, or if BOOST_GEOMETRY_MAPPED_FILE_INTERPROCESS is defined.
+#if ! defined(BOOST_GEOMETRY_MAPPED_FILE_INTERPROCESS) && ! defined(BOOST_HAS_UNISTD_H)
+#define BOOST_GEOMETRY_MAPPED_FILE_INTERPROCESS
+#endif
+
+#include <cstddef>
+#include <istream>
+#include <streambuf>
+#include <string>
+
+#ifdef BOOST_GEOMETRY_MAPPED_FILE_INTERPROCESS
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace boost { namespace geometry { namespace projections
+{
+
+namespace detail
+{
+
+// Whole file mapped read-only, the mapping is released at destruction
+class mapped_file
+{
+public:
+    // Maps the file, is_mapped() returns false on failure
+    explicit mapped_file(std::string const& filename)
+#ifndef BOOST_GEOMETRY_MAPPED_FILE_INTERPROCESS
+        : m_data(NULL)
+        , m_size(0)
+#endif
+    {
+        map(filename);
+    }
+
+    ~mapped_file()
+    {
+#ifndef BOOST_GEOMETRY_MAPPED_FILE_INTERPROCESS
+        if (m_data != NULL)
+        {
+            ::munmap(const_cast<char*>(m_data), m_size);
+        }
+#endif
+    }
+
+    bool is_mapped() const
+    {
+        return data() != NULL;
+    }
+
+#ifdef BOOST_GEOMETRY_MAPPED_FILE_INTERPROCESS
+
+    char const* data() const
+    {
+        return static_cast<char const*>(m_region.get_address());
+    }
+
+    std::size_t size() const
+    {
+        return m_region.get_size();
+    }
+
+private:
+    void map(std::string const& filename)
+    {
+        namespace bi = boost::interprocess;
+
+        try
+        {
+            bi::file_mapping file(filename.c_str(), bi::read_only);
+            // The region stays valid after the file is closed
+            bi::mapped_region(file, bi::read_only).swap(m_region);
+        }
+        catch (bi::interprocess_exception const&)
+        {}
+    }
+
+    boost::interprocess::mapped_region m_region;
+
+#else // BOOST_GEOMETRY_MAPPED_FILE_INTERPROCESS
+
+    char const* data() const
+    {
+        return m_data;
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+private:
+    void map(std::string const& filename)
+    {
+        int const fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return;
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == 0 && st.st_size > 0)
+        {
+            void * const address = ::mmap(NULL, std::size_t(st.st_size),
+                                          PROT_READ, MAP_SHARED, fd, 0);
+            if (address != MAP_FAILED)
+            {
+                m_data = static_cast<char const*>(address);
+                m_size = std::size_t(st.st_size);
+            }
+        }
+
+        // The mapping stays valid after the file is closed
+        ::close(fd);
+    }
+
+    char const* m_data;
+    std::size_t m_size;
+
+#endif // BOOST_GEOMETRY_MAPPED_FILE_INTERPROCESS
+
+    mapped_file(mapped_file const&);
+    mapped_file & operator=(mapped_file const&);
+};
+
+// Read-only stream buffer of a memory range, seekable within the range
+class memory_streambuf
+    : public std::streambuf
+{
+public:
+    memory_streambuf(char const* data, std::size_t size)
+    {
+        char * const begin = const_cast<char*>(data);
+        setg(begin, begin, begin + size);
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                     std::ios_base::openmode which)
+    {
+        if (! (which & std::ios_base::in))
+        {
+            return pos_type(off_type(-1));
+        }
+
+        off_type const size = egptr() - eback();
+        off_type const pos = dir == std::ios_base::beg ? off
+                           : dir == std::ios_base::cur ? gptr() - eback() + off
+                           : size + off;
+        if (pos < 0 || pos > size)
+        {
+            return pos_type(off_type(-1));
+        }
+
+        setg(eback(), eback() + pos, egptr());
+        return pos_type(pos);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which)
+    {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+// Input stream reading a memory range, e.g. a mapped file
+class memory_istream
+    : private memory_streambuf
+    , public std::istream
+{
+public:
+    memory_istream(char const* data, std::size_t size)
+        : memory_streambuf(data, size)
+        , std::istream(static_cast<memory_streambuf*>(this))
+    {}
+};
+
+} // namespace detail
+
+}}} // namespace boost::geometry::projections
+
+#endif // BOOST_GEOMETRY_SRS_PROJECTIONS_IMPL_MAPPED_FILE_HPP
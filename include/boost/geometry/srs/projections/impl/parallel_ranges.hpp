@@ -0,0 +1,193 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_PARALLEL_RANGES_HPP
+#define BOOST_GEOMETRY_PROJECTIONS_IMPL_PARALLEL_RANGES_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
+
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry { namespace projections
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Number of points of a range projected by one call, large enough
+// for the cost of handing out the chunks to be negligible
+static const std::size_t parallel_chunk_size = 1024;
+
+// Points [first, last) of the range at index
+struct range_chunk
+{
+    std::size_t index;
+    std::size_t first;
+    std::size_t last;
+};
+
+// Splits ranges with the given sizes into chunks and calls function(chunk)
+// for all chunks, using up to thread_count threads (0: hardware threads).
+// Returns false if any call returned false.
+template <typename Function>
+inline bool parallel_range_chunks(std::vector<std::size_t> const& sizes,
+                                  std::size_t thread_count,
+                                  Function const& function)
+{
+    std::vector<range_chunk> chunks;
+    for (std::size_t i = 0; i < sizes.size(); i++)
+    {
+        for (std::size_t first = 0; first < sizes[i]; first += parallel_chunk_size)
+        {
+            range_chunk chunk;
+            chunk.index = i;
+            chunk.first = first;
+            chunk.last = (std::min)(sizes[i], first + parallel_chunk_size);
+            chunks.push_back(chunk);
+        }
+    }
+
+    // One char per chunk, std::vector<bool> can not be written by
+    // multiple threads
+    std::vector<char> results(chunks.size(), 1);
+
+    geometry::detail::parallel_for(chunks.size(),
+        geometry::detail::parallel_thread_count(thread_count),
+        [&](std::size_t i)
+        {
+            results[i] = function(chunks[i]) ? 1 : 0;
+        });
+
+    return std::find(results.begin(), results.end(), char(0)) == results.end();
+}
+
+// Calls visitor.apply(range1, range2) for the corresponding ranges of two
+// geometries of the same kind: the geometry itself, its linestrings or its
+// rings. The multi-geometries and interior rings of the second geometry
+// are resized first.
+template
+<
+    typename Geometry,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct visit_range_pairs
+{};
+
+template <typename Geometry>
+struct visit_single_range
+{
+    typedef Geometry range_type;
+
+    template <typename G1, typename G2, typename Visitor>
+    static inline void apply(G1 const& g1, G2 & g2, Visitor & visitor)
+    {
+        visitor.apply(g1, g2);
+    }
+};
+
+template <typename Geometry, typename Policy>
+struct visit_multi_ranges
+{
+    typedef typename Policy::range_type range_type;
+
+    template <typename G1, typename G2, typename Visitor>
+    static inline void apply(G1 const& g1, G2 & g2, Visitor & visitor)
+    {
+        if (boost::size(g2) != boost::size(g1))
+        {
+            range::resize(g2, boost::size(g1));
+        }
+
+        auto it2 = boost::begin(g2);
+        for (auto it1 = boost::begin(g1); it1 != boost::end(g1); ++it1, ++it2)
+        {
+            Policy::apply(*it1, *it2, visitor);
+        }
+    }
+};
+
+template <typename Linestring>
+struct visit_range_pairs<Linestring, linestring_tag>
+    : visit_single_range<Linestring>
+{};
+
+template <typename Ring>
+struct visit_range_pairs<Ring, ring_tag>
+    : visit_single_range<Ring>
+{};
+
+template <typename MultiPoint>
+struct visit_range_pairs<MultiPoint, multi_point_tag>
+    : visit_single_range<MultiPoint>
+{};
+
+template <typename MultiLinestring>
+struct visit_range_pairs<MultiLinestring, multi_linestring_tag>
+    : visit_multi_ranges
+        <
+            MultiLinestring,
+            visit_single_range
+                <
+                    typename boost::range_value<MultiLinestring>::type
+                >
+        >
+{};
+
+template <typename Polygon>
+struct visit_range_pairs<Polygon, polygon_tag>
+{
+    typedef typename geometry::ring_type<Polygon>::type range_type;
+
+    template <typename G1, typename G2, typename Visitor>
+    static inline void apply(G1 const& g1, G2 & g2, Visitor & visitor)
+    {
+        visitor.apply(geometry::exterior_ring(g1), geometry::exterior_ring(g2));
+
+        visit_multi_ranges
+            <
+                Polygon, visit_single_range<range_type>
+            >::apply(geometry::interior_rings(g1), geometry::interior_rings(g2),
+                     visitor);
+    }
+};
+
+template <typename MultiPolygon>
+struct visit_range_pairs<MultiPolygon, multi_polygon_tag>
+    : visit_multi_ranges
+        <
+            MultiPolygon,
+            visit_range_pairs
+                <
+                    typename boost::range_value<MultiPolygon>::type,
+                    polygon_tag
+                >
+        >
+{};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+}}} // namespace boost::geometry::projections
+
+
+#endif // BOOST_GEOMETRY_PROJECTIONS_IMPL_PARALLEL_RANGES_HPP
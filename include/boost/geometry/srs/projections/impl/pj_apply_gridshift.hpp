@@ -58,10 +58,12 @@ namespace detail
 {
 
 // Originally implemented in nad_intr.c
-template <typename CalcT>
+// Cvs is pj_ctable::cvs or pj_mapped_cvs
+template <typename CalcT, typename Cvs>
 inline void nad_intr(CalcT in_lon, CalcT in_lat,
                      CalcT & out_lon, CalcT & out_lat,
-                     pj_ctable const& ct)
+                     pj_ctable const& ct,
+                     Cvs const& cvs)
 {
 	pj_ctable::lp_t frct;
 	pj_ctable::ilp_t indx;
@@ -100,11 +102,11 @@ inline void nad_intr(CalcT in_lon, CalcT in_lat,
 			return;
 	}
 	boost::int32_t index = indx.phi * ct.lim.lam + indx.lam;
-	pj_ctable::flp_t const& f00 = ct.cvs[index++];
-	pj_ctable::flp_t const& f10 = ct.cvs[index];
+	pj_ctable::flp_t const& f00 = cvs[index++];
+	pj_ctable::flp_t const& f10 = cvs[index];
 	index += ct.lim.lam;
-	pj_ctable::flp_t const& f11 = ct.cvs[index--];
-	pj_ctable::flp_t const& f01 = ct.cvs[index];
+	pj_ctable::flp_t const& f11 = cvs[index--];
+	pj_ctable::flp_t const& f01 = cvs[index];
     CalcT m00, m10, m01, m11;
 	m11 = m10 = frct.lam;
 	m00 = m01 = 1. - frct.lam;
@@ -120,10 +122,11 @@ inline void nad_intr(CalcT in_lon, CalcT in_lat,
 }
 
 // Originally implemented in nad_cvt.c
-template <bool Inverse, typename CalcT>
+template <bool Inverse, typename CalcT, typename Cvs>
 inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
                     CalcT & out_lon, CalcT & out_lat,
-                    pj_gi const& gi)
+                    pj_gi const& gi,
+                    Cvs const& cvs)
 {
     static const int max_iterations = 10;
     static const CalcT tol = 1e-12;
@@ -151,7 +154,7 @@ inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
     tb.lam = adjlon (tb.lam - pi) + pi;
 
     pj_ctable::lp_t t;
-    nad_intr(tb.lam, tb.phi, t.lam, t.phi, ct);
+    nad_intr(tb.lam, tb.phi, t.lam, t.phi, ct, cvs);
     if (t.lam == HUGE_VAL)
     {
         out_lon = HUGE_VAL;
@@ -173,7 +176,7 @@ inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
     pj_ctable::lp_t del, dif;
     do
     {
-        nad_intr(t.lam, t.phi, del.lam, del.phi, ct);
+        nad_intr(t.lam, t.phi, del.lam, del.phi, ct, cvs);
 
         // This case used to return failure, but I have
         // changed it to return the first order approximation
@@ -210,6 +213,14 @@ inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
     out_lat = t.phi + ct.ll.phi;
 }
 
+template <bool Inverse, typename CalcT>
+inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
+                    CalcT & out_lon, CalcT & out_lat,
+                    pj_gi const& gi)
+{
+    nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, gi, gi.ct.cvs);
+}
+
 
 /************************************************************************/
 /*                             find_grid()                              */
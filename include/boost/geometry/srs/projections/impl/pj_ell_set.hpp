@@ -41,6 +41,8 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_ELL_SET_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_ELL_SET_HPP
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -74,7 +76,7 @@ template <typename T>
 inline T RV6() { return .04243827160493827160; } /* 55/1296 */
 
 template <typename T>
-inline T pj_ell_b_to_es(T const& a, T const& b)
+constexpr T pj_ell_b_to_es(T const& a, T const& b)
 {
     return 1. - (b * b) / (a * a);
 }
@@ -523,6 +525,153 @@ struct static_srs_tag<Params, void, void, void>
 };
 
 
+/************************************************************************/
+/*                            pj_ell_sqrt()                             */
+/************************************************************************/
+
+// The exact value of v - x * x, x * x is split into two halves (Dekker)
+template <typename T>
+constexpr T pj_ell_sqrt_residual(T const& v, T const& x)
+{
+    T const split = T((std::uint64_t(1) << ((std::numeric_limits<T>::digits + 1) / 2)) + 1);
+    T const c = split * x;
+    T const hi = c - (c - x);
+    T const lo = x - hi;
+    T const p = x * x;
+    T const err = ((hi * hi - p) + 2 * hi * lo) + lo * lo;
+    return (v - p) - err;
+}
+
+// Square root usable at compile time, correctly rounded like std::sqrt
+// for floating point T, 0 for non-positive v
+template <typename T>
+constexpr T pj_ell_sqrt(T const& v)
+{
+    if (! (v > 0))
+    {
+        return 0;
+    }
+
+    // Newton's iteration started above the root decreases monotonically
+    T x = v > 1 ? v : T(1);
+    for (T n = (x + v / x) / 2 ; n < x ; n = (x + v / x) / 2)
+    {
+        x = n;
+    }
+
+    // The result may be one ulp off, choose the closest neighbour
+    T p = 1;
+    while (p > x) p /= 2;
+    while (p * 2 <= x) p *= 2;
+    T const ulp = p * std::numeric_limits<T>::epsilon();
+
+    T const candidates[3] = { x, x - (x == p ? ulp / 2 : ulp), x + ulp };
+    T result = x;
+    T min_res = -1;
+    for (int i = 0 ; i < 3 ; ++i)
+    {
+        T r = pj_ell_sqrt_residual(v, candidates[i]);
+        r = r < 0 ? -r : r;
+        if (min_res < 0 || r < min_res)
+        {
+            result = candidates[i];
+            min_res = r;
+        }
+    }
+    return result;
+}
+
+/************************************************************************/
+/*                           static_ellps_id                            */
+/************************************************************************/
+
+// Index of the predefined ellipsoid (srs::dpar::value_ellps) defining
+// the model of static parameters or -1 if the model is defined otherwise,
+// the precedence is the same as in pj_ell_init()
+template <typename Params>
+struct static_ellps_id
+{
+    static const int value = -1;
+};
+
+template <typename ...Ps>
+struct static_ellps_id<srs::spar::parameters<Ps...> >
+{
+private:
+    typedef srs::spar::parameters<Ps...> params_type;
+
+    typedef typename geometry::tuples::find_if
+        <
+            params_type,
+            srs::spar::detail::is_param_tr<srs::spar::detail::ellps_traits>::pred
+        >::type ellps_type;
+    typedef typename geometry::tuples::find_if
+        <
+            params_type,
+            srs::spar::detail::is_param_tr<srs::spar::detail::datum_traits>::pred
+        >::type datum_type;
+    typedef typename srs::spar::detail::datum_traits
+        <
+            datum_type
+        >::ellps_type datum_ellps_type;
+
+    // R, a, shape parameters or the options turning ellipsoid into sphere
+    static const bool is_set_directly
+        = ! std::is_void
+            <
+                typename static_srs_tag_check_nonexpanded<params_type>::type
+            >::value
+       || geometry::tuples::exists_if
+            <
+                params_type, srs::spar::detail::is_param_t<srs::spar::a>::pred
+            >::value;
+
+    static const bool is_no_defs
+        = geometry::tuples::exists_if
+            <
+                params_type, srs::spar::detail::is_param<srs::spar::no_defs>::pred
+            >::value;
+
+public:
+    static const int value
+        = is_set_directly ? -1
+        : geometry::tuples::is_found<ellps_type>::value
+            ? srs::spar::detail::ellps_traits<ellps_type>::id
+        : geometry::tuples::is_found<datum_type>::value
+            ? srs::spar::detail::ellps_traits<datum_ellps_type>::id
+        : is_no_defs ? -1
+        : int(srs::dpar::ellps_wgs84);
+};
+
+/************************************************************************/
+/*                            pj_ell_static                             */
+/************************************************************************/
+
+// Constants of the predefined ellipsoid Id calculated the same way
+// as in pj_ell_init() and pj_init(), usable at compile time
+template <typename T, int Id>
+struct pj_ell_static
+{
+    static constexpr T a() { return T(pj_ellps_a(Id)); }
+    static constexpr T b() { return T(pj_ellps_b(Id)); }
+    static constexpr T es() { return pj_ell_b_to_es(a(), b()); }
+    static constexpr T e() { return pj_ell_sqrt(es()); }
+    static constexpr T ra() { return T(1. / a()); }
+    static constexpr T one_es() { return T(1. - es()); }
+    static constexpr T rone_es() { return T(1. / one_es()); }
+};
+
+// Id of the ellipsoid of static parameters whose constants can be folded
+// or -1
+template <typename T, typename Params>
+struct pj_ell_static_id
+{
+    static const int value = std::is_floating_point<T>::value
+                           ? static_ellps_id<Params>::value
+                           : -1;
+};
+
+
 template <typename T>
 inline void pj_calc_ellipsoid_params(parameters<T> & p, T const& a, T const& es) {
 /****************************************************************************************
@@ -58,72 +58,104 @@ struct pj_ellps_type
     //std::string name;  /* comments */
 };
 
-inline double b_from_a_rf(double a, double rf)
+constexpr double b_from_a_rf(double a, double rf)
 {
     return a * (1.0 - 1.0 / rf);
 }
 
+// The ellipsoids in the order of srs::dpar::value_ellps,
+// RF(ID, A, RF, NAME) or B(ID, A, B, NAME)
+#define BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_LIST(RF, B) \
+    RF("MERIT",     6378137.0,   298.257,            "MERIT 1983") \
+    RF("SGS85",     6378136.0,   298.257,            "Soviet Geodetic System 85") \
+    RF("GRS80",     6378137.0,   298.257222101,      "GRS 1980(IUGG, 1980)") \
+    RF("IAU76",     6378140.0,   298.257,            "IAU 1976") \
+    B ("airy",      6377563.396, 6356256.910,        "Airy 1830") \
+    RF("APL4.9",    6378137.0,   298.25,             "Appl. Physics. 1965") \
+    RF("NWL9D",     6378145.0,   298.25,             "Naval Weapons Lab., 1965") \
+    B ("mod_airy",  6377340.189, 6356034.446,        "Modified Airy") \
+    RF("andrae",    6377104.43,  300.0,              "Andrae 1876 (Den., Iclnd.)") \
+    RF("aust_SA",   6378160.0,   298.25,             "Australian Natl & S. Amer. 1969") \
+    RF("GRS67",     6378160.0,   298.2471674270,     "GRS 67(IUGG 1967)") \
+    RF("bessel",    6377397.155, 299.1528128,        "Bessel 1841") \
+    RF("bess_nam",  6377483.865, 299.1528128,        "Bessel 1841 (Namibia)") \
+    B ("clrk66",    6378206.4,   6356583.8,          "Clarke 1866") \
+    RF("clrk80",    6378249.145, 293.4663,           "Clarke 1880 mod.") \
+    RF("clrk80ign", 6378249.2,   293.4660212936269,  "Clarke 1880 (IGN).") \
+    RF("CPM",       6375738.7,   334.29,             "Comm. des Poids et Mesures 1799") \
+    RF("delmbr",    6376428.0,   311.5,              "Delambre 1810 (Belgium)") \
+    RF("engelis",   6378136.05,  298.2566,           "Engelis 1985") \
+    RF("evrst30",   6377276.345, 300.8017,           "Everest 1830") \
+    RF("evrst48",   6377304.063, 300.8017,           "Everest 1948") \
+    RF("evrst56",   6377301.243, 300.8017,           "Everest 1956") \
+    RF("evrst69",   6377295.664, 300.8017,           "Everest 1969") \
+    RF("evrstSS",   6377298.556, 300.8017,           "Everest (Sabah & Sarawak)") \
+    RF("fschr60",   6378166.0,   298.3,              "Fischer (Mercury Datum) 1960") \
+    RF("fschr60m",  6378155.0,   298.3,              "Modified Fischer 1960") \
+    RF("fschr68",   6378150.0,   298.3,              "Fischer 1968") \
+    RF("helmert",   6378200.0,   298.3,              "Helmert 1906") \
+    RF("hough",     6378270.0,   297.0,              "Hough") \
+    RF("intl",      6378388.0,   297.0,              "International 1909 (Hayford)") \
+    RF("krass",     6378245.0,   298.3,              "Krassovsky, 1942") \
+    RF("kaula",     6378163.0,   298.24,             "Kaula 1961") \
+    RF("lerch",     6378139.0,   298.257,            "Lerch 1979") \
+    RF("mprts",     6397300.0,   191.0,              "Maupertius 1738") \
+    B ("new_intl",  6378157.5,   6356772.2,          "New International 1967") \
+    B ("plessis",   6376523.0,   6355863.0,          "Plessis 1817 (France)") \
+    B ("SEasia",    6378155.0,   6356773.3205,       "Southeast Asia") \
+    B ("walbeck",   6376896.0,   6355834.8467,       "Walbeck") \
+    RF("WGS60",     6378165.0,   298.3,              "WGS 60") \
+    RF("WGS66",     6378145.0,   298.25,             "WGS 66") \
+    RF("WGS72",     6378135.0,   298.26,             "WGS 72") \
+    /* This has to be consistent with default spheroid and values in pj_datum_transform */ \
+    /* TODO: Define in one place */ \
+    B ("WGS84",     6378137.0,   6356752.3142451793, "WGS 84") \
+    B ("sphere",    6370997.0,   6370997.0,          "Normal Sphere (r=6370997)")
+
 #define BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF(ID, A, RF, NAME) \
-    {ID, /*#A, #RF, true,*/ A, b_from_a_rf(A, RF), /*NAME*/}
+    {ID, /*#A, #RF, true,*/ A, b_from_a_rf(A, RF), /*NAME*/},
 
 #define BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B(ID, A, B, NAME) \
-    {ID, /*#A, #B, false,*/ A, B, /*NAME*/}
+    {ID, /*#A, #B, false,*/ A, B, /*NAME*/},
+
+#define BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_A(ID, A, X, NAME) A,
+#define BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B_RF(ID, A, RF, NAME) b_from_a_rf(A, RF),
+#define BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B_B(ID, A, B, NAME) B,
 
 template <typename T>
 inline std::pair<const pj_ellps_type<T>*, int> pj_get_ellps()
 {
     static const pj_ellps_type<T> pj_ellps[] =
     {
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("MERIT",     6378137.0,   298.257,           "MERIT 1983"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("SGS85",     6378136.0,   298.257,           "Soviet Geodetic System 85"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("GRS80",     6378137.0,   298.257222101,     "GRS 1980(IUGG, 1980)"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("IAU76",     6378140.0,   298.257,           "IAU 1976"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B ("airy",      6377563.396, 6356256.910,       "Airy 1830"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("APL4.9",    6378137.0,   298.25,            "Appl. Physics. 1965"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("NWL9D",     6378145.0,   298.25,            "Naval Weapons Lab., 1965"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B ("mod_airy",  6377340.189, 6356034.446,       "Modified Airy"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("andrae",    6377104.43,  300.0,             "Andrae 1876 (Den., Iclnd.)"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("aust_SA",   6378160.0,   298.25,            "Australian Natl & S. Amer. 1969"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("GRS67",     6378160.0,   298.2471674270,    "GRS 67(IUGG 1967)"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("bessel",    6377397.155, 299.1528128,       "Bessel 1841"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("bess_nam",  6377483.865, 299.1528128,       "Bessel 1841 (Namibia)"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B ("clrk66",    6378206.4,   6356583.8,         "Clarke 1866"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("clrk80",    6378249.145, 293.4663,          "Clarke 1880 mod."),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("clrk80ign", 6378249.2,   293.4660212936269, "Clarke 1880 (IGN)."),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("CPM",       6375738.7,   334.29,            "Comm. des Poids et Mesures 1799"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("delmbr",    6376428.0,   311.5,             "Delambre 1810 (Belgium)"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("engelis",   6378136.05,  298.2566,          "Engelis 1985"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("evrst30",   6377276.345, 300.8017,          "Everest 1830"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("evrst48",   6377304.063, 300.8017,          "Everest 1948"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("evrst56",   6377301.243, 300.8017,          "Everest 1956"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("evrst69",   6377295.664, 300.8017,          "Everest 1969"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("evrstSS",   6377298.556, 300.8017,          "Everest (Sabah & Sarawak)"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("fschr60",   6378166.0,   298.3,             "Fischer (Mercury Datum) 1960"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("fschr60m",  6378155.0,   298.3,             "Modified Fischer 1960"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("fschr68",   6378150.0,   298.3,             "Fischer 1968"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("helmert",   6378200.0,   298.3,             "Helmert 1906"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("hough",     6378270.0,   297.0,             "Hough"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("intl",      6378388.0,   297.0,             "International 1909 (Hayford)"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("krass",     6378245.0,   298.3,             "Krassovsky, 1942"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("kaula",     6378163.0,   298.24,            "Kaula 1961"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("lerch",     6378139.0,   298.257,           "Lerch 1979"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("mprts",     6397300.0,   191.0,             "Maupertius 1738"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B ("new_intl",  6378157.5,   6356772.2,         "New International 1967"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B ("plessis",   6376523.0,   6355863.0,         "Plessis 1817 (France)"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B ("SEasia",    6378155.0,   6356773.3205,      "Southeast Asia"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B ("walbeck",   6376896.0,   6355834.8467,      "Walbeck"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("WGS60",     6378165.0,   298.3,             "WGS 60"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("WGS66",     6378145.0,   298.25,            "WGS 66"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF("WGS72",     6378135.0,   298.26,            "WGS 72"),
-        // This has to be consistent with default spheroid and values in pj_datum_transform
-        // TODO: Define in one place
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B ("WGS84",     6378137.0,   6356752.3142451793, "WGS 84"),
-        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B ("sphere",    6370997.0,   6370997.0,         "Normal Sphere (r=6370997)")
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_LIST(BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_RF,
+                                                        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B)
     };
 
     return std::make_pair(pj_ellps, (int)(sizeof(pj_ellps) / sizeof(pj_ellps[0])));
 }
 
+// Major axis of the ellipsoid of srs::dpar::value_ellps, usable at compile time
+constexpr double pj_ellps_a(int index)
+{
+    constexpr double values[] =
+    {
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_LIST(BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_A,
+                                                        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_A)
+    };
+    return values[index];
+}
+
+// Minor axis of the ellipsoid of srs::dpar::value_ellps, usable at compile time
+constexpr double pj_ellps_b(int index)
+{
+    constexpr double values[] =
+    {
+        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_LIST(BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B_RF,
+                                                        BOOST_GEOMETRY_PROJECTIONS_DETAIL_PJ_ELLPS_B_B)
+    };
+    return values[index];
+}
+
 } // namespace detail
 }}} // namespace boost::geometry::projections
 
@@ -39,6 +39,11 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_FWD_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_FWD_HPP
 
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/util/math.hpp>
 
@@ -53,28 +58,24 @@ namespace boost { namespace geometry { namespace projections {
 
 namespace detail {
 
-/* forward projection entry */
-template <typename Prj, typename LL, typename XY, typename P>
-inline void pj_fwd(Prj const& prj, P const& par, LL const& ll, XY& xy)
+/* checks and reduces lon / lat in radians before projecting,
+   returns false for latitude or longitude overange */
+template <typename P, typename T>
+inline bool pj_fwd_prepare(P const& par, T& lp_lon, T& lp_lat)
 {
-    typedef typename P::type calc_t;
-    static const calc_t EPS = 1.0e-12;
+    static const T EPS = 1.0e-12;
 
-    using namespace detail;
-
-    calc_t lp_lon = geometry::get_as_radian<0>(ll);
-    calc_t lp_lat = geometry::get_as_radian<1>(ll);
-    calc_t const t = geometry::math::abs(lp_lat) - geometry::math::half_pi<calc_t>();
+    T const t = geometry::math::abs(lp_lat) - geometry::math::half_pi<T>();
 
     /* check for forward and latitude or longitude overange */
     if (t > EPS || geometry::math::abs(lp_lon) > 10.)
     {
-        BOOST_THROW_EXCEPTION( projection_exception(error_lat_or_lon_exceed_limit) );
+        return false;
     }
 
     if (geometry::math::abs(t) <= EPS)
     {
-        lp_lat = lp_lat < 0. ? -geometry::math::half_pi<calc_t>() : geometry::math::half_pi<calc_t>();
+        lp_lat = lp_lat < 0. ? -geometry::math::half_pi<T>() : geometry::math::half_pi<T>();
     }
     else if (par.geoc)
     {
@@ -86,14 +87,153 @@ inline void pj_fwd(Prj const& prj, P const& par, LL const& ll, XY& xy)
     {
         lp_lon = adjlon(lp_lon); /* post_forward del longitude */
     }
+    return true;
+}
+
+/* forward projection of lon / lat in radians */
+template <typename Prj, typename P, typename T>
+inline void pj_fwd_lp(Prj const& prj, P const& par, T lp_lon, T lp_lat, T& xy_x, T& xy_y)
+{
+    if (! pj_fwd_prepare(par, lp_lon, lp_lat))
+    {
+        BOOST_THROW_EXCEPTION( projection_exception(error_lat_or_lon_exceed_limit) );
+    }
+
+    T x = 0;
+    T y = 0;
+
+    prj.fwd(par, lp_lon, lp_lat, x, y);
+
+    xy_x = par.fr_meter * (par.a * x + par.x0);
+    xy_y = par.fr_meter * (par.a * y + par.y0);
+}
+
+/* forward projection entry */
+template <typename Prj, typename LL, typename XY, typename P>
+inline void pj_fwd(Prj const& prj, P const& par, LL const& ll, XY& xy)
+{
+    typedef typename P::type calc_t;
 
     calc_t x = 0;
     calc_t y = 0;
 
-    prj.fwd(par, lp_lon, lp_lat, x, y);
+    pj_fwd_lp(prj, par,
+              calc_t(geometry::get_as_radian<0>(ll)),
+              calc_t(geometry::get_as_radian<1>(ll)),
+              x, y);
+
+    geometry::set<0>(xy, x);
+    geometry::set<1>(xy, y);
+}
 
-    geometry::set<0>(xy, par.fr_meter * (par.a * x + par.x0));
-    geometry::set<1>(xy, par.fr_meter * (par.a * y + par.y0));
+/* true if the projection has a batch kernel
+   fwd_n(par, lp_lon, lp_lat, xy_x, xy_y, failed, count), projecting count
+   prepared points without throwing, setting failed[i] where fwd throws.
+   Projections implement fwd and fwd_n with one function projecting a point
+   and returning the failure, fwd_point. Its constants are not function
+   local statics, their initialization check would be done in the loop */
+template <typename Prj, typename P, typename T, typename Enable = void>
+struct pj_has_fwd_n
+    : std::false_type
+{};
+
+template <typename Prj, typename P, typename T>
+struct pj_has_fwd_n
+    <
+        Prj, P, T,
+        decltype(std::declval<Prj const&>().fwd_n(std::declval<P const&>(),
+            (T const*)0, (T const*)0, (T*)0, (T*)0, (unsigned char*)0, std::size_t(0)))
+    >
+    : std::true_type
+{};
+
+template <bool HasKernel = false>
+struct pj_fwd_n_impl
+{
+    template <typename Prj, typename P, typename T>
+    static inline bool apply(Prj const& prj, P const& par,
+                             T const* lon, T const* lat, T* x, T* y,
+                             std::size_t count, std::size_t stride, T const& to_radian)
+    {
+        bool result = true;
+        for (std::size_t i = 0, j = 0; i < count; i++, j += stride)
+        {
+            try
+            {
+                pj_fwd_lp(prj, par, T(lon[j] * to_radian), T(lat[j] * to_radian),
+                          x[j], y[j]);
+            }
+            catch (...)
+            {
+                x[j] = HUGE_VAL;
+                y[j] = HUGE_VAL;
+                result = false;
+            }
+        }
+        return result;
+    }
+};
+
+template <>
+struct pj_fwd_n_impl<true>
+{
+    // The points are prepared, projected by the kernel, and scaled, in blocks
+    static const std::size_t block_size = 256;
+
+    template <typename Prj, typename P, typename T>
+    static inline bool apply(Prj const& prj, P const& par,
+                             T const* lon, T const* lat, T* x, T* y,
+                             std::size_t count, std::size_t stride, T const& to_radian)
+    {
+        T lp_lon[block_size], lp_lat[block_size];
+        T xy_x[block_size], xy_y[block_size];
+        unsigned char failed[block_size];
+
+        bool result = true;
+        for (std::size_t first = 0; first < count; first += block_size)
+        {
+            std::size_t const n = count - first < block_size
+                                ? count - first : block_size;
+            for (std::size_t i = 0, j = first * stride; i < n; i++, j += stride)
+            {
+                lp_lon[i] = lon[j] * to_radian;
+                lp_lat[i] = lat[j] * to_radian;
+                failed[i] = pj_fwd_prepare(par, lp_lon[i], lp_lat[i]) ? 0 : 1;
+            }
+
+            prj.fwd_n(par, lp_lon, lp_lat, xy_x, xy_y, failed, n);
+
+            for (std::size_t i = 0, j = first * stride; i < n; i++, j += stride)
+            {
+                if (failed[i])
+                {
+                    x[j] = HUGE_VAL;
+                    y[j] = HUGE_VAL;
+                    result = false;
+                }
+                else
+                {
+                    x[j] = par.fr_meter * (par.a * xy_x[i] + par.x0);
+                    y[j] = par.fr_meter * (par.a * xy_y[i] + par.y0);
+                }
+            }
+        }
+        return result;
+    }
+};
+
+/* forward projection of count points, the i-th at index i * stride of the
+   arrays, lon / lat multiplied by to_radian, not projected points set to
+   HUGE_VAL */
+template <typename Prj, typename P, typename T>
+inline bool pj_fwd_n(Prj const& prj, P const& par,
+                     T const* lon, T const* lat, T* x, T* y,
+                     std::size_t count, std::size_t stride, T const& to_radian)
+{
+    return pj_fwd_n_impl
+        <
+            pj_has_fwd_n<Prj, P, T>::value
+        >::apply(prj, par, lon, lat, x, y, count, stride, to_radian);
 }
 
 } // namespace detail
@@ -49,6 +49,7 @@
 #include <boost/cstdint.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -135,6 +136,8 @@ struct pj_gi_load
         , format(f)
         , grid_offset(off)
         , must_swap(swap)
+        , mapped_data(NULL)
+        , published_cvs(NULL)
     {}
 
     std::string gridname; // identifying name of grid, eg "conus" or ntv2_0.gsb
@@ -144,6 +147,11 @@ struct pj_gi_load
     offset_t grid_offset; // offset in file, for delayed loading
     bool must_swap;       // only for NTv2
 
+    char const* mapped_data; // contents of the file if it is memory-mapped
+
+    // shift values published once loaded, see srs::snapshot_grids
+    std::atomic<pj_ctable::flp_t const*> * published_cvs;
+
     pj_ctable ct;
 
     inline void swap(pj_gi_load & r)
@@ -152,6 +160,8 @@ struct pj_gi_load
         std::swap(format, r.format);
         std::swap(grid_offset, r.grid_offset);
         std::swap(must_swap, r.must_swap);
+        std::swap(mapped_data, r.mapped_data);
+        std::swap(published_cvs, r.published_cvs);
         ct.swap(r.ct);
     }
 
@@ -442,6 +452,153 @@ inline bool pj_gridinfo_load(IStream & is, pj_gi_load & gi)
     }
 }
 
+/************************************************************************/
+/*                        pj_gridinfo_mapped()                          */
+/*                                                                      */
+/*      Access the shift values of a grid stored in a memory-mapped     */
+/*      file. The values are decoded on demand, in the same order       */
+/*      and units as the values loaded by pj_gridinfo_load().           */
+/************************************************************************/
+
+// Offset of the shift values in the file, in bytes
+inline std::size_t pj_gridinfo_mapped_offset(pj_gi_load const& gi)
+{
+    if (gi.format == pj_gi::ctable)
+    {
+        // The size of the proj4 original CTABLE, see pj_gridinfo_load_ctable()
+        return 80
+             + 2 * sizeof(pj_ctable::lp_t)
+             + sizeof(pj_ctable::ilp_t)
+             + sizeof(pj_ctable::flp_t*);
+    }
+    else if (gi.format == pj_gi::ctable2)
+    {
+        return 160;
+    }
+    else
+    {
+        return std::size_t(gi.grid_offset);
+    }
+}
+
+// Check if the shift values of the grid and its children are stored
+// in the file of size file_size
+inline bool pj_gridinfo_mapped_check(pj_gi const& gi, std::size_t file_size)
+{
+    if (gi.format == pj_gi::missing || gi.ct.lim.lam < 1 || gi.ct.lim.phi < 1)
+    {
+        return false;
+    }
+
+    std::size_t const cell_size = gi.format == pj_gi::ntv1 || gi.format == pj_gi::ntv2 ? 16
+                                : gi.format == pj_gi::gtx ? sizeof(float)
+                                : sizeof(pj_ctable::flp_t);
+    std::size_t const size = std::size_t(gi.ct.lim.lam) * std::size_t(gi.ct.lim.phi) * cell_size;
+    std::size_t const offset = pj_gridinfo_mapped_offset(gi);
+    if (offset > file_size || size > file_size - offset)
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0 ; i < gi.children.size() ; ++i)
+    {
+        if (! pj_gridinfo_mapped_check(gi.children[i], file_size))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Set the contents of the file for the grid and its children
+inline void pj_gridinfo_mapped_assign(pj_gi & gi, char const* data)
+{
+    gi.mapped_data = data;
+    for (std::size_t i = 0 ; i < gi.children.size() ; ++i)
+    {
+        pj_gridinfo_mapped_assign(gi.children[i], data);
+    }
+}
+
+// Random access to the shift values of a horizontal grid, used instead
+// of pj_ctable::cvs
+class pj_mapped_cvs
+{
+public:
+    explicit pj_mapped_cvs(pj_gi_load const& gi)
+        : m_data(gi.mapped_data + pj_gridinfo_mapped_offset(gi))
+        , m_format(gi.format)
+        , m_must_swap(gi.format == pj_gi::ntv2 ? gi.must_swap
+                    : gi.format == pj_gi::ntv1 ? is_lsb()
+                    : gi.format == pj_gi::ctable2 ? ! is_lsb()
+                    : false)
+        , m_lam_count(gi.ct.lim.lam)
+    {
+        BOOST_GEOMETRY_ASSERT(gi.mapped_data != NULL);
+    }
+
+    inline pj_ctable::flp_t operator[](boost::int32_t index) const
+    {
+        static const double s2r = math::d2r<double>() / 3600.0;
+
+        pj_ctable::flp_t result;
+
+        if (m_format == pj_gi::ntv2)
+        {
+            // reversed rows of lat, lon, and accuracy values in seconds
+            float values[2];
+            read(values, reversed(index));
+            result.phi = (float) (values[0] * s2r);
+            result.lam = (float) (values[1] * s2r);
+        }
+        else if (m_format == pj_gi::ntv1)
+        {
+            // reversed rows of lat and lon in seconds
+            double values[2];
+            read(values, reversed(index));
+            result.phi = (float) (values[0] * s2r);
+            result.lam = (float) (values[1] * s2r);
+        }
+        else
+        {
+            // lon and lat in radians
+            float values[2];
+            read(values, std::size_t(index) * sizeof(pj_ctable::flp_t));
+            result.lam = values[0];
+            result.phi = values[1];
+        }
+
+        return result;
+    }
+
+private:
+    // Offset of the cell at index of pj_ctable::cvs in rows stored east to west
+    inline std::size_t reversed(boost::int32_t index) const
+    {
+        boost::int32_t const row = index / m_lam_count;
+        boost::int32_t const col = index - row * m_lam_count;
+        return (std::size_t(row) * m_lam_count + (m_lam_count - col - 1)) * 16;
+    }
+
+    // Read two values of the cell at offset
+    template <typename T>
+    inline void read(T * values, std::size_t offset) const
+    {
+        // The values may be unaligned
+        memcpy(values, m_data + offset, 2 * sizeof(T));
+        if (m_must_swap)
+        {
+            swap_words(reinterpret_cast<char*>(values), sizeof(T), 2);
+        }
+    }
+
+    char const* m_data;
+    pj_gi::format_t m_format;
+    bool m_must_swap;
+    boost::int32_t m_lam_count;
+};
+
 /************************************************************************/
 /*                        pj_gridinfo_parent()                          */
 /*                                                                      */
@@ -427,6 +427,60 @@ inline void pj_init_pm(srs::spar::parameters<Ps...> const& params, T& val)
         >::apply(params, val);
 }
 
+/************************************************************************/
+/*                            pj_init_ell()                             */
+/************************************************************************/
+
+// Set parameters of the predefined ellipsoid of static parameters,
+// calculated at compile time
+template <typename T, typename Params, int Id = pj_ell_static_id<T, Params>::value>
+struct pj_init_ell
+{
+    static void apply(Params const& , parameters<T> & pin)
+    {
+        typedef pj_ell_static<T, Id> ell;
+
+        constexpr T a = ell::a();
+        constexpr T es = ell::es();
+        constexpr T e = ell::e();
+        constexpr T ra = ell::ra();
+        constexpr T one_es = ell::one_es();
+        constexpr T rone_es = ell::rone_es();
+
+        BOOST_GEOMETRY_STATIC_ASSERT((one_es != 0),
+            "Invalid eccentricity of predefined ellipsoid.",
+            Params);
+
+        pin.a = pin.a_orig = a;
+        pin.es = pin.es_orig = es;
+        pin.e = e;
+        pin.ra = ra;
+        pin.one_es = one_es;
+        pin.rone_es = rone_es;
+    }
+};
+
+// Set ellipsoid/sphere parameters at run time
+template <typename T, typename Params>
+struct pj_init_ell<T, Params, -1>
+{
+    static void apply(Params const& params, parameters<T> & pin)
+    {
+        pj_ell_init(params, pin.a, pin.es);
+
+        pin.a_orig = pin.a;
+        pin.es_orig = pin.es;
+
+        pin.e = sqrt(pin.es);
+        pin.ra = 1. / pin.a;
+        pin.one_es = 1. - pin.es;
+        if (pin.one_es == 0.) {
+            BOOST_THROW_EXCEPTION( projection_exception(error_eccentricity_is_one) );
+        }
+        pin.rone_es = 1./pin.one_es;
+    }
+};
+
 /************************************************************************/
 /*                              pj_init()                               */
 /*                                                                      */
@@ -454,18 +508,7 @@ inline parameters<T> pj_init(Params const& params)
     pj_datum_init(params, pin);
 
     /* set ellipsoid/sphere parameters */
-    pj_ell_init(params, pin.a, pin.es);
-
-    pin.a_orig = pin.a;
-    pin.es_orig = pin.es;
-
-    pin.e = sqrt(pin.es);
-    pin.ra = 1. / pin.a;
-    pin.one_es = 1. - pin.es;
-    if (pin.one_es == 0.) {
-        BOOST_THROW_EXCEPTION( projection_exception(error_eccentricity_is_one) );
-    }
-    pin.rone_es = 1./pin.one_es;
+    pj_init_ell<T, Params>::apply(params, pin);
 
     /* Now that we have ellipse information check for WGS84 datum */
     if( pin.datum_type == datum_3param
@@ -41,6 +41,9 @@
 
 
 
+#include <cmath>
+#include <cstddef>
+
 #include <boost/geometry/srs/projections/impl/adjlon.hpp>
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/util/math.hpp>
@@ -53,31 +56,71 @@ namespace boost { namespace geometry { namespace projections
 namespace detail
 {
 
- /* inverse projection entry */
-template <typename PRJ, typename LL, typename XY, typename PAR>
-inline void pj_inv(PRJ const& prj, PAR const& par, XY const& xy, LL& ll)
+/* inverse projection of x / y to lon / lat in radians */
+template <typename PRJ, typename PAR, typename T>
+inline void pj_inv_xy(PRJ const& prj, PAR const& par, T const& x, T const& y, T& lon, T& lat)
 {
-    typedef typename PAR::type calc_t;
-    static const calc_t EPS = 1.0e-12;
+    static const T EPS = 1.0e-12;
 
     /* can't do as much preliminary checking as with forward */
     /* descale and de-offset */
-    calc_t xy_x = (geometry::get<0>(xy) * par.to_meter - par.x0) * par.ra;
-    calc_t xy_y = (geometry::get<1>(xy) * par.to_meter - par.y0) * par.ra;
-    calc_t lon = 0, lat = 0;
+    T xy_x = (x * par.to_meter - par.x0) * par.ra;
+    T xy_y = (y * par.to_meter - par.y0) * par.ra;
+    lon = 0;
+    lat = 0;
 
     prj.inv(par, xy_x, xy_y, lon, lat); /* inverse project */
     
     lon += par.lam0; /* reduce from del lp.lam */
     if (!par.over)
         lon = adjlon(lon); /* adjust longitude to CM */
-    if (par.geoc && geometry::math::abs(geometry::math::abs(lat)-geometry::math::half_pi<calc_t>()) > EPS)
+    if (par.geoc && geometry::math::abs(geometry::math::abs(lat)-geometry::math::half_pi<T>()) > EPS)
         lat = atan(par.one_es * tan(lat));
+}
+
+ /* inverse projection entry */
+template <typename PRJ, typename LL, typename XY, typename PAR>
+inline void pj_inv(PRJ const& prj, PAR const& par, XY const& xy, LL& ll)
+{
+    typedef typename PAR::type calc_t;
+
+    calc_t lon = 0, lat = 0;
+
+    pj_inv_xy(prj, par, calc_t(geometry::get<0>(xy)), calc_t(geometry::get<1>(xy)),
+              lon, lat);
 
     geometry::set_from_radian<0>(ll, lon);
     geometry::set_from_radian<1>(ll, lat);
 }
 
+/* inverse projection of count points, the i-th at index i * stride of the
+   arrays, lon / lat multiplied by from_radian, not projected points set to
+   HUGE_VAL */
+template <typename PRJ, typename PAR, typename T>
+inline bool pj_inv_n(PRJ const& prj, PAR const& par,
+                     T const* x, T const* y, T* lon, T* lat,
+                     std::size_t count, std::size_t stride, T const& from_radian)
+{
+    bool result = true;
+    for (std::size_t i = 0, j = 0; i < count; i++, j += stride)
+    {
+        try
+        {
+            T lp_lon = 0, lp_lat = 0;
+            pj_inv_xy(prj, par, x[j], y[j], lp_lon, lp_lat);
+            lon[j] = lp_lon * from_radian;
+            lat[j] = lp_lat * from_radian;
+        }
+        catch (...)
+        {
+            lon[j] = HUGE_VAL;
+            lat[j] = HUGE_VAL;
+            result = false;
+        }
+    }
+    return result;
+}
+
 } // namespace detail
 }}} // namespace boost::geometry::projections
 
@@ -49,6 +49,7 @@
 #include <cstdlib>
 
 #include <boost/geometry/srs/projections/exception.hpp>
+#include <boost/geometry/srs/projections/impl/pj_ell_set.hpp>
 #include <boost/geometry/srs/projections/impl/pj_strerrno.hpp>
 #include <boost/geometry/util/math.hpp>
 
@@ -62,36 +63,38 @@ struct en
 {
     static const std::size_t size = 5;
 
-    T const& operator[](size_t i) const { return data[i]; }
-    T & operator[](size_t i) { return data[i]; }
+    constexpr en() : data() {}
+
+    constexpr T const& operator[](size_t i) const { return data[i]; }
+    constexpr T & operator[](size_t i) { return data[i]; }
 
 private:
     T data[5];
 };
 
 template <typename T>
-inline en<T> pj_enfn(T const& es)
+constexpr en<T> pj_enfn(T const& es)
 {
-    static const T C00 = 1.;
-    static const T C02 = .25;
-    static const T C04 = .046875;
-    static const T C06 = .01953125;
-    static const T C08 = .01068115234375;
-    static const T C22 = .75;
-    static const T C44 = .46875;
-    static const T C46 = .01302083333333333333;
-    static const T C48 = .00712076822916666666;
-    static const T C66 = .36458333333333333333;
-    static const T C68 = .00569661458333333333;
-    static const T C88 = .3076171875;
-
-    T t;
+    T const C00 = 1.;
+    T const C02 = .25;
+    T const C04 = .046875;
+    T const C06 = .01953125;
+    T const C08 = .01068115234375;
+    T const C22 = .75;
+    T const C44 = .46875;
+    T const C46 = .01302083333333333333;
+    T const C48 = .00712076822916666666;
+    T const C66 = .36458333333333333333;
+    T const C68 = .00569661458333333333;
+    T const C88 = .3076171875;
+
+    T t = es * es;
     detail::en<T> en;
 
     {
         en[0] = C00 - es * (C02 + es * (C04 + es * (C06 + es * C08)));
         en[1] = es * (C22 - es * (C04 + es * (C06 + es * C08)));
-        en[2] = (t = es * es) * (C44 - es * (C46 + es * C48));
+        en[2] = t * (C44 - es * (C46 + es * C48));
         en[3] = (t *= es) * (C66 - es * C68);
         en[4] = t * es * C88;
     }
@@ -99,6 +102,37 @@ inline en<T> pj_enfn(T const& es)
     return en;
 }
 
+// The coefficients of the predefined ellipsoid of static parameters
+// are calculated at compile time
+template <typename T, typename Params, int Id = pj_ell_static_id<T, Params>::value>
+struct pj_enfn_static
+{
+    static en<T> apply(T const& es)
+    {
+        typedef pj_ell_static<T, Id> ell;
+        constexpr T ell_es = ell::es();
+        constexpr en<T> ell_en = pj_enfn(ell_es);
+
+        // es of parameters<T> may be modified by a projection
+        return es == ell_es ? ell_en : pj_enfn(es);
+    }
+};
+
+template <typename T, typename Params>
+struct pj_enfn_static<T, Params, -1>
+{
+    static en<T> apply(T const& es)
+    {
+        return pj_enfn(es);
+    }
+};
+
+template <typename T, typename Params>
+inline en<T> pj_enfn(Params const& , T const& es)
+{
+    return pj_enfn_static<T, Params>::apply(es);
+}
+
 template <typename T>
 inline T pj_mlfn(T const& phi, T sphi, T cphi, detail::en<T> const& en)
 {
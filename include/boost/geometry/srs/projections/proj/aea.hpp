@@ -122,16 +122,39 @@ namespace projections
 
                 // FORWARD(e_forward)  ellipsoid & spheroid
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
-                inline void fwd(Parameters const& par, T lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
+                inline void fwd(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    T rho = this->m_proj_parm.c - (this->m_proj_parm.ellips
-                                                                    ? this->m_proj_parm.n * pj_qsfn(sin(lp_lat), par.e, par.one_es)
-                                                                    : this->m_proj_parm.n2 * sin(lp_lat));
-                    if (rho < 0.)
+                    if (fwd_point(par, lp_lon, lp_lat, xy_x, xy_y)) {
                         BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
+                    }
+                }
+
+                // Projects one point, returns true if fwd fails for it. There are
+                // no branches, so the loop of fwd_n can be vectorized
+                inline bool fwd_point(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
+                {
+                    T const sinphi = sin(lp_lat);
+                    T rho = this->m_proj_parm.c - (this->m_proj_parm.ellips
+                                                    ? this->m_proj_parm.n * pj_qsfn(sinphi, par.e, par.one_es)
+                                                    : this->m_proj_parm.n2 * sinphi);
+                    bool const failed = rho < 0.;
                     rho = this->m_proj_parm.dd * sqrt(rho);
-                    xy_x = rho * sin( lp_lon *= this->m_proj_parm.n );
-                    xy_y = this->m_proj_parm.rho0 - rho * cos(lp_lon);
+                    T const lam = lp_lon * this->m_proj_parm.n;
+                    xy_x = rho * sin(lam);
+                    xy_y = this->m_proj_parm.rho0 - rho * cos(lam);
+                    return failed;
+                }
+
+                // Batch forward projection, marking the points fwd throws for
+                // in failed
+                inline void fwd_n(Parameters const& par, T const* lp_lon, T const* lp_lat,
+                                  T* xy_x, T* xy_y, unsigned char* failed,
+                                  std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        failed[i] |= fwd_point(par, lp_lon[i], lp_lat[i], xy_x[i], xy_y[i]);
+                    }
                 }
 
                 // INVERSE(e_inverse)  ellipsoid & spheroid
@@ -173,8 +196,8 @@ namespace projections
 
             };
 
-            template <typename Parameters, typename T>
-            inline void setup(Parameters const& par, par_aea<T>& proj_parm) 
+            template <typename Params, typename Parameters, typename T>
+            inline void setup(Params const& params, Parameters const& par, par_aea<T>& proj_parm) 
             {
                 T cosphi, sinphi;
                 int secant;
@@ -187,7 +210,7 @@ namespace projections
                 if( (proj_parm.ellips = (par.es > 0.))) {
                     T ml1, m1;
 
-                    proj_parm.en = pj_enfn<T>(par.es);
+                    proj_parm.en = pj_enfn<T>(params, par.es);
                     m1 = pj_msfn(sinphi, cosphi, par.es);
                     ml1 = pj_qsfn(sinphi, par.e, par.one_es);
                     if (secant) { /* secant cone */
@@ -238,7 +261,7 @@ namespace projections
                     }
                 }
 
-                setup(par, proj_parm);
+                setup(params, par, proj_parm);
             }
 
             // Lambert Equal Area Conic
@@ -249,7 +272,7 @@ namespace projections
 
                 proj_parm.phi2 = pj_get_param_r<T, srs::spar::lat_1>(params, "lat_1", srs::dpar::lat_1);
                 proj_parm.phi1 = pj_get_param_b<srs::spar::south>(params, "south", srs::dpar::south) ? -half_pi : half_pi;
-                setup(par, proj_parm);
+                setup(params, par, proj_parm);
             }
 
     }} // namespace detail::aea
@@ -306,7 +306,7 @@ namespace projections
                 if (is_sphere) {
                     /* empty */
                 } else {
-                    proj_parm.en = pj_enfn<T>(par.es);
+                    proj_parm.en = pj_enfn<T>(params, par.es);
                     if (is_guam) {
                         proj_parm.M1 = pj_mlfn(par.phi0, proj_parm.sinph0, proj_parm.cosph0, proj_parm.en);
                     } else {
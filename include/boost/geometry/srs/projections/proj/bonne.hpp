@@ -174,7 +174,7 @@ namespace projections
                     BOOST_THROW_EXCEPTION( projection_exception(error_lat1_is_zero) );
 
                 if (par.es != 0.0) {
-                    proj_parm.en = pj_enfn<T>(par.es);
+                    proj_parm.en = pj_enfn<T>(params, par.es);
                     proj_parm.m1 = pj_mlfn(proj_parm.phi1, proj_parm.am1 = sin(proj_parm.phi1),
                         c = cos(proj_parm.phi1), proj_parm.en);
                     proj_parm.am1 = c / (sqrt(1. - par.es * proj_parm.am1 * proj_parm.am1) * proj_parm.am1);
@@ -170,11 +170,11 @@ namespace projections
             };
 
             // Cassini
-            template <typename Parameters, typename T>
-            inline void setup_cass(Parameters& par, par_cass<T>& proj_parm)
+            template <typename Params, typename Parameters, typename T>
+            inline void setup_cass(Params const& params, Parameters& par, par_cass<T>& proj_parm)
             {
                 if (par.es) {
-                    proj_parm.en = pj_enfn<T>(par.es);
+                    proj_parm.en = pj_enfn<T>(params, par.es);
                     proj_parm.m0 = pj_mlfn(par.phi0, sin(par.phi0), cos(par.phi0), proj_parm.en);
                 } else {
                 }
@@ -200,9 +200,9 @@ namespace projections
     struct cass_ellipsoid : public detail::cass::base_cass_ellipsoid<T, Parameters>
     {
         template <typename Params>
-        inline cass_ellipsoid(Params const& , Parameters const& par)
+        inline cass_ellipsoid(Params const& params, Parameters const& par)
         {
-            detail::cass::setup_cass(par, this->m_proj_parm);
+            detail::cass::setup_cass(params, par, this->m_proj_parm);
         }
     };
 
@@ -223,9 +223,9 @@ namespace projections
     struct cass_spheroid : public detail::cass::base_cass_spheroid<T, Parameters>
     {
         template <typename Params>
-        inline cass_spheroid(Params const& , Parameters const& par)
+        inline cass_spheroid(Params const& params, Parameters const& par)
         {
-            detail::cass::setup_cass(par, this->m_proj_parm);
+            detail::cass::setup_cass(params, par, this->m_proj_parm);
         }
     };
 
@@ -136,7 +136,7 @@ namespace projections
                 if (fabs(proj_parm.phi1 + proj_parm.phi2) < epsilon10)
                     BOOST_THROW_EXCEPTION( projection_exception(error_conic_lat_equal) );
 
-                proj_parm.en = pj_enfn<T>(par.es);
+                proj_parm.en = pj_enfn<T>(params, par.es);
 
                 proj_parm.n = sinphi = sin(proj_parm.phi1);
                 cosphi = cos(proj_parm.phi1);
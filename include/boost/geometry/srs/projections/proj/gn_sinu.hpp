@@ -188,10 +188,10 @@ namespace projections
             }
 
             // Sinusoidal (Sanson-Flamsteed)
-            template <typename Parameters, typename T>
-            inline void setup_sinu(Parameters const& par, par_gn_sinu_e<T>& proj_parm)
+            template <typename Params, typename Parameters, typename T>
+            inline void setup_sinu(Params const& params, Parameters const& par, par_gn_sinu_e<T>& proj_parm)
             {
-                proj_parm.en = pj_enfn<T>(par.es);
+                proj_parm.en = pj_enfn<T>(params, par.es);
             }
 
             // Sinusoidal (Sanson-Flamsteed)
@@ -266,9 +266,9 @@ namespace projections
     struct sinu_ellipsoid : public detail::gn_sinu::base_gn_sinu_ellipsoid<T, Parameters>
     {
         template <typename Params>
-        inline sinu_ellipsoid(Params const& , Parameters & par)
+        inline sinu_ellipsoid(Params const& params, Parameters & par)
         {
-            detail::gn_sinu::setup_sinu(par, this->m_proj_parm);
+            detail::gn_sinu::setup_sinu(params, par, this->m_proj_parm);
         }
     };
 
@@ -215,7 +215,7 @@ namespace projections
                 T del, sig, s, t, x1, x2, T2, y1, m1, m2, y2;
                 int err;
 
-                proj_parm.en = pj_enfn<T>(par.es);
+                proj_parm.en = pj_enfn<T>(params, par.es);
                 if( (err = phi12(params, proj_parm, &del, &sig)) != 0)
                     BOOST_THROW_EXCEPTION( projection_exception(err) );
                 if (proj_parm.phi_2 < proj_parm.phi_1) { /* make sure proj_parm.phi_1 most southerly */
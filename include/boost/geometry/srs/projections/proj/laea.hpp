@@ -92,61 +92,56 @@ namespace projections
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
                 inline void fwd(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    static const T half_pi = detail::half_pi<T>();
-
-                    T coslam, sinlam, sinphi, q, sinb=0.0, cosb=0.0, b=0.0;
-
-                    coslam = cos(lp_lon);
-                    sinlam = sin(lp_lon);
-                    sinphi = sin(lp_lat);
-                    q = pj_qsfn(sinphi, par.e, par.one_es);
-
-                    if (this->m_proj_parm.mode == obliq || this->m_proj_parm.mode == equit) {
-                        sinb = q / this->m_proj_parm.qp;
-                        cosb = sqrt(1. - sinb * sinb);
-                    }
-
-                    switch (this->m_proj_parm.mode) {
-                    case obliq:
-                        b = 1. + this->m_proj_parm.sinb1 * sinb + this->m_proj_parm.cosb1 * cosb * coslam;
-                        break;
-                    case equit:
-                        b = 1. + cosb * coslam;
-                        break;
-                    case n_pole:
-                        b = half_pi + lp_lat;
-                        q = this->m_proj_parm.qp - q;
-                        break;
-                    case s_pole:
-                        b = lp_lat - half_pi;
-                        q = this->m_proj_parm.qp + q;
-                        break;
-                    }
-                    if (fabs(b) < epsilon10) {
+                    if (fwd_point(par, lp_lon, lp_lat, xy_x, xy_y)) {
                         BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
                     }
+                }
 
-                    switch (this->m_proj_parm.mode) {
-                    case obliq:
+                // Projects one point, returns true if fwd fails for it. The mode is
+                // the same for all points, so only the conditions depending on the
+                // point are selected, and the loop of fwd_n can be vectorized
+                inline bool fwd_point(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
+                {
+                    T const half_pi = detail::half_pi<T>();
+
+                    T const coslam = cos(lp_lon);
+                    T const sinlam = sin(lp_lon);
+                    T const sinphi = sin(lp_lat);
+                    T q = pj_qsfn(sinphi, par.e, par.one_es);
+                    mode_type const mode = this->m_proj_parm.mode;
+
+                    if (mode == obliq || mode == equit) {
+                        T const sinb = q / this->m_proj_parm.qp;
+                        T const cosb = sqrt(1. - sinb * sinb);
+                        T b = mode == obliq
+                            ? 1. + this->m_proj_parm.sinb1 * sinb + this->m_proj_parm.cosb1 * cosb * coslam
+                            : 1. + cosb * coslam;
+                        bool const failed = fabs(b) < epsilon10;
                         b = sqrt(2. / b);
-                        xy_y = this->m_proj_parm.ymf * b * (this->m_proj_parm.cosb1 * sinb - this->m_proj_parm.sinb1 * cosb * coslam);
-                        goto eqcon;
-                        break;
-                    case equit:
-                        b = sqrt(2. / (1. + cosb * coslam));
-                        xy_y = b * sinb * this->m_proj_parm.ymf;
-                eqcon:
+                        xy_y = mode == obliq
+                            ? this->m_proj_parm.ymf * b * (this->m_proj_parm.cosb1 * sinb - this->m_proj_parm.sinb1 * cosb * coslam)
+                            : b * sinb * this->m_proj_parm.ymf;
                         xy_x = this->m_proj_parm.xmf * b * cosb * sinlam;
-                        break;
-                    case n_pole:
-                    case s_pole:
-                        if (q >= 0.) {
-                            b = sqrt(q);
-                            xy_x = b * sinlam;
-                            xy_y = coslam * (this->m_proj_parm.mode == s_pole ? b : -b);
-                        } else
-                            xy_x = xy_y = 0.;
-                        break;
+                        return failed;
+                    }
+
+                    T const b = mode == n_pole ? half_pi + lp_lat : lp_lat - half_pi;
+                    q = mode == n_pole ? this->m_proj_parm.qp - q : this->m_proj_parm.qp + q;
+                    T const r = sqrt(q);
+                    xy_x = q >= 0. ? r * sinlam : T(0);
+                    xy_y = q >= 0. ? coslam * (mode == s_pole ? r : -r) : T(0);
+                    return fabs(b) < epsilon10;
+                }
+
+                // Batch forward projection, marking the points fwd throws for
+                // in failed
+                inline void fwd_n(Parameters const& par, T const* lp_lon, T const* lp_lat,
+                                  T* xy_x, T* xy_y, unsigned char* failed,
+                                  std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        failed[i] |= fwd_point(par, lp_lon[i], lp_lat[i], xy_x[i], xy_y[i]);
                     }
                 }
 
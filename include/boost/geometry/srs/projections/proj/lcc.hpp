@@ -81,26 +81,41 @@ namespace projections
 
                 // FORWARD(e_forward)  ellipsoid & spheroid
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
-                inline void fwd(Parameters const& par, T lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
+                inline void fwd(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    static const T fourth_pi = detail::fourth_pi<T>();
-                    static const T half_pi = detail::half_pi<T>();
+                    if (fwd_point(par, lp_lon, lp_lat, xy_x, xy_y)) {
+                        BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
+                    }
+                }
 
-                    T rho;
+                // Projects one point, returns true if fwd fails for it. The pole
+                // case is selected, not branched, so the loop of fwd_n can be
+                // vectorized
+                inline bool fwd_point(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
+                {
+                    T const fourth_pi = detail::fourth_pi<T>();
+                    T const half_pi = detail::half_pi<T>();
+
+                    bool const pole = fabs(fabs(lp_lat) - half_pi) < epsilon10;
+                    T const rho = pole ? T(0) : this->m_proj_parm.c * (this->m_proj_parm.ellips
+                        ? math::pow(pj_tsfn(lp_lat, sin(lp_lat), par.e), this->m_proj_parm.n)
+                        : math::pow(tan(fourth_pi + T(0.5) * lp_lat), -this->m_proj_parm.n));
+                    T const lam = lp_lon * this->m_proj_parm.n;
+                    xy_x = par.k0 * (rho * sin( lam) );
+                    xy_y = par.k0 * (this->m_proj_parm.rho0 - rho * cos(lam) );
+                    return pole && (lp_lat * this->m_proj_parm.n) <= 0.;
+                }
 
-                    if (fabs(fabs(lp_lat) - half_pi) < epsilon10) {
-                        if ((lp_lat * this->m_proj_parm.n) <= 0.) {
-                            BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
-                        }
-                        rho = 0.;
-                    } else {
-                        rho = this->m_proj_parm.c * (this->m_proj_parm.ellips
-                            ? math::pow(pj_tsfn(lp_lat, sin(lp_lat), par.e), this->m_proj_parm.n)
-                            : math::pow(tan(fourth_pi + T(0.5) * lp_lat), -this->m_proj_parm.n));
+                // Batch forward projection, marking the points fwd throws for
+                // in failed
+                inline void fwd_n(Parameters const& par, T const* lp_lon, T const* lp_lat,
+                                  T* xy_x, T* xy_y, unsigned char* failed,
+                                  std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        failed[i] |= fwd_point(par, lp_lon[i], lp_lat[i], xy_x[i], xy_y[i]);
                     }
-                    lp_lon *= this->m_proj_parm.n;
-                    xy_x = par.k0 * (rho * sin( lp_lon) );
-                    xy_y = par.k0 * (this->m_proj_parm.rho0 - rho * cos(lp_lon) );
                 }
 
                 // INVERSE(e_inverse)  ellipsoid & spheroid
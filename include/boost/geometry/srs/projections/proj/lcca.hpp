@@ -174,12 +174,12 @@ namespace projections
             };
 
             // Lambert Conformal Conic Alternative
-            template <typename Parameters, typename T>
-            inline void setup_lcca(Parameters const& par, par_lcca<T>& proj_parm)
+            template <typename Params, typename Parameters, typename T>
+            inline void setup_lcca(Params const& params, Parameters const& par, par_lcca<T>& proj_parm)
             {
                 T s2p0, N0, R0, tan0;
 
-                proj_parm.en = pj_enfn<T>(par.es);
+                proj_parm.en = pj_enfn<T>(params, par.es);
                 
                 if (par.phi0 == 0.) {
                     BOOST_THROW_EXCEPTION( projection_exception(error_lat_0_is_zero) );
@@ -217,9 +217,9 @@ namespace projections
     struct lcca_ellipsoid : public detail::lcca::base_lcca_ellipsoid<T, Parameters>
     {
         template <typename Params>
-        inline lcca_ellipsoid(Params const& , Parameters const& par)
+        inline lcca_ellipsoid(Params const& params, Parameters const& par)
         {
-            detail::lcca::setup_lcca(par, this->m_proj_parm);
+            detail::lcca::setup_lcca(params, par, this->m_proj_parm);
         }
     };
 
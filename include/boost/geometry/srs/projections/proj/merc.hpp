@@ -69,13 +69,32 @@ namespace projections
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
                 inline void fwd(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    static const T half_pi = detail::half_pi<T>();
-
-                    if (fabs(fabs(lp_lat) - half_pi) <= epsilon10) {
+                    if (fwd_point(par, lp_lon, lp_lat, xy_x, xy_y)) {
                         BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
                     }
+                }
+
+                // Projects one point, returns true if fwd fails for it. There are
+                // no branches, so the loop of fwd_n can be vectorized
+                inline bool fwd_point(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
+                {
+                    T const half_pi = detail::half_pi<T>();
+
                     xy_x = par.k0 * lp_lon;
                     xy_y = - par.k0 * log(pj_tsfn(lp_lat, sin(lp_lat), par.e));
+                    return fabs(fabs(lp_lat) - half_pi) <= epsilon10;
+                }
+
+                // Batch forward projection, marking the points fwd throws for
+                // in failed
+                inline void fwd_n(Parameters const& par, T const* lp_lon, T const* lp_lat,
+                                  T* xy_x, T* xy_y, unsigned char* failed,
+                                  std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        failed[i] |= fwd_point(par, lp_lon[i], lp_lat[i], xy_x[i], xy_y[i]);
+                    }
                 }
 
                 // INVERSE(e_inverse)  ellipsoid
@@ -102,14 +121,33 @@ namespace projections
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
                 inline void fwd(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    static const T half_pi = detail::half_pi<T>();
-                    static const T fourth_pi = detail::fourth_pi<T>();
-
-                    if (fabs(fabs(lp_lat) - half_pi) <= epsilon10) {
+                    if (fwd_point(par, lp_lon, lp_lat, xy_x, xy_y)) {
                         BOOST_THROW_EXCEPTION( projection_exception(error_tolerance_condition) );
                     }
+                }
+
+                // Projects one point, returns true if fwd fails for it. There are
+                // no branches, so the loop of fwd_n can be vectorized
+                inline bool fwd_point(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
+                {
+                    T const half_pi = detail::half_pi<T>();
+                    T const fourth_pi = detail::fourth_pi<T>();
+
                     xy_x = par.k0 * lp_lon;
                     xy_y = par.k0 * log(tan(fourth_pi + .5 * lp_lat));
+                    return fabs(fabs(lp_lat) - half_pi) <= epsilon10;
+                }
+
+                // Batch forward projection, marking the points fwd throws for
+                // in failed
+                inline void fwd_n(Parameters const& par, T const* lp_lon, T const* lp_lat,
+                                  T* xy_x, T* xy_y, unsigned char* failed,
+                                  std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        failed[i] |= fwd_point(par, lp_lon[i], lp_lat[i], xy_x[i], xy_y[i]);
+                    }
                 }
 
                 // INVERSE(s_inverse)  spheroid
@@ -192,11 +192,11 @@ namespace projections
             };
 
             // Polyconic (American)
-            template <typename Parameters, typename T>
-            inline void setup_poly(Parameters const& par, par_poly<T>& proj_parm)
+            template <typename Params, typename Parameters, typename T>
+            inline void setup_poly(Params const& params, Parameters const& par, par_poly<T>& proj_parm)
             {
                 if (par.es != 0.0) {
-                    proj_parm.en = pj_enfn<T>(par.es);
+                    proj_parm.en = pj_enfn<T>(params, par.es);
                     proj_parm.ml0 = pj_mlfn(par.phi0, sin(par.phi0), cos(par.phi0), proj_parm.en);
                 } else {
                     proj_parm.ml0 = -par.phi0;
@@ -223,9 +223,9 @@ namespace projections
     struct poly_ellipsoid : public detail::poly::base_poly_ellipsoid<T, Parameters>
     {
         template <typename Params>
-        inline poly_ellipsoid(Params const& , Parameters const& par)
+        inline poly_ellipsoid(Params const& params, Parameters const& par)
         {
-            detail::poly::setup_poly(par, this->m_proj_parm);
+            detail::poly::setup_poly(params, par, this->m_proj_parm);
         }
     };
 
@@ -246,9 +246,9 @@ namespace projections
     struct poly_spheroid : public detail::poly::base_poly_spheroid<T, Parameters>
     {
         template <typename Params>
-        inline poly_spheroid(Params const& , Parameters const& par)
+        inline poly_spheroid(Params const& params, Parameters const& par)
         {
-            detail::poly::setup_poly(par, this->m_proj_parm);
+            detail::poly::setup_poly(params, par, this->m_proj_parm);
         }
     };
 
@@ -98,51 +98,71 @@ namespace projections
 
                 // FORWARD(e_forward)  ellipsoid
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
-                inline void fwd(Parameters const& par, T const& lp_lon, T lp_lat, T& xy_x, T& xy_y) const
+                inline void fwd(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    static const T half_pi = detail::half_pi<T>();
-
-                    T coslam, sinlam, sinX=0.0, cosX=0.0, X, A = 0.0, sinphi;
-
-                    coslam = cos(lp_lon);
-                    sinlam = sin(lp_lon);
-                    sinphi = sin(lp_lat);
-                    if (this->m_proj_parm.mode == obliq || this->m_proj_parm.mode == equit) {
-                        sinX = sin(X = 2. * atan(ssfn_(lp_lat, sinphi, par.e)) - half_pi);
-                        cosX = cos(X);
-                    }
-                    switch (this->m_proj_parm.mode) {
-                    case obliq:
-                        A = this->m_proj_parm.akm1 / (this->m_proj_parm.cosX1 * (1. + this->m_proj_parm.sinX1 * sinX +
-                           this->m_proj_parm.cosX1 * cosX * coslam));
-                        xy_y = A * (this->m_proj_parm.cosX1 * sinX - this->m_proj_parm.sinX1 * cosX * coslam);
-                        goto xmul; /* but why not just  xy.x = A * cosX; break;  ? */
+                    fwd_point(par, lp_lon, lp_lat, xy_x, xy_y);
+                }
 
-                    case equit:
-                        // TODO: calculate denominator once
-                        /* avoid zero division */
-                        if (1. + cosX * coslam == 0.0) {
-                            xy_y = HUGE_VAL;
+                // Projects one point, never fails. The mode is the same for all
+                // points, the equatorial division by zero is selected per point,
+                // so the loop of fwd_n can be vectorized
+                inline bool fwd_point(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
+                {
+                    T const half_pi = detail::half_pi<T>();
+
+                    T coslam = cos(lp_lon);
+                    T const sinlam = sin(lp_lon);
+                    T phi = lp_lat;
+                    T sinphi = sin(phi);
+                    T const akm1 = this->m_proj_parm.akm1;
+                    T const sinX1 = this->m_proj_parm.sinX1;
+                    T const cosX1 = this->m_proj_parm.cosX1;
+                    mode_type const mode = this->m_proj_parm.mode;
+                    T x, y;
+
+                    if (mode == obliq || mode == equit) {
+                        // ssfn_, without its function local constant
+                        T const esinphi = par.e * sinphi;
+                        T const ssfn = tan (.5 * (half_pi + phi)) *
+                           math::pow((T(1) - esinphi) / (T(1) + esinphi), T(0.5) * par.e);
+                        T const X = 2. * atan(ssfn) - half_pi;
+                        T const sinX = sin(X);
+                        T const cosX = cos(X);
+                        if (mode == obliq) {
+                            T const A = akm1 / (cosX1 * (1. + sinX1 * sinX + cosX1 * cosX * coslam));
+                            y = A * (cosX1 * sinX - sinX1 * cosX * coslam);
+                            x = A * cosX;
                         } else {
-                            A = this->m_proj_parm.akm1 / (1. + cosX * coslam);
-                            xy_y = A * sinX;
+                            /* avoid zero division */
+                            bool const zero = 1. + cosX * coslam == 0.0;
+                            T const A = zero ? T(0) : akm1 / (1. + cosX * coslam);
+                            y = zero ? T(HUGE_VAL) : A * sinX;
+                            x = A * cosX;
                         }
-                xmul:
-                        xy_x = A * cosX;
-                        break;
-
-                    case s_pole:
-                        lp_lat = -lp_lat;
-                        coslam = - coslam;
-                        sinphi = -sinphi;
-                        BOOST_FALLTHROUGH;
-                    case n_pole:
-                        xy_x = this->m_proj_parm.akm1 * pj_tsfn(lp_lat, sinphi, par.e);
-                        xy_y = - xy_x * coslam;
-                        break;
+                    } else {
+                        if (mode == s_pole) {
+                            phi = -phi;
+                            coslam = - coslam;
+                            sinphi = -sinphi;
+                        }
+                        x = akm1 * pj_tsfn(phi, sinphi, par.e);
+                        y = - x * coslam;
                     }
 
-                    xy_x = xy_x * sinlam;
+                    xy_x = x * sinlam;
+                    xy_y = y;
+                    return false;
+                }
+
+                // Batch forward projection, fwd never throws
+                inline void fwd_n(Parameters const& par, T const* lp_lon, T const* lp_lat,
+                                  T* xy_x, T* xy_y, unsigned char* ,
+                                  std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        fwd_point(par, lp_lon[i], lp_lat[i], xy_x[i], xy_y[i]);
+                    }
                 }
 
                 // INVERSE(e_inverse)  ellipsoid
@@ -95,18 +95,6 @@ namespace projections
                 // Project coordinates from geographic (lon, lat) to cartesian (x, y)
                 inline void fwd(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
                 {
-                    static const T half_pi = detail::half_pi<T>();
-                    static const T FC1 = tmerc::FC1<T>();
-                    static const T FC2 = tmerc::FC2<T>();
-                    static const T FC3 = tmerc::FC3<T>();
-                    static const T FC4 = tmerc::FC4<T>();
-                    static const T FC5 = tmerc::FC5<T>();
-                    static const T FC6 = tmerc::FC6<T>();
-                    static const T FC7 = tmerc::FC7<T>();
-                    static const T FC8 = tmerc::FC8<T>();
-
-                    T al, als, n, cosphi, sinphi, t;
-
                     /*
                      * Fail if our longitude is more than 90 degrees from the
                      * central meridian since the results are essentially garbage.
@@ -114,22 +102,36 @@ namespace projections
                      *
                      *  http://trac.osgeo.org/proj/ticket/5
                      */
-                    if( lp_lon < -half_pi || lp_lon > half_pi )
+                    if (fwd_point(par, lp_lon, lp_lat, xy_x, xy_y))
                     {
                         xy_x = HUGE_VAL;
                         xy_y = HUGE_VAL;
                         BOOST_THROW_EXCEPTION( projection_exception(error_lat_or_lon_exceed_limit) );
-                        return;
                     }
+                }
 
-                    sinphi = sin(lp_lat);
-                    cosphi = cos(lp_lat);
-                    t = fabs(cosphi) > 1e-10 ? sinphi/cosphi : 0.;
+                // Projects one point, returns true if fwd fails for it. There are
+                // no branches, so the loop of fwd_n can be vectorized
+                inline bool fwd_point(Parameters const& par, T const& lp_lon, T const& lp_lat, T& xy_x, T& xy_y) const
+                {
+                    T const half_pi = detail::half_pi<T>();
+                    T const FC1 = tmerc::FC1<T>();
+                    T const FC2 = tmerc::FC2<T>();
+                    T const FC3 = tmerc::FC3<T>();
+                    T const FC4 = tmerc::FC4<T>();
+                    T const FC5 = tmerc::FC5<T>();
+                    T const FC6 = tmerc::FC6<T>();
+                    T const FC7 = tmerc::FC7<T>();
+                    T const FC8 = tmerc::FC8<T>();
+
+                    T const sinphi = sin(lp_lat);
+                    T const cosphi = cos(lp_lat);
+                    T t = fabs(cosphi) > 1e-10 ? sinphi/cosphi : 0.;
                     t *= t;
-                    al = cosphi * lp_lon;
-                    als = al * al;
+                    T al = cosphi * lp_lon;
+                    T const als = al * al;
                     al /= sqrt(1. - par.es * sinphi * sinphi);
-                    n = this->m_proj_parm.esp * cosphi * cosphi;
+                    T const n = this->m_proj_parm.esp * cosphi * cosphi;
                     xy_x = par.k0 * al * (FC1 +
                         FC3 * als * (1. - t + n +
                         FC5 * als * (5. + t * (t - 18.) + n * (14. - 58. * t)
@@ -141,6 +143,19 @@ namespace projections
                         FC6 * als * (61. + t * (t - 58.) + n * (270. - 330 * t)
                         + FC8 * als * (1385. + t * ( t * (543. - t) - 3111.) )
                         ))));
+                    return lp_lon < -half_pi || lp_lon > half_pi;
+                }
+
+                // Batch forward projection, marking the points fwd throws for
+                // in failed
+                inline void fwd_n(Parameters const& par, T const* lp_lon, T const* lp_lat,
+                                  T* xy_x, T* xy_y, unsigned char* failed,
+                                  std::size_t count) const
+                {
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        failed[i] |= fwd_point(par, lp_lon[i], lp_lat[i], xy_x[i], xy_y[i]);
+                    }
                 }
 
                 // INVERSE(e_inverse)  ellipsoid
@@ -266,11 +281,11 @@ namespace projections
 
             };
 
-            template <typename Parameters, typename T>
-            inline void setup(Parameters const& par, par_tmerc<T>& proj_parm)
+            template <typename Params, typename Parameters, typename T>
+            inline void setup(Params const& params, Parameters const& par, par_tmerc<T>& proj_parm)
             {
                 if (par.es != 0.0) {
-                    proj_parm.en = pj_enfn<T>(par.es);
+                    proj_parm.en = pj_enfn<T>(params, par.es);
                     proj_parm.ml0 = pj_mlfn(par.phi0, sin(par.phi0), cos(par.phi0), proj_parm.en);
                     proj_parm.esp = par.es / (1. - par.es);
                 } else {
@@ -299,9 +314,9 @@ namespace projections
     struct tmerc_ellipsoid : public detail::tmerc::base_tmerc_ellipsoid<T, Parameters>
     {
         template <typename Params>
-        inline tmerc_ellipsoid(Params const&, Parameters const& par)
+        inline tmerc_ellipsoid(Params const& params, Parameters const& par)
         {
-            detail::tmerc::setup(par, this->m_proj_parm);
+            detail::tmerc::setup(params, par, this->m_proj_parm);
         }
     };
 
@@ -322,9 +337,9 @@ namespace projections
     struct tmerc_spheroid : public detail::tmerc::base_tmerc_spheroid<T, Parameters>
     {
         template <typename Params>
-        inline tmerc_spheroid(Params const&, Parameters const& par)
+        inline tmerc_spheroid(Params const& params, Parameters const& par)
         {
-            detail::tmerc::setup(par, this->m_proj_parm);
+            detail::tmerc::setup(params, par, this->m_proj_parm);
         }
     };
 
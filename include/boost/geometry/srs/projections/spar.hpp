@@ -533,6 +533,7 @@ template <typename E>
 struct ellps_traits
 {
     static const bool is_specialized = false;
+    static const int id = -1;
     template <typename T> struct model_type
     {
         typedef void type;
@@ -543,6 +544,8 @@ template <typename E>
 struct ellps_traits<spar::ellps<E> >
 {
     static const bool is_specialized = true;
+    // not predefined
+    static const int id = -1;
     template <typename T> struct model_type
     {
         // TODO: transform to spheroid<T> or sphere<T>
@@ -563,14 +566,15 @@ template <> \
 struct ellps_traits<spar::NAME> \
 { \
     static const bool is_specialized = true; \
+    static const int id = dpar::NAME; \
     template <typename T> struct model_type \
     { \
         typedef srs::spheroid<T> type; \
     }; \
     template <typename T> \
     static srs::spheroid<T> model(spar::NAME const&) { \
-        return srs::spheroid<T>(projections::detail::pj_get_ellps<T>().first[dpar::NAME].a, \
-                                projections::detail::pj_get_ellps<T>().first[dpar::NAME].b); \
+        return srs::spheroid<T>(T(projections::detail::pj_ellps_a(dpar::NAME)), \
+                                T(projections::detail::pj_ellps_b(dpar::NAME))); \
     } \
 };
 
@@ -579,13 +583,14 @@ template <> \
 struct ellps_traits<spar::NAME> \
 { \
     static const bool is_specialized = true; \
+    static const int id = dpar::NAME; \
     template <typename T> struct model_type \
     { \
         typedef srs::sphere<T> type; \
     }; \
     template <typename T> \
     static srs::sphere<T> model(spar::NAME const&) { \
-        return srs::sphere<T>(projections::detail::pj_get_ellps<T>().first[dpar::NAME].a); \
+        return srs::sphere<T>(T(projections::detail::pj_ellps_a(dpar::NAME))); \
     } \
 };
 
@@ -0,0 +1,292 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_SNAPSHOT_GRIDS_HPP
+#define BOOST_GEOMETRY_SRS_SNAPSHOT_GRIDS_HPP
+
+
+#include <boost/geometry/srs/projections/grids.hpp>
+#include <boost/geometry/srs/projections/impl/pj_apply_gridshift.hpp>
+#include <boost/geometry/srs/projections/impl/pj_gridinfo.hpp>
+#include <boost/geometry/srs/projections/impl/pj_gridlist.hpp>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+/*!
+    \brief Grids which can be used by multiple threads without locking
+        the transformed points
+    \details The list of grids is published as an immutable snapshot,
+        replaced when a grid file is added by initialize_grids(). The shift
+        values of a grid are loaded on first use and published once, they
+        are never replaced. Readers only load atomic pointers, a mutex is
+        locked only to add a grid file or to publish loaded values.
+        Replaced snapshots are released at destruction, they only store
+        the headers of the grids.
+    \ingroup projection
+*/
+class snapshot_grids
+{
+    typedef projections::detail::pj_gridinfo gridinfo_type;
+    typedef projections::detail::pj_gi gi_type;
+    typedef projections::detail::pj_ctable::flp_t cell_type;
+
+public:
+    snapshot_grids()
+        : m_gridinfo(NULL)
+    {
+        m_snapshots.push_back(std::unique_ptr<gridinfo_type>(new gridinfo_type()));
+        m_gridinfo.store(m_snapshots.back().get(), std::memory_order_release);
+    }
+
+    std::size_t size() const
+    {
+        return m_gridinfo.load(std::memory_order_acquire)->size();
+    }
+
+    bool empty() const
+    {
+        return m_gridinfo.load(std::memory_order_acquire)->empty();
+    }
+
+    typedef projections::detail::snapshot_grids_tag tag;
+
+    struct read_snapshot
+    {
+        read_snapshot(snapshot_grids const& g)
+            : gridinfo(*g.m_gridinfo.load(std::memory_order_acquire))
+        {}
+
+        // never modified once published
+        gridinfo_type & gridinfo;
+    };
+
+    struct write_locked
+    {
+    private:
+        snapshot_grids & m_grids;
+        std::lock_guard<std::mutex> m_lock;
+
+    public:
+        write_locked(snapshot_grids & g)
+            : m_grids(g)
+            , m_lock(g.m_mutex)
+            , gridinfo(*g.m_gridinfo.load(std::memory_order_acquire))
+        {}
+
+        // Publish the snapshot of gridinfo extended by new_grids
+        void publish(gridinfo_type & new_grids)
+        {
+            for (std::size_t i = 0 ; i < new_grids.size() ; ++i)
+            {
+                assign_slots(new_grids[i]);
+            }
+
+            std::unique_ptr<gridinfo_type> next(new gridinfo_type(gridinfo));
+            next->insert(next->end(), new_grids.begin(), new_grids.end());
+            m_grids.m_gridinfo.store(next.get(), std::memory_order_release);
+            m_grids.m_snapshots.push_back(std::move(next));
+        }
+
+        // Publish the loaded shift values of gi unless other thread
+        // already published them, returns the published values
+        cell_type const* publish_cvs(gi_type const& gi, std::vector<cell_type> & cvs)
+        {
+            cell_type const* published = gi.published_cvs->load(std::memory_order_acquire);
+            if (published == NULL)
+            {
+                m_grids.m_cvs.emplace_back();
+                m_grids.m_cvs.back().swap(cvs);
+                published = m_grids.m_cvs.back().data();
+                gi.published_cvs->store(published, std::memory_order_release);
+            }
+            return published;
+        }
+
+        // the current snapshot
+        gridinfo_type const& gridinfo;
+
+    private:
+        void assign_slots(gi_type & gi)
+        {
+            m_grids.m_slots.emplace_back(static_cast<cell_type const*>(NULL));
+            gi.published_cvs = &m_grids.m_slots.back();
+            for (std::size_t i = 0 ; i < gi.children.size() ; ++i)
+            {
+                assign_slots(gi.children[i]);
+            }
+        }
+    };
+
+private:
+    snapshot_grids(snapshot_grids const&);
+    snapshot_grids & operator=(snapshot_grids const&);
+
+    std::atomic<gridinfo_type *> m_gridinfo;
+
+    // The elements of deques are never moved, readers use them directly
+    std::vector<std::unique_ptr<gridinfo_type> > m_snapshots;
+    std::deque<std::atomic<cell_type const*> > m_slots;
+    std::deque<std::vector<cell_type> > m_cvs;
+    std::mutex m_mutex;
+};
+
+
+} // namespace srs
+
+
+namespace projections { namespace detail
+{
+
+// Generic stream policy and snapshot grids
+template <typename StreamPolicy, typename SnapshotGrids>
+inline bool pj_gridlist_merge_gridfile(std::string const& gridname,
+                                       StreamPolicy const& stream_policy,
+                                       SnapshotGrids & grids,
+                                       std::vector<std::size_t> & gridindexes,
+                                       snapshot_grids_tag)
+{
+    // Try to find in the existing list of loaded grids.  Add all
+    // matching grids as with NTv2 we can get many grids from one
+    // file (one shared gridname).
+    {
+        typename SnapshotGrids::read_snapshot snp_grids(grids);
+
+        if (pj_gridlist_find_all(gridname, snp_grids.gridinfo, gridindexes))
+            return true;
+    }
+
+    // Try to load the named grid.
+    typename StreamPolicy::stream_type is;
+    stream_policy.open(is, gridname);
+
+    pj_gridinfo new_grids;
+
+    if (! pj_gridinfo_init(gridname, is, new_grids))
+    {
+        return false;
+    }
+
+    // Add the grid now that it is loaded.
+
+    std::size_t orig_size = 0;
+    std::size_t new_size = 0;
+
+    {
+        typename SnapshotGrids::write_locked lck_grids(grids);
+
+        // Try to find in the existing list of loaded grids again
+        // in case other thread already added it.
+        if (pj_gridlist_find_all(gridname, lck_grids.gridinfo, gridindexes))
+            return true;
+
+        orig_size = lck_grids.gridinfo.size();
+        new_size = orig_size + new_grids.size();
+
+        lck_grids.publish(new_grids);
+    }
+
+    pj_gridlist_add_seq_inc(gridindexes, orig_size, new_size);
+
+    return true;
+}
+
+// Load the shift values of gi and publish them, returns NULL on failure
+template <typename StreamPolicy, typename SnapshotGrids>
+inline pj_ctable::flp_t const* load_grid(StreamPolicy const& stream_policy,
+                                         SnapshotGrids & grids,
+                                         pj_gi const& gi)
+{
+    // local storage
+    pj_gi_load local_gi(gi.gridname, gi.format, gi.grid_offset, gi.must_swap);
+    local_gi.ct = gi.ct;
+
+    if (! load_grid(stream_policy, local_gi))
+    {
+        return NULL;
+    }
+
+    typename SnapshotGrids::write_locked lck_grids(grids);
+
+    return lck_grids.publish_cvs(gi, local_gi.ct.cvs);
+}
+
+// Generic stream policy and snapshot grids
+template <bool Inverse, typename CalcT, typename StreamPolicy, typename Range, typename SnapshotGrids>
+inline bool pj_apply_gridshift_3(StreamPolicy const& stream_policy,
+                                 Range & range,
+                                 SnapshotGrids & grids,
+                                 std::vector<std::size_t> const& gridindexes,
+                                 snapshot_grids_tag)
+{
+    typedef typename boost::range_size<Range>::type size_type;
+
+    // If the grids are empty the indexes are as well
+    if (gridindexes.empty())
+    {
+        return false;
+    }
+
+    size_type point_count = boost::size(range);
+
+    typename SnapshotGrids::read_snapshot snp_grids(grids);
+
+    for (size_type i = 0 ; i < point_count ; ++i)
+    {
+        typename boost::range_reference<Range>::type
+            point = range::at(range, i);
+
+        CalcT in_lon = geometry::get_as_radian<0>(point);
+        CalcT in_lat = geometry::get_as_radian<1>(point);
+
+        pj_gi * gip = find_grid(in_lon, in_lat, snp_grids.gridinfo, gridindexes);
+
+        if (gip == NULL)
+        {
+            continue;
+        }
+
+        pj_ctable::flp_t const* cvs = gip->published_cvs->load(std::memory_order_acquire);
+
+        // load the grid shift info if we don't have it.
+        if (cvs != NULL || (cvs = load_grid(stream_policy, grids, *gip)) != NULL)
+        {
+            // TODO: use set_invalid_point() or similar mechanism
+            CalcT out_lon = HUGE_VAL;
+            CalcT out_lat = HUGE_VAL;
+
+            nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, *gip, cvs);
+
+            // TODO: check differently
+            if (out_lon != HUGE_VAL)
+            {
+                geometry::set_from_radian<0>(point, out_lon);
+                geometry::set_from_radian<1>(point, out_lat);
+            }
+        }
+    }
+
+    return true;
+}
+
+}} // namespace projections::detail
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_SNAPSHOT_GRIDS_HPP
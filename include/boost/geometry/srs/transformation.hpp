@@ -11,8 +11,12 @@
 #define BOOST_GEOMETRY_SRS_TRANSFORMATION_HPP
 
 
+#include <cstddef>
+#include <deque>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <boost/throw_exception.hpp>
 
@@ -28,7 +32,9 @@
 #include <boost/geometry/geometries/segment.hpp>
 
 #include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/projections/adaptive_densify.hpp>
 #include <boost/geometry/srs/projections/grids.hpp>
+#include <boost/geometry/srs/projections/impl/parallel_ranges.hpp>
 #include <boost/geometry/srs/projections/impl/pj_transform.hpp>
 
 #include <boost/geometry/views/detail/indexed_point_view.hpp>
@@ -429,6 +435,81 @@ struct transform<Point, CT, point_tag>
     }
 };
 
+// Transforms single points, e.g. the points inserted by densify_geometry
+template
+<
+    typename CT,
+    typename Proj1, typename Par1,
+    typename Proj2, typename Par2,
+    typename Grids
+>
+class transform_point_function
+{
+public:
+    transform_point_function(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             Grids const& grids1, Grids const& grids2)
+        : m_proj1(proj1), m_par1(par1)
+        , m_proj2(proj2), m_par2(par2)
+        , m_grids1(grids1), m_grids2(grids2)
+    {}
+
+    template <typename PointIn, typename PointOut>
+    inline bool operator()(PointIn const& in, PointOut & out) const
+    {
+        return transform<PointOut, CT, point_tag>::apply(m_proj1, m_par1,
+                                                         m_proj2, m_par2,
+                                                         in, out,
+                                                         m_grids1, m_grids2);
+    }
+
+private:
+    Proj1 const& m_proj1;
+    Par1 const& m_par1;
+    Proj2 const& m_proj2;
+    Par2 const& m_par2;
+    Grids const& m_grids1;
+    Grids const& m_grids2;
+};
+
+template
+<
+    typename CT,
+    typename Proj1, typename Par1,
+    typename Proj2, typename Par2,
+    typename GeometryIn, typename GeometryOut,
+    typename Grids,
+    typename T
+>
+inline bool transform_densify(Proj1 const& proj1, Par1 const& par1,
+                              Proj2 const& proj2, Par2 const& par2,
+                              GeometryIn const& in, GeometryOut & out,
+                              Grids const& grids1, Grids const& grids2,
+                              srs::adaptive_densify<T> const& densify)
+{
+    // The input points are needed to densify the output
+    if (same_object(in, out))
+    {
+        GeometryIn const copy = in;
+        return transform_densify<CT>(proj1, par1, proj2, par2, copy, out,
+                                     grids1, grids2, densify);
+    }
+
+    bool const result = transform<GeometryOut, CT>::apply(proj1, par1,
+                                                          proj2, par2,
+                                                          in, out,
+                                                          grids1, grids2);
+
+    densify_geometry<GeometryOut>::apply(in, out,
+        transform_point_function
+            <
+                CT, Proj1, Par1, Proj2, Par2, Grids
+            >(proj1, par1, proj2, par2, grids1, grids2),
+        densify);
+
+    return result;
+}
+
 template <typename MultiPoint, typename CT>
 struct transform<MultiPoint, CT, multi_point_tag>
     : transform_range<CT>
@@ -551,6 +632,175 @@ struct transform<MultiPolygon, CT, multi_polygon_tag>
 {};
 
 
+// Grids which can be used by multiple threads: no grids, shared grids,
+// mapped grids or snapshot grids
+template <typename GridsTag>
+struct grids_tag_thread_safe
+    : std::false_type
+{};
+
+template <>
+struct grids_tag_thread_safe<shared_grids_tag>
+    : std::true_type
+{};
+
+template <>
+struct grids_tag_thread_safe<mapped_grids_tag>
+    : std::true_type
+{};
+
+template <>
+struct grids_tag_thread_safe<snapshot_grids_tag>
+    : std::true_type
+{};
+
+template <typename Grids>
+struct grids_thread_safe
+    : std::true_type
+{};
+
+template <typename GridsStorage>
+struct grids_thread_safe<srs::projection_grids<GridsStorage> >
+    : grids_tag_thread_safe<typename GridsStorage::grids_type::tag>
+{};
+
+// Transforms the points of pairs of ranges, split into chunks,
+// using multiple threads
+template <typename RangeOut, typename CT>
+class transform_range_pairs
+{
+    typedef transform_geometry_wrapper<RangeOut, CT> wrapper_type;
+
+public:
+    explicit transform_range_pairs(bool input_angles)
+        : m_input_angles(input_angles)
+    {}
+
+    template <typename RangeIn>
+    inline void apply(RangeIn const& in, RangeOut & out)
+    {
+        m_wrappers.emplace_back(in, out, m_input_angles);
+    }
+
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename Grids
+    >
+    inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                      Proj2 const& proj2, Par2 const& par2,
+                      Grids const& grids1, Grids const& grids2,
+                      std::size_t thread_count)
+    {
+        std::vector<std::size_t> sizes;
+        sizes.reserve(m_wrappers.size());
+        for (std::size_t i = 0; i < m_wrappers.size(); i++)
+        {
+            sizes.push_back(boost::size(m_wrappers[i].get()));
+        }
+
+        if (! grids_thread_safe<Grids>::value)
+        {
+            thread_count = 1;
+        }
+
+        bool const res = parallel_range_chunks(sizes, thread_count,
+            [&](range_chunk const& chunk)
+            {
+                auto const first = boost::begin(m_wrappers[chunk.index].get());
+                auto range = std::make_pair(first + chunk.first,
+                                            first + chunk.last);
+                try
+                {
+                    return pj_transform(proj1, par1, proj2, par2, range,
+                                        grids1, grids2);
+                }
+                catch (projection_exception const&)
+                {
+                    return false;
+                }
+            });
+
+        for (std::size_t i = 0; i < m_wrappers.size(); i++)
+        {
+            m_wrappers[i].finish();
+        }
+
+        return res;
+    }
+
+private:
+    bool m_input_angles;
+    // Not reallocated, the wrappers can refer to their own members
+    std::deque<wrapper_type> m_wrappers;
+};
+
+// As transform, using multiple threads for the points of the ranges
+// of the geometry
+template
+<
+    typename Geometry,
+    typename CT,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct transform_parallel
+{
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename GeometryIn, typename GeometryOut,
+        typename Grids
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             GeometryIn const& in, GeometryOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             std::size_t thread_count)
+    {
+        // NOTE: this has to be consistent with pj_transform()
+        bool const input_angles = !par1.is_geocent && par1.is_latlong;
+
+        transform_range_pairs
+            <
+                typename visit_range_pairs<GeometryOut>::range_type,
+                CT
+            > ranges(input_angles);
+
+        visit_range_pairs<GeometryOut>::apply(in, out, ranges);
+
+        return ranges.apply(proj1, par1, proj2, par2, grids1, grids2,
+                            thread_count);
+    }
+};
+
+template <typename Point, typename CT>
+struct transform_parallel<Point, CT, point_tag>
+{
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename GeometryIn, typename GeometryOut,
+        typename Grids
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             GeometryIn const& in, GeometryOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             std::size_t )
+    {
+        return transform<Point, CT>::apply(proj1, par1, proj2, par2,
+                                           in, out, grids1, grids2);
+    }
+};
+
+template <typename Segment, typename CT>
+struct transform_parallel<Segment, CT, segment_tag>
+    : transform_parallel<Segment, CT, point_tag>
+{};
+
 }} // namespace projections::detail
     
 namespace srs
@@ -712,6 +962,166 @@ public:
                          grids.src_grids);
     }
 
+    /*!
+    \brief Forward transformation with adaptive densification
+    \details The points are transformed as without densification, then
+        points are inserted into the segments of the transformed linestrings
+        and rings where the transformation of the middle point of the
+        segment deviates from the transformed segment, see
+        srs::adaptive_densify. Only the inserted points are transformed
+        additionally.
+    */
+    template <typename GeometryIn, typename GeometryOut, typename T>
+    bool forward(GeometryIn const& in, GeometryOut & out,
+                 srs::adaptive_densify<T> const& densify) const
+    {
+        return forward(in, out, transformation_grids<detail::empty_grids_storage>(),
+                       densify);
+    }
+
+    /*!
+    \brief Inverse transformation with adaptive densification
+    \details See forward
+    */
+    template <typename GeometryIn, typename GeometryOut, typename T>
+    bool inverse(GeometryIn const& in, GeometryOut & out,
+                 srs::adaptive_densify<T> const& densify) const
+    {
+        return inverse(in, out, transformation_grids<detail::empty_grids_storage>(),
+                       densify);
+    }
+
+    /*!
+    \brief Forward transformation using grids with adaptive densification
+    \details See forward
+    */
+    template <typename GeometryIn, typename GeometryOut, typename GridsStorage, typename T>
+    bool forward(GeometryIn const& in, GeometryOut & out,
+                 transformation_grids<GridsStorage> const& grids,
+                 srs::adaptive_densify<T> const& densify) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+            "Not supported combination of Geometries.",
+            GeometryIn, GeometryOut);
+
+        return projections::detail::transform_densify
+                <
+                    calc_t
+                >(m_proj1.proj(), m_proj1.proj().params(),
+                  m_proj2.proj(), m_proj2.proj().params(),
+                  in, out,
+                  grids.src_grids,
+                  grids.dst_grids,
+                  densify);
+    }
+
+    /*!
+    \brief Inverse transformation using grids with adaptive densification
+    \details See forward
+    */
+    template <typename GeometryIn, typename GeometryOut, typename GridsStorage, typename T>
+    bool inverse(GeometryIn const& in, GeometryOut & out,
+                 transformation_grids<GridsStorage> const& grids,
+                 srs::adaptive_densify<T> const& densify) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+            "Not supported combination of Geometries.",
+            GeometryIn, GeometryOut);
+
+        return projections::detail::transform_densify
+                <
+                    calc_t
+                >(m_proj2.proj(), m_proj2.proj().params(),
+                  m_proj1.proj(), m_proj1.proj().params(),
+                  in, out,
+                  grids.dst_grids,
+                  grids.src_grids,
+                  densify);
+    }
+
+    /*!
+    \brief Forward transformation using multiple threads
+    \details The points of the ranges of the geometry are split into chunks,
+        transformed by up to thread_count threads (0: the number of hardware
+        threads). Points which can not be transformed are handled as with one
+        thread, and false is returned.
+    */
+    template <typename GeometryIn, typename GeometryOut>
+    bool forward(GeometryIn const& in, GeometryOut & out,
+                 std::size_t thread_count) const
+    {
+        return forward(in, out, transformation_grids<detail::empty_grids_storage>(),
+                       thread_count);
+    }
+
+    /*!
+    \brief Inverse transformation using multiple threads
+    \details See forward
+    */
+    template <typename GeometryIn, typename GeometryOut>
+    bool inverse(GeometryIn const& in, GeometryOut & out,
+                 std::size_t thread_count) const
+    {
+        return inverse(in, out, transformation_grids<detail::empty_grids_storage>(),
+                       thread_count);
+    }
+
+    /*!
+    \brief Forward transformation using grids and multiple threads
+    \details The grids are only used by multiple threads if they are
+        shared grids (srs::shared_grids), mapped grids (srs::mapped_grids)
+        or snapshot grids (srs::snapshot_grids), otherwise one thread is used.
+    */
+    template <typename GeometryIn, typename GeometryOut, typename GridsStorage>
+    bool forward(GeometryIn const& in, GeometryOut & out,
+                 transformation_grids<GridsStorage> const& grids,
+                 std::size_t thread_count) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+            "Not supported combination of Geometries.",
+            GeometryIn, GeometryOut);
+
+        return projections::detail::transform_parallel
+                <
+                    GeometryOut,
+                    calc_t
+                >::apply(m_proj1.proj(), m_proj1.proj().params(),
+                         m_proj2.proj(), m_proj2.proj().params(),
+                         in, out,
+                         grids.src_grids,
+                         grids.dst_grids,
+                         thread_count);
+    }
+
+    /*!
+    \brief Inverse transformation using grids and multiple threads
+    \details See forward
+    */
+    template <typename GeometryIn, typename GeometryOut, typename GridsStorage>
+    bool inverse(GeometryIn const& in, GeometryOut & out,
+                 transformation_grids<GridsStorage> const& grids,
+                 std::size_t thread_count) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+            "Not supported combination of Geometries.",
+            GeometryIn, GeometryOut);
+
+        return projections::detail::transform_parallel
+                <
+                    GeometryOut,
+                    calc_t
+                >::apply(m_proj2.proj(), m_proj2.proj().params(),
+                         m_proj1.proj(), m_proj1.proj().params(),
+                         in, out,
+                         grids.dst_grids,
+                         grids.src_grids,
+                         thread_count);
+    }
+
     template <typename GridsStorage>
     inline transformation_grids<GridsStorage> initialize_grids(GridsStorage & grids_storage) const
     {
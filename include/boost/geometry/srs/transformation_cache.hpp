@@ -0,0 +1,221 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_TRANSFORMATION_CACHE_HPP
+#define BOOST_GEOMETRY_SRS_TRANSFORMATION_CACHE_HPP
+
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <boost/geometry/srs/projections/epsg_params.hpp>
+#include <boost/geometry/srs/projections/esri_params.hpp>
+#include <boost/geometry/srs/projections/iau2000_params.hpp>
+#include <boost/geometry/srs/projections/proj4.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace projections
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Identifies the parameters of a coordinate system in a transformation_cache
+inline std::string transformation_cache_key(srs::proj4 const& params)
+{
+    return "proj4:" + params.str();
+}
+
+inline std::string transformation_cache_key(srs::epsg const& params)
+{
+    return "epsg:" + std::to_string(params.code);
+}
+
+inline std::string transformation_cache_key(srs::esri const& params)
+{
+    return "esri:" + std::to_string(params.code);
+}
+
+inline std::string transformation_cache_key(srs::iau2000 const& params)
+{
+    return "iau2000:" + std::to_string(params.code);
+}
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+} // namespace projections
+
+
+namespace srs
+{
+
+
+/*!
+    \brief Cache of dynamic transformations, keyed by the source and
+        target coordinate systems
+    \details Returns shared, already initialized transformations for pairs
+        of proj4 strings or EPSG, ESRI or IAU2000 codes. Codes require the
+        corresponding header, e.g. srs/epsg.hpp. If more than capacity
+        transformations are cached, the least recently used is removed.
+        Transformations which are in use are kept alive by their pointers.
+        All member functions can be called concurrently, the returned
+        transformations are immutable and can be used concurrently as well.
+    \ingroup projection
+    \tparam CT calculation type used internally
+*/
+template <typename CT = double>
+class transformation_cache
+{
+public:
+    typedef srs::transformation<srs::dynamic, srs::dynamic, CT> transformation_type;
+    typedef std::shared_ptr<transformation_type const> pointer;
+
+    explicit transformation_cache(std::size_t capacity)
+        : m_capacity(capacity)
+        , m_hits(0)
+        , m_misses(0)
+        , m_evictions(0)
+    {}
+
+    /*!
+    \brief Returns the transformation from parameters1 to parameters2,
+        creating it if it is not cached
+    \details A transformation is created without holding the lock, so other
+        threads can use the cache meanwhile. If two threads create the same
+        transformation, the first one is cached and returned to both.
+        Exceptions thrown while creating a transformation are propagated,
+        nothing is cached then.
+    */
+    template <typename Parameters1, typename Parameters2>
+    inline pointer get(Parameters1 const& parameters1,
+                       Parameters2 const& parameters2)
+    {
+        key_type const key(projections::detail::transformation_cache_key(parameters1),
+                           projections::detail::transformation_cache_key(parameters2));
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            pointer const* found = find(key);
+            if (found != NULL)
+            {
+                m_hits++;
+                return *found;
+            }
+            m_misses++;
+        }
+
+        pointer const created = std::make_shared<transformation_type>(
+                                    parameters1, parameters2);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        pointer const* found = find(key);
+        if (found != NULL)
+        {
+            return *found;
+        }
+
+        if (m_capacity > 0)
+        {
+            m_entries.push_front(std::make_pair(key, created));
+            m_index[key] = m_entries.begin();
+            if (m_entries.size() > m_capacity)
+            {
+                m_index.erase(m_entries.back().first);
+                m_entries.pop_back();
+                m_evictions++;
+            }
+        }
+        return created;
+    }
+
+    /// Removes all transformations, the counters are not reset
+    inline void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_index.clear();
+        m_entries.clear();
+    }
+
+    inline std::size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_entries.size();
+    }
+
+    inline std::size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    /// Number of calls of get returning a cached transformation
+    inline std::size_t hits() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_hits;
+    }
+
+    /// Number of calls of get creating a transformation
+    inline std::size_t misses() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_misses;
+    }
+
+    /// Number of transformations removed because the capacity was exceeded
+    inline std::size_t evictions() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_evictions;
+    }
+
+private:
+    typedef std::pair<std::string, std::string> key_type;
+    typedef std::list<std::pair<key_type, pointer> > entries_type;
+
+    // Returns the cached transformation, now the most recently used,
+    // or NULL. Should be called with the lock held.
+    inline pointer const* find(key_type const& key)
+    {
+        typename std::map<key_type, typename entries_type::iterator>::iterator
+            it = m_index.find(key);
+        if (it == m_index.end())
+        {
+            return NULL;
+        }
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return &(it->second->second);
+    }
+
+    std::size_t const m_capacity;
+    std::size_t m_hits;
+    std::size_t m_misses;
+    std::size_t m_evictions;
+
+    // Most recently used first
+    entries_type m_entries;
+    std::map<key_type, typename entries_type::iterator> m_index;
+    mutable std::mutex m_mutex;
+};
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_TRANSFORMATION_CACHE_HPP
@@ -15,7 +15,12 @@
 #ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_POINT_CIRCLE_HPP
 #define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_POINT_CIRCLE_HPP
 
+#include <cmath>
 #include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <boost/range/value_type.hpp>
 
@@ -24,12 +29,36 @@
 
 #include <boost/geometry/strategies/buffer.hpp>
 
+#include <boost/geometry/util/condition.hpp>
 #include <boost/geometry/util/math.hpp>
 #include <boost/geometry/util/select_most_precise.hpp>
 
 namespace boost { namespace geometry
 {
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace buffer
+{
+
+// Returns the cosines and sines of the vertices of a circle with count
+// points, calculated as point_circle does for other types
+inline std::vector<std::pair<double, double> > unit_circle_table(std::size_t count)
+{
+    std::vector<std::pair<double, double> > table;
+    double const diff = geometry::math::two_pi<double>() / double(count);
+    double a = 0;
+    table.reserve(count);
+    for (std::size_t i = 0; i < count; i++, a -= diff)
+    {
+        table.push_back(std::make_pair(std::cos(a), std::sin(a)));
+    }
+    return table;
+}
+
+}} // namespace detail::buffer
+#endif // DOXYGEN_NO_DETAIL
+
+
 namespace strategy { namespace buffer
 {
 
@@ -61,6 +90,8 @@ public :
     //! is smaller than 3, count is internally set to 3)
     explicit point_circle(std::size_t count = 90)
         : m_count((count < 3u) ? 3u : count)
+        , m_unit_circle(std::make_shared<unit_circle_type const>(
+            geometry::detail::buffer::unit_circle_table(m_count)))
     {}
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -90,17 +121,31 @@ public :
         promoted_type const buffer_distance = distance_strategy.apply(point, point,
                         strategy::buffer::buffer_side_left);
 
-        promoted_type const two_pi = geometry::math::two_pi<promoted_type>();
-
-        promoted_type const diff = two_pi / promoted_type(m_count);
-        promoted_type a = 0;
-
-        for (std::size_t i = 0; i < m_count; i++, a -= diff)
+        if (BOOST_GEOMETRY_CONDITION((std::is_same<promoted_type, double>::value)))
         {
-            output_point_type p;
-            set<0>(p, get<0>(point) + buffer_distance * cos(a));
-            set<1>(p, get<1>(point) + buffer_distance * sin(a));
-            output_range.push_back(p);
+            unit_circle_type const& unit_circle = *m_unit_circle;
+            for (std::size_t i = 0; i < m_count; i++)
+            {
+                output_point_type p;
+                set<0>(p, get<0>(point) + buffer_distance * unit_circle[i].first);
+                set<1>(p, get<1>(point) + buffer_distance * unit_circle[i].second);
+                output_range.push_back(p);
+            }
+        }
+        else
+        {
+            promoted_type const two_pi = geometry::math::two_pi<promoted_type>();
+
+            promoted_type const diff = two_pi / promoted_type(m_count);
+            promoted_type a = 0;
+
+            for (std::size_t i = 0; i < m_count; i++, a -= diff)
+            {
+                output_point_type p;
+                set<0>(p, get<0>(point) + buffer_distance * cos(a));
+                set<1>(p, get<1>(point) + buffer_distance * sin(a));
+                output_range.push_back(p);
+            }
         }
 
         // Close it:
@@ -109,7 +154,11 @@ public :
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
 private :
+    typedef std::vector<std::pair<double, double> > unit_circle_type;
+
     std::size_t m_count;
+    // Shared by copies of the strategy, the table is never modified
+    std::shared_ptr<unit_circle_type const> m_unit_circle;
 };
 
 
@@ -0,0 +1,360 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGY_CARTESIAN_POINT_IN_POLY_INDEXED_WINDING_HPP
+#define BOOST_GEOMETRY_STRATEGY_CARTESIAN_POINT_IN_POLY_INDEXED_WINDING_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/within/edge_index.hpp>
+
+#include <boost/geometry/strategies/cartesian/point_in_poly_winding.hpp>
+#include <boost/geometry/strategies/relate/cartesian.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace within
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Identifies a ring by its number of points and some of its points, such
+// that copies of the ring are identified as the ring itself
+template <typename Point>
+struct ring_key
+{
+    static const std::size_t sample_count = 3;
+
+    template <typename Ring>
+    explicit inline ring_key(Ring const& ring)
+        : size(boost::size(ring))
+    {
+        for (std::size_t i = 0; i < sample_count; i++)
+        {
+            std::size_t const index = size * i / sample_count;
+            if (index < size)
+            {
+                geometry::set<0>(samples[i], geometry::get<0>(range::at(ring, index)));
+                geometry::set<1>(samples[i], geometry::get<1>(range::at(ring, index)));
+            }
+            else
+            {
+                geometry::set<0>(samples[i], 0);
+                geometry::set<1>(samples[i], 0);
+            }
+        }
+    }
+
+    inline bool operator<(ring_key const& other) const
+    {
+        if (size != other.size)
+        {
+            return size < other.size;
+        }
+        for (std::size_t i = 0; i < sample_count; i++)
+        {
+            if (geometry::get<0>(samples[i]) != geometry::get<0>(other.samples[i]))
+            {
+                return geometry::get<0>(samples[i]) < geometry::get<0>(other.samples[i]);
+            }
+            if (geometry::get<1>(samples[i]) != geometry::get<1>(other.samples[i]))
+            {
+                return geometry::get<1>(samples[i]) < geometry::get<1>(other.samples[i]);
+            }
+        }
+        return false;
+    }
+
+    std::size_t size;
+    Point samples[sample_count];
+};
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct indexed_rings
+{
+    BOOST_GEOMETRY_STATIC_ASSERT_FALSE(
+        "Not implemented for this Geometry type.",
+        Geometry, Tag);
+};
+
+template <typename Ring>
+struct indexed_rings<Ring, ring_tag>
+{
+    template <typename Indexes>
+    static inline void apply(Ring const& ring, Indexes& indexes)
+    {
+        typedef typename boost::range_value<Indexes>::type item_type;
+        typedef typename item_type::first_type key_type;
+        typedef typename item_type::second_type index_type;
+        indexes.push_back(item_type(key_type(ring), index_type(ring)));
+    }
+};
+
+template <typename Polygon>
+struct indexed_rings<Polygon, polygon_tag>
+{
+    template <typename Indexes>
+    static inline void apply(Polygon const& polygon, Indexes& indexes)
+    {
+        typedef typename ring_type<Polygon>::type ring_type;
+        indexed_rings<ring_type>::apply(exterior_ring(polygon), indexes);
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename geometry::detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            indexed_rings<ring_type>::apply(*it, indexes);
+        }
+    }
+};
+
+template <typename MultiPolygon>
+struct indexed_rings<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Indexes>
+    static inline void apply(MultiPolygon const& multi_polygon, Indexes& indexes)
+    {
+        typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi_polygon); it != boost::end(multi_polygon); ++it)
+        {
+            indexed_rings<polygon_type>::apply(*it, indexes);
+        }
+    }
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Within detection using winding rule in cartesian coordinate system,
+    using a precomputed index of the segments of the rings of a geometry.
+\ingroup strategies
+\details The strategy is constructed from an areal geometry. For each of its
+    rings the segments are registered in slabs along the x-axis, such that
+    a query visits only the segments possibly crossing the vertical line
+    through the point. This makes repeated queries against rings with many
+    vertices fast. The results are identical to the results of the winding
+    strategy. The strategy stores a copy of the points of the rings, and
+    copies of the strategy share the index. Rings are identified by their
+    number of points and three of their points, so the index is also used
+    for copies of the geometry, but the geometry should not be modified
+    while the strategy is in use. Rings not identified, for example rings
+    not belonging to the geometry or rings of which the geometry contains
+    several equal ones, and linear geometries, are processed as by the
+    winding strategy. The strategy is not included by default, this header
+    should be included to use it.
+\tparam Point \tparam_point
+\tparam CalculationType \tparam_calculation
+
+\qbk{
+[heading See also]
+[link geometry.reference.algorithms.within.within_3_with_strategy within (with strategy)]
+}
+ */
+template
+<
+    typename Point,
+    typename CalculationType = void
+>
+class cartesian_indexed_winding
+    : public cartesian_winding<void, void, CalculationType>
+{
+    typedef cartesian_winding<void, void, CalculationType> base_type;
+    typedef detail::ring_key<Point> key_type;
+    typedef geometry::detail::within::edge_index<Point> index_type;
+    typedef std::vector<std::pair<key_type, index_type> > indexes_type;
+
+    struct less_key
+    {
+        template <typename Item>
+        inline bool operator()(Item const& item, key_type const& key) const
+        {
+            return item.first < key;
+        }
+
+        template <typename Item>
+        inline bool operator()(key_type const& key, Item const& item) const
+        {
+            return key < item.first;
+        }
+
+        template <typename Item>
+        inline bool operator()(Item const& left, Item const& right) const
+        {
+            return left.first < right.first;
+        }
+    };
+
+    struct equal_key
+    {
+        template <typename Item>
+        inline bool operator()(Item const& left, Item const& right) const
+        {
+            return ! (left.first < right.first) && ! (right.first < left.first);
+        }
+    };
+
+public :
+    typedef void ring_index_tag;
+
+    inline cartesian_indexed_winding()
+        : m_indexes(std::make_shared<indexes_type>())
+    {}
+
+    template <typename Geometry>
+    explicit inline cartesian_indexed_winding(Geometry const& geometry)
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (std::is_same<typename point_type<Geometry>::type, Point>::value),
+            "The Geometry should have the point type of the strategy.",
+            Geometry, Point);
+
+        indexes_type all;
+        detail::indexed_rings<Geometry>::apply(geometry, all);
+        std::stable_sort(all.begin(), all.end(), less_key());
+
+        // Rings which can not be identified are not indexed
+        std::shared_ptr<indexes_type> indexes = std::make_shared<indexes_type>();
+        for (typename indexes_type::iterator it = all.begin(); it != all.end(); )
+        {
+            typename indexes_type::iterator const next
+                = std::adjacent_find(it, all.end(), equal_key());
+            indexes->insert(indexes->end(), it, next);
+            it = next;
+            while (it != all.end() && equal_key()(*next, *it))
+            {
+                ++it;
+            }
+        }
+        m_indexes = indexes;
+    }
+
+    //! Returns true and assigns 1 to result if the point is in the interior,
+    //! 0 if it is on the boundary and -1 if it is in the exterior of the
+    //! ring, or returns false if the ring is not indexed
+    template <typename P, typename Ring>
+    inline bool apply_ring(P const& point, Ring const& ring, int& result) const
+    {
+        index_type const* index = find(ring);
+        if (index == NULL)
+        {
+            return false;
+        }
+        result = index->apply(point, static_cast<base_type const&>(*this));
+        return true;
+    }
+
+    //! Returns true if the ring, or a copy of it, is indexed
+    template <typename Ring>
+    inline bool is_indexed(Ring const& ring) const
+    {
+        return find(ring) != NULL;
+    }
+
+    //! Returns the number of indexed rings
+    inline std::size_t ring_count() const
+    {
+        return m_indexes->size();
+    }
+
+private :
+    template <typename Ring>
+    inline index_type const* find(Ring const& ring) const
+    {
+        key_type const key(ring);
+        typename indexes_type::const_iterator const it
+            = std::lower_bound(m_indexes->begin(), m_indexes->end(),
+                               key, less_key());
+        return it != m_indexes->end() && ! (key < it->first)
+            ? &it->second : NULL;
+    }
+
+    std::shared_ptr<indexes_type const> m_indexes;
+};
+
+
+}} // namespace strategy::within
+
+
+namespace strategies { namespace relate { namespace services
+{
+
+template <typename Point, typename CalculationType>
+struct strategy_converter<strategy::within::cartesian_indexed_winding<Point, CalculationType>>
+{
+    typedef strategy::within::cartesian_indexed_winding
+        <
+            Point, CalculationType
+        > indexed_winding_type;
+
+    struct altered_strategy
+        : strategies::relate::cartesian<CalculationType>
+    {
+        explicit altered_strategy(indexed_winding_type const& strategy)
+            : m_strategy(strategy)
+        {}
+
+        using strategies::relate::cartesian<CalculationType>::relate;
+
+        template <typename Geometry1, typename Geometry2>
+        auto relate(Geometry1 const&, Geometry2 const&,
+                           std::enable_if_t
+                                <
+                                    util::is_pointlike<Geometry1>::value
+                                 && ( util::is_linear<Geometry2>::value
+                                   || util::is_polygonal<Geometry2>::value )
+                                > * = nullptr) const
+        {
+            return m_strategy;
+        }
+
+    private:
+        indexed_winding_type m_strategy;
+    };
+
+    static auto get(indexed_winding_type const& strategy)
+    {
+        return altered_strategy(strategy);
+    }
+};
+
+}}} // namespace strategies::relate::services
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGY_CARTESIAN_POINT_IN_POLY_INDEXED_WINDING_HPP
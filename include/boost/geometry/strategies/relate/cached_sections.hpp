@@ -0,0 +1,195 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_RELATE_CACHED_SECTIONS_HPP
+#define BOOST_GEOMETRY_STRATEGIES_RELATE_CACHED_SECTIONS_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/core/addressof.hpp>
+
+#include <boost/geometry/algorithms/detail/overlay/do_reverse.hpp>
+#include <boost/geometry/algorithms/detail/sections/cached_sections.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/policies/robustness/no_rescale_policy.hpp>
+
+#include <boost/geometry/strategies/detail.hpp>
+#include <boost/geometry/strategies/relate/services.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategies { namespace relate
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Identifies a type without run-time type information
+template <typename Type>
+struct type_key
+{
+    static const char value;
+};
+
+template <typename Type>
+const char type_key<Type>::value = 0;
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Relate strategy carrying the monotonic sections of geometries,
+    calculated once, for repeated overlay and relate operations
+\details The sections of the added geometries are calculated once, when the
+    geometries are added. Algorithms called with this strategy and one of
+    these geometries use these sections, instead of sectionalizing the
+    geometry again. This applies to all algorithms calculating turns without
+    rescaling, such as intersects, disjoint, relate for combinations with
+    linear geometries, and overlay of integer geometries or if
+    BOOST_GEOMETRY_NO_ROBUSTNESS is defined. The results are the same.
+    Copies of the strategy share the sections. Geometries are identified by
+    their address and type, so they should not be modified or moved while
+    the strategy is in use. Geometries should be added before the strategy
+    is used in multiple threads.
+\tparam Point Point type of the geometries
+\tparam Strategy The relate strategy used for all other calculations
+*/
+template
+<
+    typename Point,
+    typename Strategy = typename services::default_strategy<Point, Point>::type
+>
+class cached_sections
+    : public Strategy
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (strategies::detail::is_umbrella_strategy<Strategy>::value),
+        "Strategy should be a relate strategy.",
+        Strategy);
+
+public :
+    typedef void cached_sections_tag;
+    typedef geometry::sections<model::box<Point>, 2> sections_type;
+
+    inline cached_sections()
+        : m_items(std::make_shared<items_type>())
+    {}
+
+    explicit inline cached_sections(Strategy const& strategy)
+        : Strategy(strategy)
+        , m_items(std::make_shared<items_type>())
+    {}
+
+    //! Calculates and stores the sections of a geometry
+    template <typename Geometry>
+    inline void add(Geometry const& geometry)
+    {
+        concepts::check<Geometry const>();
+
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (std::is_same<typename point_type<Geometry>::type, Point>::value),
+            "The Geometry should have the point type of the strategy.",
+            Geometry, Point);
+
+        static const bool reverse = geometry::detail::overlay::do_reverse
+            <
+                geometry::point_order<Geometry>::value
+            >::value;
+
+        item_type item;
+        item.geometry = boost::addressof(geometry);
+        item.type = &detail::type_key<Geometry>::value;
+        item.reverse = reverse;
+
+        typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
+        geometry::sectionalize<reverse, dimensions>(geometry,
+                geometry::detail::no_rescale_policy(), item.sections,
+                static_cast<Strategy const&>(*this));
+
+        typename items_type::iterator it = std::upper_bound(m_items->begin(),
+                m_items->end(), item.geometry, less_address());
+        m_items->insert(it, std::move(item));
+    }
+
+    //! Returns the stored sections of a geometry, or a null pointer
+    template <typename Geometry>
+    inline sections_type const* find_sections(Geometry const& geometry,
+                                              bool reverse) const
+    {
+        void const* const address = boost::addressof(geometry);
+        for (typename items_type::const_iterator it
+                = std::lower_bound(m_items->begin(), m_items->end(),
+                                   address, less_address());
+             it != m_items->end() && it->geometry == address; ++it)
+        {
+            if (it->type == &detail::type_key<Geometry>::value
+                && it->reverse == reverse)
+            {
+                return &it->sections;
+            }
+        }
+        return nullptr;
+    }
+
+    //! Returns the number of geometries with stored sections
+    inline std::size_t size() const
+    {
+        return m_items->size();
+    }
+
+private :
+    struct item_type
+    {
+        void const* geometry;
+        char const* type;
+        bool reverse;
+        sections_type sections;
+    };
+
+    struct less_address
+    {
+        inline bool operator()(item_type const& item, void const* address) const
+        {
+            return std::less<void const*>()(item.geometry, address);
+        }
+
+        inline bool operator()(void const* address, item_type const& item) const
+        {
+            return std::less<void const*>()(address, item.geometry);
+        }
+    };
+
+    typedef std::vector<item_type> items_type;
+
+    std::shared_ptr<items_type> m_items;
+};
+
+
+}} // namespace strategies::relate
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_RELATE_CACHED_SECTIONS_HPP
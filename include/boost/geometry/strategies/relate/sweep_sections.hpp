@@ -0,0 +1,64 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_RELATE_SWEEP_SECTIONS_HPP
+#define BOOST_GEOMETRY_STRATEGIES_RELATE_SWEEP_SECTIONS_HPP
+
+
+#include <boost/geometry/core/static_assert.hpp>
+
+#include <boost/geometry/strategies/detail.hpp>
+#include <boost/geometry/strategies/relate/cartesian.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategies { namespace relate
+{
+
+/*!
+\brief Relate strategy finding the pairs of overlapping monotonic sections
+    with a sweep (sweep_pairs) instead of partition
+\details Algorithms calculating turns, such as intersects, disjoint,
+    relate and overlay, or checking for self intersections, visit the pairs
+    of sections of which the boxes overlap. With this strategy these pairs
+    are found by sorting the sections along one axis and sweeping over them,
+    which can be faster for skewed input, for example many small features
+    concentrated in a small area. The pairs are visited as they are found,
+    without storing them; collected turns are ordered by the sections
+    afterwards, so the results do not depend on the sweep order.
+    This is done for cartesian geometries, for other coordinate systems
+    partition is used.
+\tparam Strategy The relate strategy used for all calculations
+*/
+template <typename Strategy = strategies::relate::cartesian<> >
+class sweep_sections
+    : public Strategy
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (strategies::detail::is_umbrella_strategy<Strategy>::value),
+        "Strategy should be a relate strategy.",
+        Strategy);
+
+public :
+    typedef void sweep_sections_tag;
+
+    inline sweep_sections()
+    {}
+
+    explicit inline sweep_sections(Strategy const& strategy)
+        : Strategy(strategy)
+    {}
+};
+
+
+}} // namespace strategies::relate
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_RELATE_SWEEP_SECTIONS_HPP
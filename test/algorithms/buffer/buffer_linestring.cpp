@@ -118,6 +118,7 @@ void test_all()
     bg::strategy::buffer::join_miter join_miter;
     bg::strategy::buffer::join_round join_round(100);
     bg::strategy::buffer::join_round_by_divide join_round_by_divide(4);
+    bg::strategy::buffer::join_round_by_rotation join_round_by_rotation(100);
     bg::strategy::buffer::end_flat end_flat;
     bg::strategy::buffer::end_round end_round(100);
 
@@ -162,6 +163,7 @@ void test_all()
 
     test_one<linestring, polygon>("two_bends", two_bends, join_round, end_round, 46.2995, 1.5);
     test_one<linestring, polygon>("two_bends", two_bends, join_round, end_flat, 39.235, 1.5);
+    test_one<linestring, polygon>("two_bends", two_bends, join_round_by_rotation, end_flat, 39.235, 1.5);
     test_one<linestring, polygon>("two_bends", two_bends, join_round_by_divide, end_flat, 39.235, 1.5);
     test_one<linestring, polygon>("two_bends", two_bends, join_miter, end_flat, 39.513, 1.5);
     test_one<linestring, polygon>("two_bends_left", two_bends, join_round, end_flat, 20.025, 1.5, settings, 0.0);
@@ -179,6 +181,7 @@ void test_all()
     //test_one<linestring, polygon>("two_bends_pos", two_bends, join_round, end_flat, 99, -1.5, settings, +1.0);
 
     test_one<linestring, polygon>("overlapping150", overlapping, join_round, end_flat, 65.6786, 1.5);
+    test_one<linestring, polygon>("overlapping150", overlapping, join_round_by_rotation, end_flat, 65.6786, 1.5);
     test_one<linestring, polygon>("overlapping150", overlapping, join_miter, end_flat, 68.140, 1.5);
 
     // Different cases with intersection points on flat and (left/right from line itself)
@@ -11,6 +11,9 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <sstream>
+#include <type_traits>
+
 #include "test_buffer.hpp"
 
 static std::string const simplex = "MULTIPOINT((5 5),(7 7))";
@@ -208,14 +211,104 @@ void test_many_points_per_circle()
 #endif
 }
 
+// Compares buffer_clustered, which clusters the points, with the buffer of
+// all points in one piece collection, which buffer creates
+template <typename MultiPoint, typename Polygon, typename PointStrategy>
+void test_clustered(std::string const& caseid, std::string const& wkt,
+                    double distance, PointStrategy const& point_strategy)
+{
+    typedef bg::model::multi_polygon<Polygon> multi_polygon_type;
+
+    MultiPoint multi_point;
+    bg::read_wkt(wkt, multi_point);
+
+    bg::strategy::buffer::distance_symmetric<double> distance_strategy(distance);
+    bg::strategy::buffer::side_straight side_strategy;
+    bg::strategy::buffer::join_round join_strategy;
+    bg::strategy::buffer::end_round end_strategy;
+
+    multi_polygon_type result;
+    bg::buffer_clustered(multi_point, result, distance_strategy, side_strategy,
+                         join_strategy, end_strategy, point_strategy);
+
+    typedef typename bg::point_type<MultiPoint>::type point_type;
+    bg::model::box<point_type> envelope;
+    bg::envelope(multi_point, envelope);
+    bg::buffer(envelope, envelope, distance);
+    typename bg::strategies::relate::services::default_strategy
+        <
+            MultiPoint, MultiPoint
+        >::type strategies;
+    typedef typename bg::rescale_policy_type<point_type>::type rescale_policy_type;
+    rescale_policy_type rescale_policy
+        = bg::get_rescale_policy<rescale_policy_type>(envelope, strategies);
+
+    multi_polygon_type expected;
+    bg::detail::buffer::buffer_inserter<Polygon>(multi_point,
+        std::back_inserter(expected), distance_strategy, side_strategy,
+        join_strategy, end_strategy, point_strategy, strategies,
+        rescale_policy);
+
+    multi_polygon_type unclustered;
+    bg::buffer(multi_point, unclustered, distance_strategy, side_strategy,
+               join_strategy, end_strategy, point_strategy);
+    std::ostringstream expected_wkt, unclustered_wkt;
+    expected_wkt << std::setprecision(20) << bg::wkt(expected);
+    unclustered_wkt << std::setprecision(20) << bg::wkt(unclustered);
+    BOOST_CHECK_MESSAGE(unclustered_wkt.str() == expected_wkt.str(),
+        caseid << " buffer differs from buffer_inserter");
+
+    // Clusters are united with union, the intersection points of the
+    // circles can differ slightly from those of the piece collection
+    double const expected_area = bg::area(expected);
+    BOOST_CHECK_MESSAGE(result.size() == expected.size(),
+        caseid << " polygons: " << result.size()
+        << " expected: " << expected.size());
+    BOOST_CHECK_MESSAGE(bg::math::abs(bg::area(result) - expected_area)
+                            <= 1.0e-8 * expected_area,
+        caseid << " area: " << std::setprecision(17) << bg::area(result)
+        << " expected: " << expected_area);
+    BOOST_CHECK_MESSAGE(bg::is_valid(result), caseid << " invalid");
+}
+
+template <bool Clockwise, typename P>
+void test_clustered_all()
+{
+    typedef bg::model::polygon<P, Clockwise> polygon;
+    typedef bg::model::polygon<P, Clockwise, false> open_polygon;
+    typedef bg::model::multi_point<P> multi_point_type;
+
+    bg::strategy::buffer::point_circle circle(24);
+    bg::strategy::buffer::point_square square;
+
+    test_clustered<multi_point_type, polygon>("simplex", simplex, 1.0, circle);
+    test_clustered<multi_point_type, polygon>("simplex_large", simplex, 2.0, circle);
+    test_clustered<multi_point_type, polygon>("three", three, 1.5, circle);
+    test_clustered<multi_point_type, polygon>("multipoint_a", multipoint_a, 4.0, circle);
+    test_clustered<multi_point_type, polygon>("multipoint_b", multipoint_b, 7.0, circle);
+    test_clustered<multi_point_type, polygon>("multipoint_b_square", multipoint_b, 7.0, square);
+    test_clustered<multi_point_type, open_polygon>("multipoint_b_open", multipoint_b, 7.0, circle);
+    test_clustered<multi_point_type, polygon>("grid_a", grid_a, 0.5, circle);
+    test_clustered<multi_point_type, polygon>("grid_a_square", grid_a, 0.5, square);
+    test_clustered<multi_point_type, polygon>("mysql_report_3", mysql_report_3, 1.0, circle);
+
+    // Points exactly at twice the distance, squares touching at corners
+    test_clustered<multi_point_type, polygon>("touching",
+        "MULTIPOINT(0 0,2 0,4 2,-2 -2)", 1.0, circle);
+    test_clustered<multi_point_type, polygon>("touching_square",
+        "MULTIPOINT(0 0,2 0,4 2,-2 -2)", 1.0, square);
+}
+
 int test_main(int, char* [])
 {
     BoostGeometryWriteTestConfiguration();
 
     test_all<true, bg::model::point<default_test_type, 2, bg::cs::cartesian> >();
+    test_clustered_all<true, bg::model::point<double, 2, bg::cs::cartesian> >();
 
 #if ! defined(BOOST_GEOMETRY_TEST_ONLY_ONE_ORDER)
     test_all<false, bg::model::point<default_test_type, 2, bg::cs::cartesian> >();
+    test_clustered_all<false, bg::model::point<double, 2, bg::cs::cartesian> >();
 #endif
 
 #if defined(BOOST_GEOMETRY_COMPILER_MODE_RELEASE) && ! defined(BOOST_GEOMETRY_COMPILER_MODE_DEBUG)
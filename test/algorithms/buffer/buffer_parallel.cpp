@@ -0,0 +1,144 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/buffer_parallel.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/buffer.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+
+
+template <typename Geometry, typename JoinStrategy>
+void test_one(std::string const& caseid, Geometry const& geometry,
+              double distance, JoinStrategy const& join_strategy)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+    bg::strategy::buffer::distance_symmetric<double> distance_strategy(distance);
+    bg::strategy::buffer::side_straight side_strategy;
+    bg::strategy::buffer::end_round end_strategy(12);
+    bg::strategy::buffer::point_circle point_strategy(12);
+
+    multi_polygon_type expected;
+    bg::buffer(geometry, expected, distance_strategy, side_strategy,
+               join_strategy, end_strategy, point_strategy);
+    double const expected_area = bg::area(expected);
+
+    std::size_t const thread_counts[] = { 1, 2, 3, 0 };
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        multi_polygon_type result;
+        bg::buffer_parallel(geometry, result, distance_strategy, side_strategy,
+                            join_strategy, end_strategy, point_strategy,
+                            thread_counts[i]);
+
+        BOOST_CHECK_MESSAGE(result.size() == expected.size(),
+            caseid << " threads: " << thread_counts[i]
+            << " polygons: " << result.size()
+            << " expected: " << expected.size());
+        BOOST_CHECK_MESSAGE(bg::math::abs(bg::area(result) - expected_area)
+                                <= 1.0e-9 * expected_area,
+            caseid << " threads: " << thread_counts[i]
+            << " area: " << bg::area(result)
+            << " expected: " << expected_area);
+        BOOST_CHECK_MESSAGE(bg::is_valid(result),
+            caseid << " threads: " << thread_counts[i] << " invalid");
+    }
+}
+
+// Roads in towns, some of them crossing each other
+template <typename MultiLinestring>
+void fill_roads(MultiLinestring& roads, int seed, int town_count, int road_count)
+{
+    typedef typename boost::range_value<MultiLinestring>::type linestring;
+    typedef typename bg::point_type<MultiLinestring>::type point_type;
+    typedef boost::minstd_rand base_generator_type;
+
+    base_generator_type generator(seed);
+    boost::uniform_int<> random_coordinate(0, 100);
+    boost::variate_generator<base_generator_type&, boost::uniform_int<> >
+        coordinate_generator(generator, random_coordinate);
+
+    for (int t = 0; t < town_count; t++)
+    {
+        double const x0 = (t % 5) * 200.0;
+        double const y0 = (t / 5) * 200.0;
+        for (int r = 0; r < road_count; r++)
+        {
+            linestring road;
+            for (int p = 0; p < 3; p++)
+            {
+                bg::append(road, point_type(x0 + coordinate_generator(),
+                                            y0 + coordinate_generator()));
+            }
+            roads.push_back(road);
+        }
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    bg::strategy::buffer::join_round join_round(12);
+    bg::strategy::buffer::join_miter join_miter;
+
+    multi_linestring roads;
+    fill_roads(roads, 12345, 10, 8);
+    test_one("roads", roads, 2.0, join_round);
+    test_one("roads_miter", roads, 2.0, join_miter);
+    // All towns are connected
+    test_one("roads_wide", roads, 60.0, join_round);
+
+    multi_linestring degenerate;
+    bg::read_wkt("MULTILINESTRING((5 5),(9 9),(4 10),(50 50,60 60),(70 70))", degenerate);
+    test_one("degenerate", degenerate, 1.0, join_round);
+
+    multi_point points;
+    bg::read_wkt("MULTIPOINT((0 0),(1 0),(10 0),(30 0),(31 1),(50 50))", points);
+    test_one("points", points, 1.0, join_round);
+
+    multi_polygon polygons;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2)),"
+                 "((11 0,11 10,20 10,20 0,11 0)),"
+                 "((40 0,40 10,50 10,50 0,40 0)),"
+                 "((100 100,100 110,110 110,110 100,100 100)))", polygons);
+    test_one("polygons", polygons, 1.0, join_round);
+    test_one("polygons_deflated", polygons, -1.0, join_round);
+    test_one("polygons_miter", polygons, 2.0, join_miter);
+
+    multi_polygon empty;
+    test_one("empty", empty, 1.0, join_round);
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/buffer_tiled.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/buffer.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename MultiPolygon, typename Box>
+struct tile_collector
+{
+    std::vector<Box> const& m_tiles;
+    std::vector<double> m_areas;
+    std::size_t m_count;
+    bool m_in_order;
+    bool m_valid;
+    bool m_within_tile;
+
+    explicit tile_collector(std::vector<Box> const& tiles)
+        : m_tiles(tiles)
+        , m_count(0)
+        , m_in_order(true)
+        , m_valid(true)
+        , m_within_tile(true)
+    {}
+
+    inline void apply(std::size_t index, MultiPolygon const& result)
+    {
+        m_in_order = m_in_order && index == m_count;
+        m_count++;
+        m_areas.push_back(bg::area(result));
+        m_valid = m_valid && bg::is_valid(result);
+
+        // Intersection points on the tile border can be slightly outside
+        Box envelope;
+        if (! result.empty())
+        {
+            Box const& tile = m_tiles[index];
+            bg::envelope(result, envelope);
+            m_within_tile = m_within_tile
+                && bg::get<bg::min_corner, 0>(envelope) >= bg::get<bg::min_corner, 0>(tile) - 1.0e-9
+                && bg::get<bg::min_corner, 1>(envelope) >= bg::get<bg::min_corner, 1>(tile) - 1.0e-9
+                && bg::get<bg::max_corner, 0>(envelope) <= bg::get<bg::max_corner, 0>(tile) + 1.0e-9
+                && bg::get<bg::max_corner, 1>(envelope) <= bg::get<bg::max_corner, 1>(tile) + 1.0e-9;
+        }
+    }
+};
+
+// Tiles covering the buffered envelope of the geometry, and one tile beyond
+template <typename Geometry, typename Box>
+void fill_tiles(Geometry const& geometry, double distance, int columns,
+                int rows, std::vector<Box>& tiles)
+{
+    typedef typename bg::point_type<Box>::type point_type;
+
+    Box envelope;
+    bg::envelope(geometry, envelope);
+    double const margin = bg::math::abs(distance) * 3.0 + 1.0;
+    double const x0 = bg::get<bg::min_corner, 0>(envelope) - margin;
+    double const y0 = bg::get<bg::min_corner, 1>(envelope) - margin;
+    double const dx = (bg::get<bg::max_corner, 0>(envelope) + margin - x0) / columns;
+    double const dy = (bg::get<bg::max_corner, 1>(envelope) + margin - y0) / rows;
+    for (int r = 0; r < rows; r++)
+    {
+        for (int c = 0; c < columns; c++)
+        {
+            tiles.push_back(Box(point_type(x0 + c * dx, y0 + r * dy),
+                                point_type(x0 + (c + 1) * dx, y0 + (r + 1) * dy)));
+        }
+    }
+}
+
+template <typename Geometry, typename JoinStrategy>
+void test_one(std::string const& caseid, std::string const& wkt,
+              double distance, JoinStrategy const& join_strategy,
+              int columns = 4, int rows = 3)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+    typedef bg::model::box<point_type> box_type;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::strategy::buffer::distance_symmetric<double> distance_strategy(distance);
+    bg::strategy::buffer::side_straight side_strategy;
+    bg::strategy::buffer::end_round end_strategy(16);
+    bg::strategy::buffer::point_circle point_strategy(16);
+
+    multi_polygon_type buffered;
+    bg::buffer(geometry, buffered, distance_strategy, side_strategy,
+               join_strategy, end_strategy, point_strategy);
+
+    std::vector<box_type> tiles;
+    fill_tiles(geometry, distance, columns, rows, tiles);
+
+    tile_collector<multi_polygon_type, box_type> collector(tiles);
+    bg::buffer_tiled<multi_polygon_type>(geometry, tiles, collector,
+        distance_strategy, side_strategy, join_strategy, end_strategy,
+        point_strategy);
+
+    BOOST_CHECK_MESSAGE(collector.m_count == tiles.size() && collector.m_in_order,
+        caseid << " tiles visited: " << collector.m_count
+        << " expected: " << tiles.size());
+    BOOST_CHECK_MESSAGE(collector.m_valid, caseid << " invalid");
+    BOOST_CHECK_MESSAGE(collector.m_within_tile, caseid << " outside tile");
+
+    double total = 0.0;
+    double const tolerance = 1.0e-6 * (bg::area(buffered) + 1.0);
+    for (std::size_t i = 0; i < collector.m_areas.size() && i < tiles.size(); i++)
+    {
+        multi_polygon_type expected;
+        bg::intersection(buffered, tiles[i], expected);
+        double const expected_area = bg::area(expected);
+        BOOST_CHECK_MESSAGE(bg::math::abs(collector.m_areas[i] - expected_area) <= tolerance,
+            caseid << " tile: " << i
+            << " area: " << collector.m_areas[i]
+            << " expected: " << expected_area);
+        total += collector.m_areas[i];
+    }
+
+    BOOST_CHECK_MESSAGE(tiles.empty()
+            || bg::math::abs(total - bg::area(buffered)) <= tolerance,
+        caseid << " total area: " << total
+        << " expected: " << bg::area(buffered));
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, false> ccw_polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    bg::strategy::buffer::join_round join_round(16);
+    bg::strategy::buffer::join_miter join_miter;
+
+    std::string const road = "LINESTRING(0 0,10 3,20 0,25 15,5 20,30 25)";
+    std::string const roads = "MULTILINESTRING((0 0,10 3,20 0,25 15),"
+        "(5 20,30 25),(0 12,40 12),(60 60,70 70))";
+    std::string const points = "MULTIPOINT((0 0),(1 0),(10 0),(30 0),(31 1),(50 50))";
+    std::string const polygons = "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2)),"
+        "((11 0,11 10,20 10,20 0,11 0)),"
+        "((40 0,40 10,50 10,50 0,40 0)))";
+    std::string const concave = "POLYGON((0 0,0 20,20 20,20 0,15 0,15 15,5 15,5 0,0 0))";
+
+    test_one<linestring>("road", road, 2.0, join_round);
+    test_one<linestring>("road_miter", road, 2.0, join_miter);
+    test_one<linestring>("road_fine", road, 1.0, join_round, 10, 10);
+    test_one<multi_linestring>("roads", roads, 1.5, join_round);
+    test_one<multi_point>("points", points, 1.0, join_round);
+    test_one<multi_polygon>("polygons", polygons, 1.0, join_round);
+    test_one<multi_polygon>("polygons_miter", polygons, 1.0, join_miter, 5, 5);
+    test_one<multi_polygon>("polygons_deflated", polygons, -0.5, join_round);
+    test_one<polygon>("concave", concave, 2.0, join_round, 3, 3);
+    test_one<ccw_polygon>("concave_ccw", "POLYGON((0 0,5 0,5 15,15 15,15 0,20 0,20 20,0 20,0 0))",
+                          2.0, join_round, 3, 3);
+    test_one<polygon>("concave_deflated", concave, -1.0, join_round, 3, 3);
+    test_one<multi_polygon>("polygons_deflated_fine", polygons, -0.5, join_round, 8, 6);
+
+    // No tiles
+    test_one<linestring>("road_no_tiles", road, 2.0, join_round, 0, 0);
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
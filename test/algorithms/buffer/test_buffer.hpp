@@ -81,6 +81,11 @@ template<> struct JoinTestProperties<boost::geometry::strategy::buffer::join_rou
     static std::string name() { return "divide"; }
 };
 
+template<> struct JoinTestProperties<boost::geometry::strategy::buffer::join_round_by_rotation>
+{
+    static std::string name() { return "rotation"; }
+};
+
 
 //-----------------------------------------------------------------------------
 template <typename EndStrategy>
@@ -502,6 +502,18 @@ void test_many_boxes(int seed, int size, int count)
 
     BOOST_CHECK_EQUAL(visitor.count, expected_count);
     BOOST_CHECK_CLOSE(visitor.area, expected_area, 0.001);
+
+    box_visitor<box_type> adaptive_visitor;
+    bg::partition
+        <
+            box_type,
+            bg::detail::partition::include_all_policy,
+            bg::detail::partition::include_all_policy,
+            bg::detail::partition::divide_adaptive
+        >::apply(boxes, adaptive_visitor, get_box(), ovelaps_box(), 2);
+
+    BOOST_CHECK_EQUAL(adaptive_visitor.count, expected_count);
+    BOOST_CHECK_CLOSE(adaptive_visitor.area, expected_area, 0.001);
 }
 
 void test_two_collections(int seed1, int seed2, int size, int count)
@@ -570,6 +582,19 @@ void test_two_collections(int seed1, int seed2, int size, int count)
 
     BOOST_CHECK_EQUAL(visitor.count, expected_count);
     BOOST_CHECK_CLOSE(visitor.area, expected_area, 0.001);
+
+    box_visitor<box_type> adaptive_visitor;
+    bg::partition
+        <
+            box_type,
+            bg::detail::partition::include_all_policy,
+            bg::detail::partition::include_all_policy,
+            bg::detail::partition::divide_adaptive
+        >::apply(boxes1, boxes2, adaptive_visitor, get_box(), ovelaps_box(),
+                 get_box(), ovelaps_box(), 2);
+
+    BOOST_CHECK_EQUAL(adaptive_visitor.count, expected_count);
+    BOOST_CHECK_CLOSE(adaptive_visitor.area, expected_area, 0.001);
 }
 
 
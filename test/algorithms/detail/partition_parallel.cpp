@@ -0,0 +1,223 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/detail/partition_parallel.hpp>
+
+#include <boost/geometry/strategies/cartesian.hpp>
+
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef std::vector<std::pair<int, int> > pairs_type;
+
+struct box_item
+{
+    int id;
+    box_type box;
+};
+
+struct get_box
+{
+    template <typename Box>
+    static inline void apply(Box& total, box_item const& item)
+    {
+        bg::expand(total, item.box);
+    }
+};
+
+struct overlaps_box
+{
+    template <typename Box>
+    static inline bool apply(Box const& box, box_item const& item)
+    {
+        return ! bg::detail::disjoint::disjoint_box_box(box, item.box,
+                    bg::strategy::disjoint::cartesian_box_box());
+    }
+};
+
+struct include_even
+{
+    static inline bool apply(box_item const& item)
+    {
+        return item.id % 2 == 0;
+    }
+};
+
+// Collects all visited pairs, optionally interrupting at an item
+struct pair_collector
+{
+    pairs_type pairs;
+    int stop_id;
+
+    explicit pair_collector(int id)
+        : stop_id(id)
+    {}
+
+    inline bool apply(box_item const& item1, box_item const& item2)
+    {
+        pairs.push_back(std::make_pair(item1.id, item2.id));
+        return item1.id != stop_id && item2.id != stop_id;
+    }
+};
+
+struct pair_visitor : pair_collector
+{
+    struct task_visitor_type : pair_collector
+    {
+        explicit task_visitor_type(pair_visitor const& visitor)
+            : pair_collector(visitor.stop_id)
+        {}
+    };
+
+    explicit pair_visitor(int id)
+        : pair_collector(id)
+    {}
+
+    inline void merge(task_visitor_type const& task_visitor)
+    {
+        pairs.insert(pairs.end(), task_visitor.pairs.begin(),
+                     task_visitor.pairs.end());
+    }
+};
+
+void fill_boxes(std::vector<box_item>& items, int seed, int count, int size)
+{
+    typedef boost::minstd_rand base_generator_type;
+
+    base_generator_type generator(seed);
+
+    boost::uniform_int<> random_coordinate(0, 10000);
+    boost::uniform_int<> random_size(1, size);
+    boost::variate_generator<base_generator_type&, boost::uniform_int<> >
+        coordinate_generator(generator, random_coordinate);
+    boost::variate_generator<base_generator_type&, boost::uniform_int<> >
+        size_generator(generator, random_size);
+
+    for (int i = 0; i < count; i++)
+    {
+        box_item item;
+        item.id = i;
+        double const x = coordinate_generator();
+        double const y = coordinate_generator();
+        // Some boxes are large, these are exceeding at the top levels
+        double const s = i % 97 == 0 ? 2000.0 : size_generator();
+        item.box = box_type(point_type(x, y), point_type(x + s, y + s));
+        items.push_back(item);
+    }
+}
+
+template <typename IncludePolicy>
+void test_one_range(std::string const& caseid,
+                    std::vector<box_item> const& items, int stop_id)
+{
+    pair_visitor expected(stop_id);
+    bool const expected_result = bg::partition
+        <
+            box_type, IncludePolicy
+        >::apply(items, expected, get_box(), overlaps_box(), 16);
+
+    std::size_t const task_sizes[] = { 0, 100, 1000, 100000 };
+    std::size_t const thread_counts[] = { 1, 2, 3, 0 };
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        for (std::size_t j = 0; j < 4; j++)
+        {
+            pair_visitor visitor(stop_id);
+            bool const result = bg::partition_parallel
+                <
+                    box_type, IncludePolicy
+                >::apply(items, visitor, get_box(), overlaps_box(), 16,
+                         task_sizes[i], thread_counts[j]);
+
+            BOOST_CHECK_MESSAGE(result == expected_result
+                                && visitor.pairs == expected.pairs,
+                caseid << " task size: " << task_sizes[i]
+                << " threads: " << thread_counts[j]
+                << " pairs: " << visitor.pairs.size()
+                << " expected: " << expected.pairs.size());
+        }
+    }
+}
+
+void test_two_ranges(std::string const& caseid,
+                     std::vector<box_item> const& items1,
+                     std::vector<box_item> const& items2,
+                     int stop_id)
+{
+    pair_visitor expected(stop_id);
+    bool const expected_result = bg::partition
+        <
+            box_type
+        >::apply(items1, items2, expected, get_box(), overlaps_box(),
+                 get_box(), overlaps_box(), 16);
+
+    std::size_t const task_sizes[] = { 0, 100, 1000, 100000 };
+    std::size_t const thread_counts[] = { 1, 2, 3, 0 };
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        for (std::size_t j = 0; j < 4; j++)
+        {
+            pair_visitor visitor(stop_id);
+            bool const result = bg::partition_parallel
+                <
+                    box_type
+                >::apply(items1, items2, visitor, get_box(), overlaps_box(),
+                         get_box(), overlaps_box(), 16,
+                         task_sizes[i], thread_counts[j]);
+
+            BOOST_CHECK_MESSAGE(result == expected_result
+                                && visitor.pairs == expected.pairs,
+                caseid << " task size: " << task_sizes[i]
+                << " threads: " << thread_counts[j]
+                << " pairs: " << visitor.pairs.size()
+                << " expected: " << expected.pairs.size());
+        }
+    }
+}
+
+void test_all()
+{
+    std::vector<box_item> items1, items2, small;
+    fill_boxes(items1, 12345, 5000, 100);
+    fill_boxes(items2, 54321, 3000, 300);
+    fill_boxes(small, 1, 10, 100);
+
+    test_one_range<bg::detail::partition::include_all_policy>("one", items1, -1);
+    test_one_range<include_even>("one_even", items1, -1);
+    test_two_ranges("two", items1, items2, -1);
+    test_two_ranges("two_small", items1, small, -1);
+
+    // Interrupted, the same pairs are visited up to the interruption
+    test_one_range<bg::detail::partition::include_all_policy>("one_interrupted", items1, 2500);
+    test_one_range<bg::detail::partition::include_all_policy>("one_interrupted", items1, 97);
+    test_two_ranges("two_interrupted", items1, items2, 1500);
+    test_two_ranges("two_interrupted", items1, items2, 4999);
+}
+
+
+int test_main(int, char* [])
+{
+    test_all();
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/detail/sections/sectionalize_parallel.hpp>
+
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
+#include <boost/geometry/strategies/cartesian.hpp>
+
+
+template <typename Sections>
+void check_sections(std::string const& caseid,
+                    Sections const& expected, Sections const& sections)
+{
+    BOOST_CHECK_MESSAGE(expected.size() == sections.size(),
+        caseid << " section count: " << sections.size()
+        << " expected: " << expected.size());
+    if (expected.size() != sections.size())
+    {
+        return;
+    }
+
+    for (std::size_t i = 0; i < sections.size(); i++)
+    {
+        typename Sections::value_type const& e = expected[i];
+        typename Sections::value_type const& s = sections[i];
+
+        bool equal = e.ring_id == s.ring_id
+            && e.begin_index == s.begin_index
+            && e.end_index == s.end_index
+            && e.count == s.count
+            && e.range_count == s.range_count
+            && e.duplicate == s.duplicate
+            && e.non_duplicate_index == s.non_duplicate_index
+            && e.is_non_duplicate_first == s.is_non_duplicate_first
+            && e.is_non_duplicate_last == s.is_non_duplicate_last
+            && bg::get<bg::min_corner, 0>(e.bounding_box) == bg::get<bg::min_corner, 0>(s.bounding_box)
+            && bg::get<bg::min_corner, 1>(e.bounding_box) == bg::get<bg::min_corner, 1>(s.bounding_box)
+            && bg::get<bg::max_corner, 0>(e.bounding_box) == bg::get<bg::max_corner, 0>(s.bounding_box)
+            && bg::get<bg::max_corner, 1>(e.bounding_box) == bg::get<bg::max_corner, 1>(s.bounding_box);
+        for (std::size_t d = 0; d < Sections::value; d++)
+        {
+            equal = equal && e.directions[d] == s.directions[d];
+        }
+
+        BOOST_CHECK_MESSAGE(equal, caseid << " section " << i << " differs");
+    }
+}
+
+template <typename DimensionVector, typename Geometry, typename RobustPolicy>
+void test_geometry(std::string const& caseid, Geometry const& geometry,
+                   RobustPolicy const& robust_policy)
+{
+    typedef typename bg::robust_point_type
+        <
+            typename bg::point_type<Geometry>::type, RobustPolicy
+        >::type robust_point_type;
+    typedef bg::model::box<robust_point_type> box_type;
+    typedef bg::sections<box_type, bg::util::sequence_size<DimensionVector>::value> sections_type;
+
+    typename bg::strategies::relate::services::default_strategy
+        <
+            Geometry, Geometry
+        >::type strategy;
+
+    sections_type expected;
+    bg::sectionalize<false, DimensionVector>(geometry, robust_policy,
+                                             expected, strategy, 1, 10);
+
+    // Also with one thread, and with pre-filled sections
+    std::size_t const thread_counts[] = { 1, 2, 4, 0 };
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        sections_type sections;
+        sections.resize(3);
+        bg::sectionalize_parallel<false, DimensionVector>(geometry,
+            robust_policy, sections, strategy, 1, 10, thread_counts[i]);
+        check_sections(caseid, expected, sections);
+    }
+}
+
+template <typename Geometry>
+void test_geometry(std::string const& caseid, Geometry const& geometry)
+{
+    typedef typename bg::rescale_policy_type
+        <
+            typename bg::point_type<Geometry>::type
+        >::type rescale_policy_type;
+    typedef std::integer_sequence<std::size_t, 0> dimensions1;
+    typedef std::integer_sequence<std::size_t, 0, 1> dimensions2;
+
+    BOOST_CHECK_GT(bg::num_points(geometry), 10000u);
+
+    test_geometry<dimensions1>(caseid + "_x", geometry, bg::detail::no_rescale_policy());
+    test_geometry<dimensions2>(caseid + "_xy", geometry, bg::detail::no_rescale_policy());
+    test_geometry<dimensions2>(caseid + "_rescaled", geometry,
+                               bg::get_rescale_policy<rescale_policy_type>(geometry));
+}
+
+// Star shaped ring with duplicate points
+template <typename Ring>
+void make_star(Ring& ring, double cx, double cy, double radius, int count)
+{
+    typedef typename bg::point_type<Ring>::type point_type;
+    typedef typename bg::coordinate_type<point_type>::type coordinate_type;
+
+    double const pi = bg::math::pi<double>();
+    for (int i = 0; i <= count; i++)
+    {
+        double const angle = -2.0 * pi * (i % count) / count;
+        double const r = i % 2 == 0 ? radius : radius * (0.4 + 0.05 * (i % 7));
+        point_type const p(coordinate_type(cx + r * std::cos(angle)),
+                           coordinate_type(cy + r * std::sin(angle)));
+        bg::append(ring, p);
+        if (i % 97 == 0 && i < count)
+        {
+            bg::append(ring, p);
+            bg::append(ring, p);
+        }
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+
+    multi_polygon mp;
+    for (int i = 0; i < 8; i++)
+    {
+        polygon poly;
+        make_star(bg::exterior_ring(poly), i * 30.0, 0.0, 10.0, 2000 + i * 1500);
+        for (int j = 0; j < i; j++)
+        {
+            typename polygon::ring_type hole;
+            make_star(hole, i * 30.0, 0.0, 2.0, 100 + j * 10);
+            std::reverse(hole.begin(), hole.end());
+            bg::interior_rings(poly).push_back(hole);
+        }
+        mp.push_back(poly);
+    }
+    test_geometry("multi_polygon", mp);
+    test_geometry("polygon", mp[7]);
+
+    ring r;
+    make_star(r, 0.0, 0.0, 10.0, 20000);
+    test_geometry("ring", r);
+
+    // Long monotonic parts, and duplicate points, at the split positions
+    linestring ls;
+    for (int i = 0; i < 30000; i++)
+    {
+        int const x = i < 15000 ? i : 15000 + (i % 3);
+        bg::append(ls, P(x, i % 4096 < 3 ? 0 : i));
+        if (i % 4096 == 0)
+        {
+            bg::append(ls, P(x, i % 4096 < 3 ? 0 : i));
+        }
+    }
+    test_geometry("linestring", ls);
+
+    multi_linestring mls;
+    for (int i = 0; i < 5; i++)
+    {
+        linestring ls;
+        make_star(ls, 0.0, i * 30.0, 10.0, 3000);
+        mls.push_back(ls);
+    }
+    test_geometry("multi_linestring", mls);
+
+    // A small geometry is sectionalized in the calling thread
+    polygon small;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))", small);
+    typedef bg::sections<bg::model::box<P>, 2> sections_type;
+    sections_type expected, sections;
+    bg::sectionalize<false, std::integer_sequence<std::size_t, 0, 1> >(small,
+        bg::detail::no_rescale_policy(), expected);
+    bg::sectionalize_parallel<false, std::integer_sequence<std::size_t, 0, 1> >(small,
+        bg::detail::no_rescale_policy(), sections,
+        bg::strategies::relate::cartesian<>(), 0, 10, 4);
+    check_sections("small", expected, sections);
+    BOOST_CHECK_EQUAL(sections.size(), 8u);
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_all<bg::model::point<float, 2, bg::cs::cartesian> >();
+    test_all<bg::model::point<int, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
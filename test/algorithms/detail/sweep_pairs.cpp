@@ -0,0 +1,262 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/detail/sweep_pairs.hpp>
+
+#include <boost/geometry/strategies/cartesian.hpp>
+
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef std::vector<std::pair<int, int> > pairs_type;
+
+struct box_item
+{
+    int id;
+    box_type box;
+};
+
+struct get_box
+{
+    template <typename Box>
+    static inline void apply(Box& total, box_item const& item)
+    {
+        bg::expand(total, item.box);
+    }
+};
+
+struct include_even
+{
+    static inline bool apply(box_item const& item)
+    {
+        return item.id % 2 == 0;
+    }
+};
+
+// Collects all visited pairs, optionally interrupting at an item
+struct pair_visitor
+{
+    pairs_type pairs;
+    int stop_id;
+
+    explicit pair_visitor(int id = -1)
+        : stop_id(id)
+    {}
+
+    inline bool apply(box_item const& item1, box_item const& item2)
+    {
+        pairs.push_back(std::make_pair(item1.id, item2.id));
+        return item1.id != stop_id && item2.id != stop_id;
+    }
+};
+
+// Boxes along a line, like sections of a river or a road
+void fill_boxes(std::vector<box_item>& items, int seed, int count,
+                double dx, double dy)
+{
+    typedef boost::minstd_rand base_generator_type;
+
+    base_generator_type generator(seed);
+
+    boost::uniform_int<> random_offset(0, 100);
+    boost::uniform_int<> random_size(1, 50);
+    boost::variate_generator<base_generator_type&, boost::uniform_int<> >
+        offset_generator(generator, random_offset);
+    boost::variate_generator<base_generator_type&, boost::uniform_int<> >
+        size_generator(generator, random_size);
+
+    for (int i = 0; i < count; i++)
+    {
+        box_item item;
+        item.id = i;
+        double const x = i * dx + offset_generator();
+        double const y = i * dy + offset_generator();
+        item.box = box_type(point_type(x, y),
+                            point_type(x + size_generator(), y + size_generator()));
+        items.push_back(item);
+    }
+}
+
+template <typename IncludePolicy>
+pairs_type expected_pairs(std::vector<box_item> const& items)
+{
+    pairs_type result;
+    for (std::size_t i = 0; i < items.size(); i++)
+    {
+        for (std::size_t j = i + 1; j < items.size(); j++)
+        {
+            if (IncludePolicy::apply(items[i]) && IncludePolicy::apply(items[j])
+                && bg::intersects(items[i].box, items[j].box))
+            {
+                result.push_back(std::make_pair(items[i].id, items[j].id));
+            }
+        }
+    }
+    return result;
+}
+
+pairs_type expected_pairs(std::vector<box_item> const& items1,
+                          std::vector<box_item> const& items2)
+{
+    pairs_type result;
+    for (std::size_t i = 0; i < items1.size(); i++)
+    {
+        for (std::size_t j = 0; j < items2.size(); j++)
+        {
+            if (bg::intersects(items1[i].box, items2[j].box))
+            {
+                result.push_back(std::make_pair(items1[i].id, items2[j].id));
+            }
+        }
+    }
+    return result;
+}
+
+template <typename IncludePolicy>
+void test_one_range(std::string const& caseid,
+                    std::vector<box_item> const& items)
+{
+    pair_visitor visitor;
+    bool const result = bg::sweep_pairs
+        <
+            box_type, IncludePolicy
+        >::apply(items, visitor, get_box());
+
+    // Pairs are visited in the order of the sweep, the item first in the
+    // input is passed first
+    std::sort(visitor.pairs.begin(), visitor.pairs.end());
+    pairs_type const expected = expected_pairs<IncludePolicy>(items);
+
+    BOOST_CHECK_MESSAGE(result && visitor.pairs == expected,
+        caseid << " pairs: " << visitor.pairs.size()
+        << " expected: " << expected.size());
+}
+
+void test_two_ranges(std::string const& caseid,
+                     std::vector<box_item> const& items1,
+                     std::vector<box_item> const& items2)
+{
+    pair_visitor visitor;
+    bool const result = bg::sweep_pairs
+        <
+            box_type
+        >::apply(items1, items2, visitor, get_box());
+
+    std::sort(visitor.pairs.begin(), visitor.pairs.end());
+    pairs_type const expected = expected_pairs(items1, items2);
+
+    BOOST_CHECK_MESSAGE(result && visitor.pairs == expected,
+        caseid << " pairs: " << visitor.pairs.size()
+        << " expected: " << expected.size());
+}
+
+// The sweep stops at the first pair with stop_id, all pairs visited
+// before it are overlapping pairs, visited once
+void check_interrupted(pair_visitor const& visitor, bool result,
+                       pairs_type const& all, int stop_id)
+{
+    pairs_type visited = visitor.pairs;
+    BOOST_CHECK(! result);
+    BOOST_CHECK(! visited.empty()
+                && (visited.back().first == stop_id
+                    || visited.back().second == stop_id));
+    BOOST_CHECK(std::count_if(visited.begin(), visited.end(),
+                    [&](std::pair<int, int> const& pair)
+                    {
+                        return pair.first == stop_id || pair.second == stop_id;
+                    }) == 1);
+
+    std::sort(visited.begin(), visited.end());
+    BOOST_CHECK(std::unique(visited.begin(), visited.end()) == visited.end());
+    BOOST_CHECK(std::includes(all.begin(), all.end(),
+                              visited.begin(), visited.end()));
+
+    // The items are far apart in the sweep, so most pairs are not visited
+    BOOST_CHECK_MESSAGE(visited.size() * 4 < all.size(),
+        "visited: " << visited.size() << " all: " << all.size());
+}
+
+void test_interrupted(std::vector<box_item> const& items, int stop_id)
+{
+    pair_visitor visitor(stop_id);
+    bool const result = bg::sweep_pairs
+        <
+            box_type
+        >::apply(items, visitor, get_box());
+
+    check_interrupted(visitor, result,
+        expected_pairs<bg::detail::partition::include_all_policy>(items),
+        stop_id);
+}
+
+void test_interrupted(std::vector<box_item> const& items1,
+                      std::vector<box_item> const& items2,
+                      int stop_id)
+{
+    pair_visitor visitor(stop_id);
+    bool const result = bg::sweep_pairs
+        <
+            box_type
+        >::apply(items1, items2, visitor, get_box());
+
+    check_interrupted(visitor, result, expected_pairs(items1, items2), stop_id);
+}
+
+void test_all()
+{
+    std::vector<box_item> horizontal, vertical, diagonal, empty;
+    fill_boxes(horizontal, 12345, 2000, 5.0, 0.1);
+    fill_boxes(vertical, 54321, 1500, 0.2, 6.0);
+    fill_boxes(diagonal, 1, 1000, 7.0, 7.0);
+
+    test_one_range<bg::detail::partition::include_all_policy>("horizontal", horizontal);
+    test_one_range<bg::detail::partition::include_all_policy>("vertical", vertical);
+    test_one_range<include_even>("horizontal_even", horizontal);
+    test_one_range<bg::detail::partition::include_all_policy>("empty", empty);
+
+    test_two_ranges("horizontal_vertical", horizontal, vertical);
+    test_two_ranges("horizontal_diagonal", horizontal, diagonal);
+    test_two_ranges("vertical_diagonal", vertical, diagonal);
+    test_two_ranges("horizontal_empty", horizontal, empty);
+
+    // Touching boxes are visited
+    std::vector<box_item> touching(2);
+    touching[0].id = 0;
+    touching[0].box = box_type(point_type(0, 0), point_type(1, 1));
+    touching[1].id = 1;
+    touching[1].box = box_type(point_type(1, 1), point_type(2, 2));
+    test_one_range<bg::detail::partition::include_all_policy>("touching", touching);
+    BOOST_CHECK_EQUAL(expected_pairs<bg::detail::partition::include_all_policy>(touching).size(), 1u);
+
+    test_interrupted(horizontal, 100);
+    test_interrupted(horizontal, horizontal, 100);
+}
+
+
+int test_main(int, char* [])
+{
+    test_all();
+
+    return 0;
+}
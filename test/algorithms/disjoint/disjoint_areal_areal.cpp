@@ -0,0 +1,261 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/segments.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/relate.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Multi polygon with count x count diamonds of the given radius, in cells
+// of size 1, optionally with a diamond shaped hole in every diamond
+std::string diamonds(int count, double radius, double hole = 0.0)
+{
+    std::ostringstream out;
+    out << "MULTIPOLYGON(";
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            double const x = i + 0.5;
+            double const y = j + 0.5;
+            out << (i > 0 || j > 0 ? "," : "") << "(("
+                << x - radius << " " << y << ","
+                << x << " " << y + radius << ","
+                << x + radius << " " << y << ","
+                << x << " " << y - radius << ","
+                << x - radius << " " << y << ")";
+            if (hole > 0.0)
+            {
+                out << ",("
+                    << x - hole << " " << y << ","
+                    << x << " " << y - hole << ","
+                    << x + hole << " " << y << ","
+                    << x << " " << y + hole << ","
+                    << x - hole << " " << y << ")";
+            }
+            out << ")";
+        }
+    }
+    out << ")";
+    return out.str();
+}
+
+template <typename Geometry1, typename Geometry2>
+void test_areal(std::string const& caseid,
+                std::string const& wkt1, std::string const& wkt2,
+                bool expected)
+{
+    Geometry1 geometry1;
+    Geometry2 geometry2;
+    bg::read_wkt(wkt1, geometry1);
+    bg::read_wkt(wkt2, geometry2);
+    bg::correct(geometry1);
+    bg::correct(geometry2);
+
+    bool const detected12 = bg::disjoint(geometry1, geometry2);
+    bool const detected21 = bg::disjoint(geometry2, geometry1);
+    BOOST_CHECK_MESSAGE(detected12 == expected && detected21 == expected,
+        "disjoint: " << caseid << " " << typeid(Geometry1).name()
+        << " -> Expected: " << expected
+        << " detected: " << detected12 << " " << detected21);
+
+    // The same result as calculated from the turns
+    bool const related = bg::relate(geometry1, geometry2,
+                                    bg::de9im::mask("FF*FF****"));
+    BOOST_CHECK_MESSAGE(related == expected,
+        "relate: " << caseid << " " << typeid(Geometry1).name()
+        << " -> Expected: " << expected
+        << " detected: " << related);
+}
+
+template <typename Polygon, typename MultiPolygon>
+void test_polygons()
+{
+    std::string const square = "POLYGON((0 0,0 10,10 10,10 0,0 0))";
+    std::string const square_with_hole = "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))";
+
+    test_areal<Polygon, Polygon>("touching_vertex", square,
+        "POLYGON((10 10,10 20,20 20,20 10,10 10))", false);
+    test_areal<Polygon, Polygon>("touching_edge", square,
+        "POLYGON((10 2,10 5,20 5,20 2,10 2))", false);
+    test_areal<Polygon, Polygon>("crossing", square,
+        "POLYGON((5 5,5 15,15 15,15 5,5 5))", false);
+    test_areal<Polygon, Polygon>("nested", square,
+        "POLYGON((2 2,2 8,8 8,8 2,2 2))", false);
+    test_areal<Polygon, Polygon>("separated", square,
+        "POLYGON((12 2,12 8,18 8,18 2,12 2))", true);
+    test_areal<Polygon, Polygon>("inside_hole", square_with_hole,
+        "POLYGON((3 3,3 7,7 7,7 3,3 3))", true);
+    test_areal<Polygon, Polygon>("touching_hole", square_with_hole,
+        "POLYGON((2 2,3 7,7 7,7 3,2 2))", false);
+    test_areal<Polygon, Polygon>("filling_hole", square_with_hole,
+        "POLYGON((2 2,2 8,8 8,8 2,2 2))", false);
+    test_areal<Polygon, Polygon>("crossing_hole", square_with_hole,
+        "POLYGON((3 3,3 9,7 9,7 3,3 3))", false);
+
+    // Duplicate points, also at the touching vertex
+    test_areal<Polygon, Polygon>("duplicates_touching",
+        "POLYGON((0 0,0 0,0 10,10 10,10 10,10 10,10 0,0 0,0 0))",
+        "POLYGON((10 10,10 10,10 20,20 20,20 20,20 10,10 10))", false);
+    test_areal<Polygon, Polygon>("duplicates_crossing",
+        "POLYGON((0 0,0 10,0 10,10 10,10 0,10 0,0 0))",
+        "POLYGON((5 5,5 5,5 15,15 15,15 5,5 5,5 5))", false);
+    test_areal<Polygon, Polygon>("duplicates_separated",
+        "POLYGON((0 0,0 0,0 10,10 10,10 10,10 0,0 0))",
+        "POLYGON((12 2,12 2,12 8,18 8,18 8,18 2,12 2))", true);
+
+    std::string const multi = "MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),((20 20,20 30,30 30,30 20,20 20)))";
+    test_areal<MultiPolygon, Polygon>("multi_nested", multi,
+        "POLYGON((22 22,22 28,28 28,28 22,22 22))", false);
+    test_areal<MultiPolygon, Polygon>("multi_between", multi,
+        "POLYGON((5 5,5 15,15 15,15 5,5 5))", true);
+    test_areal<MultiPolygon, MultiPolygon>("multi_touching", multi,
+        "MULTIPOLYGON(((5 5,5 6,6 6,6 5,5 5)),((30 25,30 26,31 26,31 25,30 25)))", false);
+
+    // More than 256 overlapping section pairs, so the pairs are passed to
+    // the intersection test in several batches
+    std::string const holes = diamonds(12, 0.45, 0.3);
+    test_areal<MultiPolygon, MultiPolygon>("diamonds_in_holes", holes,
+        diamonds(12, 0.1), true);
+    test_areal<MultiPolygon, MultiPolygon>("diamonds_nested",
+        diamonds(12, 0.45), diamonds(12, 0.1), false);
+    test_areal<MultiPolygon, MultiPolygon>("diamonds_touching_holes", holes,
+        diamonds(12, 0.3), false);
+
+    // Only the last diamond crosses the border of its hole
+    std::string crossing = diamonds(12, 0.1);
+    crossing.insert(crossing.size() - 1, ",((11.1 11.5,11.5 11.9,11.9 11.5,11.5 11.1,11.1 11.5))");
+    test_areal<MultiPolygon, MultiPolygon>("diamonds_one_crossing", holes,
+        crossing, false);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::polygon<P, false, false> polygon_ccw_open;
+    typedef bg::model::multi_polygon<polygon_ccw_open> multi_polygon_ccw_open;
+
+    test_polygons<polygon, multi_polygon>();
+    test_polygons<polygon_ccw_open, multi_polygon_ccw_open>();
+
+    test_areal<bg::model::ring<P>, polygon>("ring_in_hole",
+        "POLYGON((3 3,3 7,7 7,7 3,3 3))",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))", true);
+    test_areal<bg::model::ring<P, false, false>, polygon>("ring_ccw_open_crossing",
+        "POLYGON((3 3,3 9,7 9,7 3,3 3))",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))", false);
+}
+
+
+// Section with only a box, as used by section_pair_batches
+struct test_section
+{
+    typedef bg::model::box<bg::model::d2::point_xy<double> > box_type;
+    box_type bounding_box;
+};
+
+struct recording_predicate
+{
+    recording_predicate(std::size_t found_index)
+        : found(found_index)
+    {}
+
+    bool operator()(test_section const& s1, test_section const& ) const
+    {
+        visited.push_back(&s1);
+        return std::size_t(&s1 - first) == found;
+    }
+
+    test_section const* first;
+    std::size_t found;
+    mutable std::vector<test_section const*> visited;
+};
+
+void test_batches()
+{
+    typedef bg::model::d2::point_xy<double> point;
+    typedef bg::detail::disjoint::section_pair_batches
+        <
+            test_section, test_section,
+            bg::strategy::disjoint::cartesian_box_box,
+            recording_predicate
+        > batches_type;
+
+    // Sections of increasing width, all overlapping the other section
+    std::vector<test_section> sections(600);
+    for (std::size_t i = 0; i < sections.size(); i++)
+    {
+        sections[i].bounding_box = test_section::box_type(point(0, 0), point(1.0 + i, 1));
+    }
+    test_section other;
+    other.bounding_box = test_section::box_type(point(0, 0), point(1000, 1));
+    test_section separated;
+    separated.bounding_box = test_section::box_type(point(0, 2), point(1000, 3));
+
+    {
+        recording_predicate predicate(sections.size());
+        predicate.first = &sections[0];
+        batches_type batches(predicate, bg::strategy::disjoint::cartesian_box_box(), 256);
+        for (std::size_t i = 0; i < sections.size(); i++)
+        {
+            BOOST_CHECK(batches.apply(sections[i], other));
+            BOOST_CHECK(batches.apply(sections[i], separated));
+            // Passed to the predicate per batch
+            BOOST_CHECK_EQUAL(predicate.visited.size(), (i + 1) / 256 * 256);
+        }
+        BOOST_CHECK(! batches.flush());
+        BOOST_CHECK_EQUAL(predicate.visited.size(), sections.size());
+
+        // Every pair once, the largest overlap of a batch first
+        for (std::size_t i = 0; i < predicate.visited.size(); i++)
+        {
+            std::size_t const batch_end = (std::min)(i / 256 * 256 + 256, sections.size());
+            BOOST_CHECK(predicate.visited[i] == &sections[batch_end - 1 - i % 256]);
+        }
+    }
+
+    {
+        // Found in the second batch, the third batch is not visited
+        recording_predicate predicate(300);
+        predicate.first = &sections[0];
+        batches_type batches(predicate, bg::strategy::disjoint::cartesian_box_box(), 256);
+        std::size_t i = 0;
+        for (; i < sections.size() && batches.apply(sections[i], other); i++)
+        {}
+        BOOST_CHECK_EQUAL(i, 511u);
+        BOOST_CHECK_EQUAL(predicate.visited.size(), 256u + 512u - 300u);
+        BOOST_CHECK(predicate.visited.back() == &sections[300]);
+        BOOST_CHECK(batches.flush());
+        BOOST_CHECK_EQUAL(predicate.visited.size(), 256u + 512u - 300u);
+    }
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > >();
+    test_all<bg::model::point<double, 2, bg::cs::geographic<bg::degree> > >();
+
+    test_batches();
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sstream>
+#include <string>
+
+#include "test_intersects.hpp"
+
+#include <boost/geometry/geometries/geometries.hpp>
+
+
+// Multi polygon with count x count diamonds of the given radius, in cells
+// of size 1, optionally with a diamond shaped hole in every diamond
+std::string diamonds(int count, double radius, double hole = 0.0)
+{
+    std::ostringstream out;
+    out << "MULTIPOLYGON(";
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            double const x = i + 0.5;
+            double const y = j + 0.5;
+            out << (i > 0 || j > 0 ? "," : "") << "(("
+                << x - radius << " " << y << ","
+                << x << " " << y + radius << ","
+                << x + radius << " " << y << ","
+                << x << " " << y - radius << ","
+                << x - radius << " " << y << ")";
+            if (hole > 0.0)
+            {
+                out << ",("
+                    << x - hole << " " << y << ","
+                    << x << " " << y - hole << ","
+                    << x + hole << " " << y << ","
+                    << x << " " << y + hole << ","
+                    << x - hole << " " << y << ")";
+            }
+            out << ")";
+        }
+    }
+    out << ")";
+    return out.str();
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> poly;
+    typedef bg::model::multi_polygon<poly> mpoly;
+    typedef bg::model::polygon<P, true, false> poly_open;
+    typedef bg::model::ring<P> ring;
+
+    std::string const square = "POLYGON((0 0,0 10,10 10,10 0,0 0))";
+    std::string const square_with_hole = "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))";
+
+    test_geometry<poly, poly>(square, "POLYGON((10 10,10 20,20 20,20 10,10 10))", true);
+    test_geometry<poly, poly>(square, "POLYGON((10 2,10 5,20 5,20 2,10 2))", true);
+    test_geometry<poly, poly>(square, "POLYGON((5 5,5 15,15 15,15 5,5 5))", true);
+    test_geometry<poly, poly>(square, "POLYGON((2 2,2 8,8 8,8 2,2 2))", true);
+    test_geometry<poly, poly>(square, "POLYGON((12 2,12 8,18 8,18 2,12 2))", false);
+    test_geometry<poly, poly>(square_with_hole, "POLYGON((3 3,3 7,7 7,7 3,3 3))", false);
+    test_geometry<poly, poly>(square_with_hole, "POLYGON((2 2,3 7,7 7,7 3,2 2))", true);
+    test_geometry<poly, poly>(square_with_hole, "POLYGON((3 3,3 9,7 9,7 3,3 3))", true);
+    test_geometry<poly, ring>(square_with_hole, "POLYGON((3 3,3 7,7 7,7 3,3 3))", false);
+
+    // Open rings
+    test_geometry<poly_open, poly_open>("POLYGON((0 0,0 10,10 10,10 0))", "POLYGON((10 10,10 20,20 20,20 10))", true);
+    test_geometry<poly_open, poly_open>("POLYGON((0 0,0 10,10 10,10 0))", "POLYGON((12 2,12 8,18 8,18 2))", false);
+    test_geometry<poly_open, poly_open>("POLYGON((0 0,0 10,10 10,10 0),(2 2,8 2,8 8,2 8))", "POLYGON((3 3,3 7,7 7,7 3))", false);
+    test_geometry<poly_open, poly_open>("POLYGON((0 0,0 10,10 10,10 0),(2 2,8 2,8 8,2 8))", "POLYGON((3 3,3 9,7 9,7 3))", true);
+
+    // Duplicate points
+    test_geometry<poly, poly>("POLYGON((0 0,0 0,0 10,10 10,10 10,10 10,10 0,0 0,0 0))",
+                              "POLYGON((10 10,10 10,10 20,20 20,20 20,20 10,10 10))", true);
+    test_geometry<poly, poly>("POLYGON((0 0,0 0,0 10,10 10,10 10,10 0,0 0))",
+                              "POLYGON((12 2,12 2,12 8,18 8,18 8,18 2,12 2))", false);
+
+    std::string const multi = "MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),((20 20,20 30,30 30,30 20,20 20)))";
+    test_geometry<mpoly, poly>(multi, "POLYGON((22 22,22 28,28 28,28 22,22 22))", true);
+    test_geometry<mpoly, poly>(multi, "POLYGON((5 5,5 15,15 15,15 5,5 5))", false);
+    test_geometry<mpoly, mpoly>(multi, "MULTIPOLYGON(((5 5,5 6,6 6,6 5,5 5)),((30 25,30 26,31 26,31 25,30 25)))", true);
+
+    // More than 256 overlapping section pairs
+    std::string const holes = diamonds(12, 0.45, 0.3);
+    test_geometry<mpoly, mpoly>(holes, diamonds(12, 0.1), false);
+    test_geometry<mpoly, mpoly>(diamonds(12, 0.45), diamonds(12, 0.1), true);
+    std::string crossing = diamonds(12, 0.1);
+    crossing.insert(crossing.size() - 1, ",((11.1 11.5,11.5 11.9,11.9 11.5,11.5 11.1,11.1 11.5))");
+    test_geometry<mpoly, mpoly>(holes, crossing, true);
+}
+
+
+int test_main( int , char* [] )
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > >();
+    test_all<bg::model::point<double, 2, bg::cs::geographic<bg::degree> > >();
+
+    return 0;
+}
@@ -0,0 +1,192 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/prepared_geometry.hpp>
+
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/make.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Geometry>
+void test_points(std::string const& wkt)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef typename bg::coordinate_type<point_type>::type coordinate_type;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::prepared_geometry<Geometry> const prepared(geometry);
+
+    typename bg::strategies::relate::services::default_strategy
+        <
+            point_type, Geometry
+        >::type strategy;
+
+    // Visit a grid (including vertices and points on segments)
+    // and all vertices of the geometry
+    std::vector<point_type> points;
+    for (int x = -2; x <= 22; x++)
+    {
+        for (int y = -2; y <= 22; y++)
+        {
+            points.push_back(bg::make<point_type>(coordinate_type(x) / 2,
+                                                  coordinate_type(y) / 2));
+        }
+    }
+    bg::for_each_point(geometry, [&](point_type const& p) { points.push_back(p); });
+
+    for (point_type const& point : points)
+    {
+        int const expected = bg::detail::within::point_in_geometry(point, geometry, strategy);
+        int const detected = prepared.relate_point(point);
+        BOOST_CHECK_MESSAGE(expected == detected,
+            "relate_point: " << bg::wkt(point) << " in " << wkt
+            << " -> Expected: " << expected << " detected: " << detected);
+
+        BOOST_CHECK_EQUAL(bg::within(point, prepared), bg::within(point, geometry));
+        BOOST_CHECK_EQUAL(bg::covered_by(point, prepared), bg::covered_by(point, geometry));
+        BOOST_CHECK_EQUAL(bg::intersects(point, prepared), bg::intersects(point, geometry));
+    }
+}
+
+template <typename Geometry1, typename Geometry2, typename Prepared>
+void test_within(Geometry1 const& geometry1, Geometry2 const& geometry2,
+                 Prepared const& prepared, std::false_type)
+{
+    BOOST_CHECK_EQUAL(bg::within(geometry1, prepared), bg::within(geometry1, geometry2));
+    BOOST_CHECK_EQUAL(bg::covered_by(geometry1, prepared), bg::covered_by(geometry1, geometry2));
+}
+
+// Box/areal is not implemented for within and covered_by
+template <typename Geometry1, typename Geometry2, typename Prepared>
+void test_within(Geometry1 const&, Geometry2 const&, Prepared const&, std::true_type)
+{}
+
+template <typename Geometry1, typename Geometry2>
+void test_geometry(std::string const& wkt1, std::string const& wkt2)
+{
+    Geometry1 geometry1;
+    Geometry2 geometry2;
+    bg::read_wkt(wkt1, geometry1);
+    bg::read_wkt(wkt2, geometry2);
+
+    bg::prepared_geometry<Geometry2> const prepared(geometry2);
+
+    bool const expected = bg::intersects(geometry1, geometry2);
+    bool const detected = bg::intersects(geometry1, prepared);
+    BOOST_CHECK_MESSAGE(expected == detected,
+        "intersects: " << wkt1 << " with " << wkt2
+        << " -> Expected: " << expected << " detected: " << detected);
+    BOOST_CHECK_EQUAL(bg::disjoint(geometry1, prepared), ! expected);
+
+    test_within(geometry1, geometry2, prepared,
+                std::is_same<typename bg::tag<Geometry1>::type, bg::box_tag>());
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, false, false> polygon_ccw_open;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::box<P> box;
+
+    std::string const poly_holes = "POLYGON((0 0,0 10,10 10,10 0,0 0),"
+            "(1 1,4 1,4 4,1 4,1 1),(5 5,5 9,9 9,9 5,5 5),(6 1,8 3,9 1,6 1))";
+    std::string const poly_concave = "POLYGON((0 0,0 10,2 10,2 2,4 2,4 10,"
+            "6 10,6 2,8 2,8 10,10 10,10 0,0 0))";
+    std::string const mpoly = "MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0),(1 1,3 1,3 3,1 3,1 1)),"
+            "((4 4,4 8,8 8,8 4,4 4)),((9 0,9 10,10 10,10 0,9 0)))";
+
+    test_points<ring>("POLYGON((0 0,0 7,4 2,2 0,0 0))");
+    test_points<ring>("POLYGON((0 0,0 10,5 5,10 10,10 0,5 5,0 0))");
+    test_points<polygon>(poly_holes);
+    test_points<polygon>(poly_concave);
+    test_points<polygon_ccw_open>("POLYGON((0 0,10 0,10 10,0 10),(2 2,2 8,8 8,8 2))");
+    test_points<multi_polygon>(mpoly);
+    test_points<multi_polygon>("MULTIPOLYGON()");
+    test_points<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,2 2,2 2,2 2))");
+
+    test_geometry<multi_point, polygon>("MULTIPOINT(0 0,1 1)", poly_holes);
+    test_geometry<multi_point, polygon>("MULTIPOINT(-1 -1,11 11)", poly_holes);
+
+    test_geometry<linestring, polygon>("LINESTRING(2 2,3 3)", poly_holes);
+    test_geometry<linestring, polygon>("LINESTRING(0 0,-1 -1)", poly_holes);
+    test_geometry<linestring, polygon>("LINESTRING(11 0,11 11)", poly_holes);
+    test_geometry<linestring, polygon>("LINESTRING(3 3,3 9)", poly_concave);
+    test_geometry<multi_linestring, multi_polygon>("MULTILINESTRING((1 2,3 2),(-1 -1,-2 -2))", mpoly);
+    test_geometry<multi_linestring, multi_polygon>("MULTILINESTRING((0 2,-1 2),(-1 -1,-2 -2))", mpoly);
+
+    test_geometry<polygon, polygon>("POLYGON((2 2,2 3,3 3,3 2,2 2))", poly_holes);
+    test_geometry<polygon, polygon>("POLYGON((2 2,2 6,6 6,6 2,2 2))", poly_holes);
+    test_geometry<polygon, polygon>("POLYGON((-1 -1,-1 11,11 11,11 -1,-1 -1))", poly_holes);
+    test_geometry<polygon, polygon>("POLYGON((10 0,10 10,20 10,20 0,10 0))", poly_holes);
+    test_geometry<polygon, polygon>("POLYGON((11 0,11 10,20 10,20 0,11 0))", poly_holes);
+    test_geometry<multi_polygon, polygon>(mpoly, poly_holes);
+
+    test_geometry<box, polygon>("BOX(2 2,3 3)", poly_holes);
+    test_geometry<box, polygon>("BOX(2 2,5 5)", poly_holes);
+    test_geometry<box, polygon>("BOX(-1 -1,11 11)", poly_holes);
+    test_geometry<box, polygon>("BOX(11 11,12 12)", poly_holes);
+}
+
+
+template <typename P>
+void test_fractional()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::box<P> box;
+
+    std::string const poly_holes = "POLYGON((0 0,0 10,10 10,10 0,0 0),"
+            "(1 1,4 1,4 4,1 4,1 1),(5 5,5 9,9 9,9 5,5 5),(6 1,8 3,9 1,6 1))";
+    std::string const poly_concave = "POLYGON((0 0,0 10,2 10,2 2,4 2,4 10,"
+            "6 10,6 2,8 2,8 10,10 10,10 0,0 0))";
+    std::string const mpoly = "MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0),(1 1,3 1,3 3,1 3,1 1)),"
+            "((4 4,4 8,8 8,8 4,4 4)),((2 2,2 2.5,2.5 2.5,2.5 2,2 2)),"
+            "((9 0,9 10,10 10,10 0,9 0)))";
+
+    test_points<multi_polygon>(mpoly);
+
+    test_geometry<multi_point, polygon>("MULTIPOINT(2 2,5.5 5.5)", poly_holes);
+    test_geometry<multi_point, polygon>("MULTIPOINT(0 0,0.5 0.5)", poly_holes);
+    test_geometry<linestring, polygon>("LINESTRING(2 2,3 3,4.5 4.5)", poly_holes);
+    test_geometry<linestring, polygon>("LINESTRING(2.5 1,2.5 9)", poly_concave);
+    test_geometry<multi_linestring, multi_polygon>("MULTILINESTRING((1.5 1.5,2.7 2.7),(-1 -1,-2 -2))", mpoly);
+    test_geometry<multi_linestring, multi_polygon>("MULTILINESTRING((1.5 1.5,1.7 1.7),(-1 -1,-2 -2))", mpoly);
+    test_geometry<polygon, polygon>("POLYGON((2.5 3,2.5 9,3.5 9,3.5 3,2.5 3))", poly_concave);
+    test_geometry<polygon, multi_polygon>("POLYGON((2.1 2.1,2.1 2.4,2.4 2.4,2.4 2.1,2.1 2.1))", mpoly);
+    test_geometry<polygon, multi_polygon>("POLYGON((5 0.5,5 1,6 1,6 0.5,5 0.5))", mpoly);
+    test_geometry<box, polygon>("BOX(2.5 3,3.5 9)", poly_concave);
+    test_geometry<box, multi_polygon>("BOX(5 0.5,6 1)", mpoly);
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_fractional<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::point<int, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
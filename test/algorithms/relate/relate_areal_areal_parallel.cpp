@@ -0,0 +1,210 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/relate_parallel.hpp>
+
+#include <boost/geometry/algorithms/relate.hpp>
+#include <boost/geometry/algorithms/relation.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Grid of count x count squares of the given size, in cells of 10 x 10,
+// optionally with a hole in every square
+template <typename MultiPolygon>
+MultiPolygon grid(int count, double offset, double size, double hole = 0.0)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename bg::point_type<MultiPolygon>::type point_type;
+
+    MultiPolygon result;
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            double const x = offset + i * 10.0;
+            double const y = offset + j * 10.0;
+            polygon_type polygon;
+            bg::append(polygon.outer(), point_type(x, y));
+            bg::append(polygon.outer(), point_type(x, y + size));
+            bg::append(polygon.outer(), point_type(x + size, y + size));
+            bg::append(polygon.outer(), point_type(x + size, y));
+            bg::append(polygon.outer(), point_type(x, y));
+            if (hole > 0.0)
+            {
+                double const h = (size - hole) / 2.0;
+                polygon.inners().resize(1);
+                bg::append(polygon.inners()[0], point_type(x + h, y + h));
+                bg::append(polygon.inners()[0], point_type(x + size - h, y + h));
+                bg::append(polygon.inners()[0], point_type(x + size - h, y + size - h));
+                bg::append(polygon.inners()[0], point_type(x + h, y + size - h));
+                bg::append(polygon.inners()[0], point_type(x + h, y + h));
+            }
+            result.push_back(polygon);
+        }
+    }
+    return result;
+}
+
+template <typename Geometry1, typename Geometry2, typename Mask>
+void check_mask(std::string const& caseid,
+                Geometry1 const& geometry1, Geometry2 const& geometry2,
+                Mask const& mask, std::string const& mask_name)
+{
+    bool const expected = bg::relate(geometry1, geometry2, mask);
+
+    std::size_t const thread_counts[] = { 1, 2, 3, 0 };
+    for (std::size_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); i++)
+    {
+        bool const result = bg::relate_parallel(geometry1, geometry2, mask,
+                                                thread_counts[i]);
+        BOOST_CHECK_MESSAGE(result == expected,
+            caseid << " mask: " << mask_name
+            << " threads: " << thread_counts[i]
+            << " result: " << result
+            << " expected: " << expected);
+    }
+}
+
+template <typename Geometry1, typename Geometry2>
+void test_one(std::string const& caseid,
+              Geometry1 const& geometry1, Geometry2 const& geometry2)
+{
+    std::string const expected = bg::relation(geometry1, geometry2).str();
+
+    std::size_t const thread_counts[] = { 1, 2, 3, 0 };
+    for (std::size_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); i++)
+    {
+        std::string const result = bg::relation_parallel(geometry1, geometry2,
+                                                         thread_counts[i]).str();
+        BOOST_CHECK_MESSAGE(result == expected,
+            caseid << " threads: " << thread_counts[i]
+            << " result: " << result
+            << " expected: " << expected);
+    }
+
+    char const* masks[] = { "T********", "FF*FF****", "T*F**F***",
+                            "T*****FF*", "T*T***T**", "F***T****",
+                            "T*F**FFF*" };
+    for (std::size_t i = 0; i < sizeof(masks) / sizeof(masks[0]); i++)
+    {
+        check_mask(caseid, geometry1, geometry2, bg::de9im::mask(masks[i]), masks[i]);
+    }
+
+    check_mask(caseid, geometry1, geometry2,
+               bg::de9im::static_mask<'F', 'F', '*', 'F', 'F', '*', '*', '*', '*'>(),
+               "static FF*FF****");
+    check_mask(caseid, geometry1, geometry2,
+               bg::de9im::mask("FF*FF****") || bg::de9im::mask("T*F**F***"),
+               "FF*FF**** || T*F**F***");
+}
+
+template <typename Geometry1, typename Geometry2>
+void test_wkt(std::string const& caseid,
+              std::string const& wkt1, std::string const& wkt2)
+{
+    Geometry1 geometry1;
+    Geometry2 geometry2;
+    bg::read_wkt(wkt1, geometry1);
+    bg::read_wkt(wkt2, geometry2);
+    test_one(caseid, geometry1, geometry2);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<P> linestring;
+
+    test_wkt<polygon, polygon>("touching",
+                               "POLYGON((0 0,0 10,10 10,10 0,0 0))",
+                               "POLYGON((10 0,10 10,20 10,20 0,10 0))");
+    test_wkt<polygon, polygon>("containing",
+                               "POLYGON((0 0,0 10,10 10,10 0,0 0))",
+                               "POLYGON((5 5,5 10,6 10,6 5,5 5))");
+    test_wkt<polygon, ring>("hole_inside",
+                            "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))",
+                            "POLYGON((3 3,3 7,7 7,7 3,3 3))");
+    test_wkt<multi_polygon, polygon>("multi_disjoint",
+                                     "MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),((5 5,5 6,6 6,6 5,5 5)))",
+                                     "POLYGON((2 2,2 3,3 3,3 2,2 2))");
+    test_wkt<linestring, polygon>("linear_areal",
+                                  "LINESTRING(0 0,10 10)",
+                                  "POLYGON((5 5,5 15,15 15,15 5,5 5))");
+
+    multi_polygon const squares = grid<multi_polygon>(20, 0.0, 8.0);
+
+    test_one("grid_overlapping", squares, grid<multi_polygon>(20, 5.0, 8.0));
+    test_one("grid_touching", squares, grid<multi_polygon>(20, 8.0, 2.0));
+    test_one("grid_disjoint", squares, grid<multi_polygon>(20, 1000.0, 8.0));
+    test_one("grid_within", grid<multi_polygon>(20, 1.0, 6.0), squares);
+    test_one("grid_contains", squares, grid<multi_polygon>(20, 3.0, 2.0));
+    test_one("grid_in_holes", grid<multi_polygon>(20, 0.0, 8.0, 4.0),
+             grid<multi_polygon>(20, 3.0, 2.0));
+    test_one("grid_equal", squares, squares);
+
+    polygon cover;
+    bg::read_wkt("POLYGON((-1 -1,-1 300,300 300,300 -1,-1 -1))", cover);
+    test_one("grid_covered", squares, cover);
+    test_one("grid_covering", cover, grid<multi_polygon>(20, 0.0, 8.0, 4.0));
+}
+
+// Many components without turns, the components outside of the cover are
+// at the end, so threads may skip components before the deciding ones
+template <typename P>
+void test_many_components()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    multi_polygon squares = grid<multi_polygon>(30, 0.0, 8.0);
+    multi_polygon const outside = grid<multi_polygon>(2, 1000.0, 8.0);
+    squares.insert(squares.end(), outside.begin(), outside.end());
+
+    polygon cover;
+    bg::read_wkt("POLYGON((-1 -1,-1 500,500 500,500 -1,-1 -1))", cover);
+
+    std::string const expected = bg::relation(squares, cover).str();
+    bool const expected_within = bg::relate(squares, cover,
+                                            bg::de9im::mask("T*F**F***"));
+
+    std::size_t const thread_counts[] = { 2, 4, 8 };
+    for (int r = 0; r < 10; r++)
+    {
+        for (std::size_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); i++)
+        {
+            std::string const result = bg::relation_parallel(squares, cover,
+                                                             thread_counts[i]).str();
+            BOOST_CHECK_MESSAGE(result == expected,
+                "many_components threads: " << thread_counts[i]
+                << " result: " << result
+                << " expected: " << expected);
+
+            bool const within = bg::relate_parallel(squares, cover,
+                                                    bg::de9im::mask("T*F**F***"),
+                                                    thread_counts[i]);
+            BOOST_CHECK_MESSAGE(within == expected_within,
+                "many_components within threads: " << thread_counts[i]);
+        }
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_many_components<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/spatial_join.hpp>
+
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/algorithms/relate.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+typedef std::vector<std::pair<std::size_t, std::size_t> > pairs_type;
+
+struct intersects_predicate
+{
+    template <typename Geometry1, typename Geometry2>
+    bool operator()(Geometry1 const& geometry1, Geometry2 const& geometry2) const
+    {
+        return bg::intersects(geometry1, geometry2);
+    }
+};
+
+struct within_predicate
+{
+    template <typename Geometry1, typename Geometry2>
+    bool operator()(Geometry1 const& geometry1, Geometry2 const& geometry2) const
+    {
+        return bg::within(geometry1, geometry2);
+    }
+};
+
+struct covers_predicate
+{
+    template <typename Geometry1, typename Geometry2>
+    bool operator()(Geometry1 const& geometry1, Geometry2 const& geometry2) const
+    {
+        return bg::covered_by(geometry2, geometry1);
+    }
+};
+
+struct overlaps_mask_predicate
+{
+    template <typename Geometry1, typename Geometry2>
+    bool operator()(Geometry1 const& geometry1, Geometry2 const& geometry2) const
+    {
+        return bg::relate(geometry1, geometry2, bg::de9im::mask("T*T***T**"));
+    }
+};
+
+// Squares on a diagonal grid, with size and step, some of them empty
+template <typename Polygon>
+std::vector<Polygon> squares(int count, double offset, double step, double size)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+
+    std::vector<Polygon> result;
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            double const x = offset + i * step;
+            double const y = offset + j * step;
+            Polygon polygon;
+            if ((i * count + j) % 17 != 5)
+            {
+                bg::append(polygon.outer(), point_type(x, y));
+                bg::append(polygon.outer(), point_type(x, y + size));
+                bg::append(polygon.outer(), point_type(x + size, y + size));
+                bg::append(polygon.outer(), point_type(x + size, y));
+                bg::append(polygon.outer(), point_type(x, y));
+            }
+            result.push_back(polygon);
+        }
+    }
+    return result;
+}
+
+template <typename Range1, typename Range2, typename Predicate>
+void test_one(std::string const& caseid, Range1 const& range1,
+              Range2 const& range2, Predicate const& predicate)
+{
+    pairs_type expected;
+    for (std::size_t i = 0; i < range1.size(); i++)
+    {
+        for (std::size_t j = 0; j < range2.size(); j++)
+        {
+            // Empty geometries are not joined
+            if (! bg::is_empty(range1[i]) && ! bg::is_empty(range2[j])
+                && predicate(range1[i], range2[j]))
+            {
+                expected.push_back(std::make_pair(i, j));
+            }
+        }
+    }
+
+    std::size_t const thread_counts[] = { 1, 2, 3, 0 };
+    for (std::size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++)
+    {
+        pairs_type pairs;
+        bg::spatial_join(range1, range2, predicate, std::back_inserter(pairs),
+                         thread_counts[t]);
+        BOOST_CHECK_MESSAGE(pairs == expected,
+            caseid << " threads: " << thread_counts[t]
+            << " pairs: " << pairs.size()
+            << " expected: " << expected.size());
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::linestring<P> linestring;
+
+    std::vector<polygon> const parcels = squares<polygon>(20, 0.0, 10.0, 10.0);
+    std::vector<polygon> const buildings = squares<polygon>(30, 1.0, 6.5, 3.0);
+
+    std::vector<P> points;
+    for (int i = 0; i < 50; i++)
+    {
+        for (int j = 0; j < 50; j++)
+        {
+            points.push_back(P(i * 4.0 + 0.5, j * 4.0));
+        }
+    }
+
+    std::vector<linestring> roads;
+    for (int i = 0; i < 20; i++)
+    {
+        linestring road;
+        bg::append(road, P(i * 10.0 + 5.0, -10.0));
+        bg::append(road, P(i * 10.0 - 5.0, 210.0));
+        roads.push_back(road);
+    }
+    roads.push_back(linestring());
+
+    test_one("parcels_buildings_intersects", parcels, buildings, intersects_predicate());
+    test_one("buildings_parcels_within", buildings, parcels, within_predicate());
+    test_one("parcels_buildings_covers", parcels, buildings, covers_predicate());
+    test_one("parcels_buildings_mask", parcels, buildings, overlaps_mask_predicate());
+    test_one("parcels_points_covers", parcels, points, covers_predicate());
+    test_one("points_parcels_within", points, parcels, within_predicate());
+    test_one("roads_parcels_intersects", roads, parcels, intersects_predicate());
+    test_one("parcels_parcels_intersects", parcels, parcels, intersects_predicate());
+
+    test_one("empty_first", std::vector<polygon>(), parcels, intersects_predicate());
+    test_one("empty_second", parcels, std::vector<P>(), intersects_predicate());
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
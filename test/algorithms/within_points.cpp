@@ -0,0 +1,133 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/within_points.hpp>
+
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/for_each.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Geometry, typename Points, typename Strategy>
+void check_points(Geometry const& geometry, Points const& points,
+                  Strategy const& strategy, std::string const& wkt)
+{
+    std::vector<bool> within_mask, covered_by_mask;
+    bg::within_points(points, geometry, std::back_inserter(within_mask), strategy);
+    bg::covered_by_points(points, geometry, std::back_inserter(covered_by_mask), strategy);
+
+    BOOST_CHECK_EQUAL(within_mask.size(), boost::size(points));
+    BOOST_CHECK_EQUAL(covered_by_mask.size(), boost::size(points));
+    if (within_mask.size() != boost::size(points)
+        || covered_by_mask.size() != boost::size(points))
+    {
+        return;
+    }
+
+    for (std::size_t i = 0; i < boost::size(points); i++)
+    {
+        bool const within = bg::within(points[i], geometry, strategy);
+        bool const covered_by = bg::covered_by(points[i], geometry, strategy);
+        BOOST_CHECK_MESSAGE(within_mask[i] == within,
+            "within_points: " << bg::wkt(points[i]) << " in " << wkt
+            << " -> Expected: " << within);
+        BOOST_CHECK_MESSAGE(covered_by_mask[i] == covered_by,
+            "covered_by_points: " << bg::wkt(points[i]) << " in " << wkt
+            << " -> Expected: " << covered_by);
+    }
+}
+
+template <typename Geometry>
+void test_geometry(std::string const& wkt)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef typename bg::coordinate_type<point_type>::type coordinate_type;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    // Grid including vertices and points on segments, in any order,
+    // including duplicates, and all vertices of the geometry
+    std::vector<point_type> points;
+    for (int i = 0; i < 1000; i++)
+    {
+        int const x = (i * 7) % 25 - 2;
+        int const y = (i * 13) % 25 - 2;
+        points.push_back(point_type(coordinate_type(x) / 2, coordinate_type(y) / 2));
+    }
+    bg::for_each_point(geometry, [&](point_type const& p) { points.push_back(p); });
+
+    typename bg::strategies::relate::services::default_strategy
+        <
+            point_type, Geometry
+        >::type const strategy;
+    check_points(geometry, points, strategy, wkt);
+
+    // Legacy strategy and default strategy
+    check_points(geometry, points, bg::strategy::within::cartesian_winding<>(), wkt);
+
+    std::vector<bool> mask;
+    bg::within_points(points, geometry, std::back_inserter(mask));
+    BOOST_CHECK_EQUAL(mask.size(), points.size());
+
+    // Multi-point within the geometry
+    bg::model::multi_point<point_type> multi_point;
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        if (bg::covered_by(points[i], geometry))
+        {
+            bg::append(multi_point, points[i]);
+        }
+    }
+    BOOST_CHECK(bg::covered_by(multi_point, geometry));
+    BOOST_CHECK_EQUAL(bg::within(multi_point, geometry),
+                      std::find(mask.begin(), mask.end(), true) != mask.end());
+
+    bg::append(multi_point, point_type(5, -1));
+    BOOST_CHECK(! bg::covered_by(multi_point, geometry));
+    BOOST_CHECK(! bg::within(multi_point, geometry));
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, false, false> polygon_ccw_open;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<P> linestring;
+
+    test_geometry<ring>("POLYGON((0 0,0 7,4 2,2 0,0 0))");
+    test_geometry<ring>("POLYGON((0 0,0 10,5 5,10 10,10 0,5 5,0 0))");
+    test_geometry<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),"
+            "(1 1,4 1,4 4,1 4,1 1),(5 5,5 9,9 9,9 5,5 5),(6 1,8 3,9 1,6 1))");
+    test_geometry<polygon>("POLYGON((0 0,0 10,2 10,2 2,4 2,4 10,"
+            "6 10,6 2,8 2,8 10,10 10,10 0,0 0))");
+    test_geometry<polygon_ccw_open>("POLYGON((0 0,10 0,10 10,0 10),(2 2,2 8,8 8,8 2))");
+    test_geometry<multi_polygon>("MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0),(1 1,3 1,3 3,1 3,1 1)),"
+            "((4 4,4 8,8 8,8 4,4 4)),((2 2,2 3,3 3,3 2,2 2)),"
+            "((9 0,9 10,10 10,10 0,9 0)))");
+    test_geometry<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,2 2,2 2,2 2))");
+    test_geometry<linestring>("LINESTRING(0 0,5 5,10 0)");
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_all<bg::model::point<float, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
@@ -0,0 +1,324 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Robustness Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures get_turns on skewed input, with partition and with the sweep
+// selected by the strategy, and finding the pairs of sections with the
+// divide policies of partition and with the sweep.
+
+#define BOOST_GEOMETRY_NO_BOOST_TEST
+
+#include <geometry_test_common.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/strategies/relate/sweep_sections.hpp>
+
+#include <boost/program_options.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+
+
+template <typename Polygon>
+inline void make_octagon(Polygon& polygon, double x, double y, double radius)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    double const pi = bg::math::pi<double>();
+    for (int i = 0; i <= 8; i++)
+    {
+        double const angle = -2.0 * pi * (i % 8) / 8.0;
+        bg::append(polygon, point_type(x + radius * std::cos(angle),
+                                       y + radius * std::sin(angle)));
+    }
+}
+
+// Many small features, most of them concentrated in a city centre
+template <typename MultiPolygon>
+inline void make_city(MultiPolygon& mp, int seed, int count, double spread,
+                      double size)
+{
+    typedef boost::minstd_rand generator_type;
+    generator_type generator(seed);
+    boost::uniform_real<> random(0.0, 1.0);
+    boost::variate_generator<generator_type&, boost::uniform_real<> >
+        next(generator, random);
+
+    double const pi = bg::math::pi<double>();
+    for (int i = 0; i < count; i++)
+    {
+        typename boost::range_value<MultiPolygon>::type polygon;
+        if (i % 10 == 0)
+        {
+            // Suburbs
+            double const x = next() * 1000.0;
+            double const y = next() * 1000.0;
+            make_octagon(polygon, x, y, 1.0 + next() * 3.0);
+        }
+        else
+        {
+            double const angle = next() * 2.0 * pi;
+            double const distance = next() * next() * spread;
+            make_octagon(polygon, 500.0 + distance * std::cos(angle),
+                         500.0 + distance * std::sin(angle),
+                         size * (1.0 + next()));
+        }
+        mp.push_back(polygon);
+    }
+}
+
+// A long thin wavy polygon, and small features along it
+template <typename Polygon, typename MultiPolygon>
+inline void make_coast(Polygon& coast, MultiPolygon& mp, int count)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+
+    int const n = count * 10;
+    for (int i = 0; i <= n; i++)
+    {
+        double const x = i * 0.1;
+        bg::append(coast, point_type(x, std::sin(x * 0.05) * 50.0
+                                        + std::sin(i * 1.7) * 0.3));
+    }
+    for (int i = n; i >= 0; i--)
+    {
+        double const x = i * 0.1;
+        bg::append(coast, point_type(x, std::sin(x * 0.05) * 50.0 + 2.0
+                                        + std::sin(i * 1.3) * 0.3));
+    }
+    bg::append(coast, bg::exterior_ring(coast).front());
+
+    for (int i = 0; i < count; i++)
+    {
+        double const y = std::sin(i * 0.05) * 50.0 + 1.0;
+        typename boost::range_value<MultiPolygon>::type polygon;
+        make_octagon(polygon, i, y, 1.5);
+        mp.push_back(polygon);
+    }
+}
+
+template <typename Geometry1, typename Geometry2, typename Strategy>
+void test_get_turns(std::string const& caseid, std::string const& method,
+                    Geometry1 const& geometry1, Geometry2 const& geometry2,
+                    Strategy const& strategy, int count)
+{
+    typedef typename bg::point_type<Geometry1>::type point_type;
+    typedef bg::detail::overlay::turn_info
+        <
+            point_type,
+            typename bg::detail::segment_ratio_type
+                <
+                    point_type, bg::detail::no_rescale_policy
+                >::type
+        > turn_info;
+
+    std::vector<turn_info> turns;
+    auto const t0 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        turns.clear();
+        bg::detail::get_turns::no_interrupt_policy policy;
+        bg::get_turns
+            <
+                false, false, bg::detail::overlay::assign_null_policy
+            >(geometry1, geometry2, strategy, bg::detail::no_rescale_policy(),
+              turns, policy);
+    }
+    auto const t = std::chrono::high_resolution_clock::now();
+    auto const elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(t - t0).count();
+    std::cout
+        << caseid
+        << " get_turns " << method
+        << " turns: " << turns.size()
+        << " time: " << elapsed_ms / 1000.0 / count << std::endl;
+}
+
+struct count_pairs_visitor
+{
+    std::size_t count = 0;
+
+    template <typename Section>
+    inline bool apply(Section const& , Section const& )
+    {
+        count++;
+        return true;
+    }
+};
+
+template <typename DividePolicy>
+struct partition_pairs
+{
+    template <typename Box, typename Sections, typename Visitor, typename Strategy>
+    static inline void apply(Sections const& sec1, Sections const& sec2,
+                             Visitor& visitor, Strategy const& strategy)
+    {
+        bg::partition
+            <
+                Box,
+                bg::detail::partition::include_all_policy,
+                bg::detail::partition::include_all_policy,
+                DividePolicy
+            >::apply(sec1, sec2, visitor,
+                     bg::detail::section::get_section_box<Strategy>(strategy),
+                     bg::detail::section::overlaps_section_box<Strategy>(strategy));
+    }
+};
+
+struct sweep_pairs
+{
+    template <typename Box, typename Sections, typename Visitor, typename Strategy>
+    static inline void apply(Sections const& sec1, Sections const& sec2,
+                             Visitor& visitor, Strategy const& strategy)
+    {
+        bg::sweep_pairs<Box>::apply(sec1, sec2, visitor,
+            bg::detail::section::get_section_box<Strategy>(strategy));
+    }
+};
+
+// Measures finding the pairs of overlapping sections only
+template <typename Pairs, typename Geometry1, typename Geometry2>
+void test_section_pairs(std::string const& caseid, std::string const& method,
+                        Geometry1 const& geometry1, Geometry2 const& geometry2,
+                        int count)
+{
+    typedef typename bg::point_type<Geometry1>::type point_type;
+    typedef bg::model::box<point_type> box_type;
+    typedef bg::sections<box_type, 2> sections_type;
+    typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
+
+    typename bg::strategies::relate::services::default_strategy
+        <
+            Geometry1, Geometry2
+        >::type strategy;
+
+    sections_type sec1, sec2;
+    bg::sectionalize<false, dimensions>(geometry1, bg::detail::no_rescale_policy(),
+                                        sec1, strategy, 0);
+    bg::sectionalize<false, dimensions>(geometry2, bg::detail::no_rescale_policy(),
+                                        sec2, strategy, 1);
+
+    count_pairs_visitor visitor;
+    auto const t0 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        visitor.count = 0;
+        Pairs::template apply<box_type>(sec1, sec2, visitor, strategy);
+    }
+    auto const t = std::chrono::high_resolution_clock::now();
+    auto const elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(t - t0).count();
+    std::cout
+        << caseid
+        << " " << method
+        << " pairs: " << visitor.count
+        << " time: " << elapsed_ms / 1000.0 / count << std::endl;
+}
+
+template <typename Geometry1, typename Geometry2>
+void test_one(std::string const& caseid,
+              Geometry1 const& geometry1, Geometry2 const& geometry2,
+              int count)
+{
+    typedef typename bg::strategies::relate::services::default_strategy
+        <
+            Geometry1, Geometry2
+        >::type strategy_type;
+
+    test_get_turns(caseid, "partition", geometry1, geometry2,
+                   strategy_type(), count);
+    test_get_turns(caseid, "sweep", geometry1, geometry2,
+                   bg::strategies::relate::sweep_sections<strategy_type>(), count);
+    test_section_pairs<partition_pairs<bg::detail::partition::divide_at_middle> >(
+        caseid, "divide at middle", geometry1, geometry2, count);
+    test_section_pairs<partition_pairs<bg::detail::partition::divide_adaptive> >(
+        caseid, "divide adaptive", geometry1, geometry2, count);
+    test_section_pairs<sweep_pairs>(caseid, "sweep", geometry1, geometry2, count);
+}
+
+void test_all(int count, int size)
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+    typedef bg::model::polygon<point_type> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    {
+        multi_polygon mp1, mp2;
+        make_city(mp1, 1, size, 50.0, 0.01);
+        make_city(mp2, 2, size, 50.0, 0.01);
+        test_one("city", mp1, mp2, count);
+    }
+    {
+        multi_polygon mp1, mp2;
+        make_city(mp1, 1, size, 5.0, 0.001);
+        make_city(mp2, 2, size, 5.0, 0.001);
+        test_one("dense_city", mp1, mp2, count);
+    }
+    {
+        polygon coast;
+        multi_polygon mp;
+        make_coast(coast, mp, size);
+        test_one("coast", coast, mp, count);
+    }
+    {
+        // Not skewed, for reference
+        multi_polygon mp1, mp2;
+        for (int i = 0; i < size / 10; i++)
+        {
+            polygon p1, p2;
+            make_octagon(p1, (i / 50) * 10.0, (i % 50) * 10.0, 4.0);
+            make_octagon(p2, (i / 50) * 10.0 + 3.0, (i % 50) * 10.0 + 1.0, 4.0);
+            mp1.push_back(p1);
+            mp2.push_back(p2);
+        }
+        test_one("uniform", mp1, mp2, count);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    BoostGeometryWriteTestConfiguration();
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== get_turns_skewed ===\nAllowed options");
+
+        int count = 5;
+        int size = 30000;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<int>(&count)->default_value(5), "Number of runs per case")
+            ("size", po::value<int>(&size)->default_value(30000), "Number of features per case")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        test_all(count, size);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+    return 0;
+}
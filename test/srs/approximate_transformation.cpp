@@ -0,0 +1,182 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/approximate_transformation.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> xy;
+typedef bg::model::box<ll> box;
+
+typedef bg::srs::approximate_transformation<ll, xy> approximation;
+
+double distance(xy const& p1, xy const& p2)
+{
+    double const dx = bg::get<0>(p1) - bg::get<0>(p2);
+    double const dy = bg::get<1>(p1) - bg::get<1>(p2);
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+// Returns the maximum distance to the exact points
+double check_grid(bg::srs::transformation<> const& tr,
+                  approximation const& approx,
+                  box const& b, std::size_t n)
+{
+    double max_dist = 0;
+    for (std::size_t i = 0; i <= n; i++)
+    {
+        for (std::size_t j = 0; j <= n; j++)
+        {
+            double const x = bg::get<bg::min_corner, 0>(b)
+                + (bg::get<bg::max_corner, 0>(b) - bg::get<bg::min_corner, 0>(b)) * i / n;
+            double const y = bg::get<bg::min_corner, 1>(b)
+                + (bg::get<bg::max_corner, 1>(b) - bg::get<bg::min_corner, 1>(b)) * j / n;
+            ll const p(x, y);
+
+            xy expected, result;
+            bool const expected_ok = tr.forward(p, expected);
+            bool const result_ok = approx.forward(p, result);
+            BOOST_CHECK_EQUAL(result_ok, expected_ok);
+            if (expected_ok && result_ok)
+            {
+                double const dist = distance(result, expected);
+                max_dist = (std::max)(max_dist, dist);
+            }
+        }
+    }
+    return max_dist;
+}
+
+void test_error(std::string const& proj4, box const& extent)
+{
+    bg::srs::transformation<> tr((bg::srs::proj4("+proj=longlat +ellps=WGS84")),
+                                 bg::srs::proj4(proj4));
+
+    std::size_t previous_size = 0;
+    double const errors[] = { 1000.0, 10.0 };
+    for (double max_error : errors)
+    {
+        approximation const approx(tr, extent, max_error);
+
+        // Smaller error requires more cells
+        BOOST_CHECK(approx.size() > previous_size);
+        previous_size = approx.size();
+
+        double const max_dist = check_grid(tr, approx, extent, 97);
+        BOOST_CHECK_MESSAGE(max_dist <= 2 * max_error,
+            proj4 << " max error: " << max_error << " distance: " << max_dist);
+    }
+}
+
+void test_unreachable()
+{
+    bg::srs::transformation<> tr((bg::srs::proj4("+proj=longlat +ellps=WGS84")),
+                                 bg::srs::proj4("+proj=merc +ellps=WGS84"));
+    box const extent(ll(-180, -80), ll(180, 80));
+
+    // The cells are not divided if the error can't be reached at max_depth
+    approximation const approx(tr, extent, 0.001, 6);
+    BOOST_CHECK(approx.size() < 4096);
+
+    // Transformed exactly
+    double const max_dist = check_grid(tr, approx, extent, 31);
+    BOOST_CHECK_EQUAL(max_dist, 0.0);
+}
+
+void test_outside()
+{
+    bg::srs::transformation<> tr((bg::srs::proj4("+proj=longlat +ellps=WGS84")),
+                                 bg::srs::proj4("+proj=merc +ellps=WGS84"));
+    approximation const approx(tr, box(ll(0, 0), ll(10, 10)), 1.0);
+
+    // Transformed exactly
+    ll const points[] = { ll(-5, 5), ll(5, 20), ll(15, -1) };
+    for (ll const& p : points)
+    {
+        xy expected, result;
+        BOOST_CHECK(tr.forward(p, expected));
+        BOOST_CHECK(approx.forward(p, result));
+        BOOST_CHECK_EQUAL(bg::get<0>(result), bg::get<0>(expected));
+        BOOST_CHECK_EQUAL(bg::get<1>(result), bg::get<1>(expected));
+    }
+
+    // Empty extent, every point is transformed exactly
+    approximation const empty(tr, box(ll(0, 0), ll(0, 10)), 1.0);
+    BOOST_CHECK_EQUAL(empty.size(), 1u);
+    xy expected, result;
+    BOOST_CHECK(tr.forward(ll(0, 5), expected));
+    BOOST_CHECK(empty.forward(ll(0, 5), result));
+    BOOST_CHECK_EQUAL(bg::get<0>(result), bg::get<0>(expected));
+}
+
+void test_domain()
+{
+    // Half of the points are on the other side of the globe
+    bg::srs::transformation<> tr((bg::srs::proj4("+proj=longlat +ellps=WGS84")),
+                                 bg::srs::proj4("+proj=ortho +ellps=WGS84 +lat_0=0 +lon_0=0"));
+    box const extent(ll(-180, -80), ll(180, 80));
+    approximation const approx(tr, extent, 10.0, 8);
+
+    double const max_dist = check_grid(tr, approx, extent, 89);
+    BOOST_CHECK(max_dist <= 20.0);
+}
+
+void test_geometries()
+{
+    bg::srs::transformation<> tr((bg::srs::proj4("+proj=longlat +ellps=WGS84")),
+                                 bg::srs::proj4("+proj=tmerc +ellps=WGS84 +lon_0=21"));
+    approximation const approx(tr, box(ll(14, 49), ll(24, 55)), 0.1);
+
+    bg::model::polygon<ll> poly_in;
+    bg::read_wkt("POLYGON((15 50,23 50,23 54,15 54,15 50),(17 51,17 53,21 53,21 51,17 51))", poly_in);
+    bg::model::multi_polygon<bg::model::polygon<ll> > mpoly_in;
+    mpoly_in.push_back(poly_in);
+    mpoly_in.push_back(poly_in);
+
+    bg::model::polygon<xy> poly_out, poly_expected;
+    BOOST_CHECK(approx.forward(poly_in, poly_out));
+    BOOST_CHECK(tr.forward(poly_in, poly_expected));
+    BOOST_CHECK_EQUAL(bg::num_points(poly_out), bg::num_points(poly_in));
+    BOOST_CHECK_EQUAL(poly_out.inners().size(), 1u);
+    for (std::size_t i = 0; i < poly_out.outer().size(); i++)
+    {
+        BOOST_CHECK(distance(poly_out.outer()[i], poly_expected.outer()[i]) <= 0.1);
+    }
+
+    bg::model::multi_polygon<bg::model::polygon<xy> > mpoly_out;
+    BOOST_CHECK(approx.forward(mpoly_in, mpoly_out));
+    BOOST_CHECK_EQUAL(bg::num_points(mpoly_out), bg::num_points(mpoly_in));
+
+    bg::model::linestring<ll> ls_in;
+    bg::read_wkt("LINESTRING(14 49,18 52,24 55)", ls_in);
+    bg::model::linestring<xy> ls_out;
+    BOOST_CHECK(approx.forward(ls_in, ls_out));
+    BOOST_CHECK_EQUAL(ls_out.size(), 3u);
+}
+
+int test_main(int, char* [])
+{
+    test_error("+proj=tmerc +ellps=WGS84 +lon_0=9", box(ll(6, 45), ll(12, 55)));
+    test_error("+proj=lcc +ellps=WGS84 +lat_1=33 +lat_2=45 +lon_0=-96", box(ll(-105, 30), ll(-85, 45)));
+    test_error("+proj=merc +ellps=WGS84", box(ll(-180, -80), ll(180, 80)));
+    test_unreachable();
+    test_outside();
+    test_domain();
+    test_geometries();
+
+    return 0;
+}
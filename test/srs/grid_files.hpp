@@ -0,0 +1,123 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_TEST_SRS_GRID_FILES_HPP
+#define BOOST_GEOMETRY_TEST_SRS_GRID_FILES_HPP
+
+
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/util/math.hpp>
+
+
+// Small grid files written by the tests: NTv2 with a child grid
+// and ctable2, covering different areas
+
+// Record of NTv2 header, little endian
+template <typename T>
+inline void write_record(std::ofstream & os, char const* name, T const& value)
+{
+    char record[16] = {0};
+    std::memcpy(record, name, std::strlen(name));
+    std::memcpy(record + 8, &value, sizeof(T));
+    os.write(record, sizeof(record));
+}
+
+inline void write_string_record(std::ofstream & os, char const* name, char const* value)
+{
+    char record[16];
+    std::memset(record, ' ', sizeof(record));
+    std::memcpy(record, name, std::strlen(name));
+    std::memcpy(record + 8, value, std::strlen(value));
+    os.write(record, sizeof(record));
+}
+
+// Subfile of NTv2 grid, coordinates in degrees, positive east
+inline void write_ntv2_subfile(std::ofstream & os, char const* name, char const* parent,
+                        double west, double south, double east, double north,
+                        double inc, float shift)
+{
+    boost::int32_t const cols = boost::int32_t((east - west) / inc + 0.5) + 1;
+    boost::int32_t const rows = boost::int32_t((north - south) / inc + 0.5) + 1;
+
+    write_string_record(os, "SUB_NAME", name);
+    write_string_record(os, "PARENT", parent);
+    write_string_record(os, "CREATED", "");
+    write_string_record(os, "UPDATED", "");
+    write_record(os, "S_LAT", south * 3600.0);
+    write_record(os, "N_LAT", north * 3600.0);
+    // positive west
+    write_record(os, "E_LONG", -east * 3600.0);
+    write_record(os, "W_LONG", -west * 3600.0);
+    write_record(os, "LAT_INC", inc * 3600.0);
+    write_record(os, "LONG_INC", inc * 3600.0);
+    write_record(os, "GS_COUNT", rows * cols);
+
+    // rows from south to north, from east to west
+    for (boost::int32_t row = 0; row < rows; row++)
+    {
+        for (boost::int32_t col = cols - 1; col >= 0; col--)
+        {
+            float const values[4] = { shift + 0.1f * row + 0.03f * col,
+                                      shift - 0.05f * row + 0.2f * col,
+                                      0.0f, 0.0f };
+            os.write(reinterpret_cast<char const*>(values), sizeof(values));
+        }
+    }
+}
+
+inline void write_ntv2(std::string const& filename)
+{
+    std::ofstream os(filename.c_str(), std::ios::binary);
+    write_record(os, "NUM_OREC", boost::int32_t(11));
+    write_record(os, "NUM_SREC", boost::int32_t(11));
+    write_record(os, "NUM_FILE", boost::int32_t(2));
+    write_string_record(os, "GS_TYPE", "SECONDS");
+    write_string_record(os, "VERSION", "NTv2.0");
+    write_string_record(os, "SYSTEM_F", "");
+    write_string_record(os, "SYSTEM_T", "");
+    write_record(os, "MAJOR_F", 6378206.4);
+    write_record(os, "MINOR_F", 6356583.8);
+    write_record(os, "MAJOR_T", 6378137.0);
+    write_record(os, "MINOR_T", 6356752.314);
+
+    write_ntv2_subfile(os, "PARENT", "NONE", 0.0, 40.0, 10.0, 50.0, 1.0, 1.0f);
+    write_ntv2_subfile(os, "CHILD", "PARENT", 2.0, 42.0, 4.0, 44.0, 0.25, -2.0f);
+}
+
+inline void write_ctable2(std::string const& filename)
+{
+    double const d2r = boost::geometry::math::d2r<double>();
+    boost::int32_t const lim[2] = { 6, 5 };
+    double const ll_del[4] = { 20.0 * d2r, -10.0 * d2r, 0.5 * d2r, 0.5 * d2r };
+
+    char header[160] = {0};
+    std::memcpy(header, "CTABLE V2", 9);
+    std::memcpy(header + 16, "test grid", 9);
+    std::memcpy(header + 96, ll_del, sizeof(ll_del));
+    std::memcpy(header + 128, lim, sizeof(lim));
+
+    std::ofstream os(filename.c_str(), std::ios::binary);
+    os.write(header, sizeof(header));
+    // rows from south to north, from west to east, radians
+    for (boost::int32_t row = 0; row < lim[1]; row++)
+    {
+        for (boost::int32_t col = 0; col < lim[0]; col++)
+        {
+            float const values[2] = { float((1.0 + 0.1 * col) / 3600.0 * d2r),
+                                      float((2.0 - 0.2 * row) / 3600.0 * d2r) };
+            os.write(reinterpret_cast<char const*>(values), sizeof(values));
+        }
+    }
+}
+
+
+#endif // BOOST_GEOMETRY_TEST_SRS_GRID_FILES_HPP
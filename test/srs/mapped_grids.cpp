@@ -0,0 +1,134 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstdio>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/mapped_grids.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+#include "grid_files.hpp"
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point;
+typedef bg::model::multi_point<point> multi_point;
+
+std::string const ntv2_name = "mapped_grids_test.gsb";
+std::string const ctable2_name = "mapped_grids_test.ct2";
+
+multi_point test_points()
+{
+    multi_point mpt;
+    for (double x = -1.0; x <= 23.0; x += 0.37)
+    {
+        for (double y = -9.0; y <= 51.0; y += 0.41)
+        {
+            mpt.push_back(point(x, y));
+        }
+    }
+    return mpt;
+}
+
+template <typename GridsStorage>
+void transform(std::string const& nadgrids, multi_point const& mpt,
+               multi_point & forward, multi_point & inverse,
+               std::size_t thread_count)
+{
+    bg::srs::transformation<> tr(
+        bg::srs::proj4("+proj=longlat +ellps=clrk66 +nadgrids=" + nadgrids),
+        bg::srs::proj4("+proj=longlat +ellps=clrk66 +towgs84=0,0,0"));
+
+    GridsStorage storage;
+    bg::srs::transformation_grids<GridsStorage> const grids
+        = tr.initialize_grids(storage);
+
+    BOOST_CHECK(tr.forward(mpt, forward, grids, thread_count));
+    BOOST_CHECK(tr.inverse(mpt, inverse, grids, thread_count));
+}
+
+void check_equal(multi_point const& mpt1, multi_point const& mpt2)
+{
+    BOOST_CHECK_EQUAL(mpt1.size(), mpt2.size());
+    bool equal = mpt1.size() == mpt2.size();
+    for (std::size_t i = 0; equal && i < mpt1.size(); i++)
+    {
+        equal = bg::get<0>(mpt1[i]) == bg::get<0>(mpt2[i])
+             && bg::get<1>(mpt1[i]) == bg::get<1>(mpt2[i]);
+    }
+    BOOST_CHECK(equal);
+}
+
+void test_grids(std::string const& nadgrids)
+{
+    typedef bg::srs::grids_storage<> loaded_storage;
+    typedef bg::srs::grids_storage<bg::srs::ifstream_policy, bg::srs::mapped_grids> mapped_storage;
+
+    multi_point const mpt = test_points();
+
+    multi_point expected_fwd, expected_inv;
+    transform<loaded_storage>(nadgrids, mpt, expected_fwd, expected_inv, 1);
+
+    multi_point fwd, inv;
+    transform<mapped_storage>(nadgrids, mpt, fwd, inv, 1);
+    check_equal(fwd, expected_fwd);
+    check_equal(inv, expected_inv);
+
+    transform<mapped_storage>(nadgrids, mpt, fwd, inv, 4);
+    check_equal(fwd, expected_fwd);
+    check_equal(inv, expected_inv);
+
+    // The points are shifted
+    bool shifted = false;
+    for (std::size_t i = 0; ! shifted && i < mpt.size(); i++)
+    {
+        shifted = bg::get<0>(mpt[i]) != bg::get<0>(fwd[i]);
+    }
+    BOOST_CHECK(shifted);
+}
+
+void test_storage()
+{
+    bg::srs::transformation<> tr(
+        bg::srs::proj4("+proj=longlat +ellps=clrk66 +nadgrids=" + ntv2_name + ",@missing.gsb"),
+        bg::srs::proj4("+proj=longlat +ellps=clrk66 +towgs84=0,0,0"));
+
+    typedef bg::srs::grids_storage<bg::srs::ifstream_policy, bg::srs::mapped_grids> mapped_storage;
+    mapped_storage storage;
+    tr.initialize_grids(storage);
+    // Parent and child grids are stored in the same list
+    BOOST_CHECK_EQUAL(storage.hgrids.size(), 1u);
+
+    // The file is mapped once
+    tr.initialize_grids(storage);
+    BOOST_CHECK_EQUAL(storage.hgrids.size(), 1u);
+
+    bg::srs::transformation<> tr_missing(
+        bg::srs::proj4("+proj=longlat +ellps=clrk66 +nadgrids=missing.gsb"),
+        bg::srs::proj4("+proj=longlat +ellps=clrk66 +towgs84=0,0,0"));
+    BOOST_CHECK_THROW(tr_missing.initialize_grids(storage), bg::projection_exception);
+}
+
+int test_main(int, char* [])
+{
+    write_ntv2(ntv2_name);
+    write_ctable2(ctable2_name);
+
+    test_grids(ntv2_name);
+    test_grids(ctable2_name);
+    test_grids(ctable2_name + "," + ntv2_name);
+    test_storage();
+
+    std::remove(ntv2_name.c_str());
+    std::remove(ctable2_name.c_str());
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/projection.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::radian> > point_ll_rad;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+// The batch kernels are the same calculations as the projections of single
+// points, but can be vectorized with vectorized math functions, which may
+// differ in the last bits
+inline bool equal_coordinate(double value, double expected)
+{
+    return value == expected
+        || (value != value && expected != expected) // both NaN
+        || (value != HUGE_VAL && expected != HUGE_VAL
+            && bg::math::abs(value - expected)
+                <= 1.0e-11 * (std::max)(1.0, bg::math::abs(expected)));
+}
+
+// Projects the points one by one and at once, separated and interleaved,
+// and checks that the results are equal
+template <typename Projection>
+void test_projection(std::string const& caseid, Projection const& prj,
+                     bool invertible = true)
+{
+    std::vector<double> lon, lat, interleaved;
+    for (int i = -17; i <= 17; i++)
+    {
+        for (int j = -8; j <= 8; j++)
+        {
+            lon.push_back(i * 10.0 + 0.5);
+            lat.push_back(j * 10.0 + 0.25);
+            interleaved.push_back(lon.back());
+            interleaved.push_back(lat.back());
+        }
+    }
+    std::size_t const count = lon.size();
+
+    std::vector<double> x(count), y(count), xy(2 * count);
+    bool const result = prj.forward(&lon[0], &lat[0], &x[0], &y[0], count);
+    bool const result_interleaved = prj.forward(&interleaved[0], &interleaved[1],
+                                                &xy[0], &xy[1], count, 2);
+    BOOST_CHECK_EQUAL(result, result_interleaved);
+
+    bool expected_result = true;
+    std::size_t valid = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        point_xy expected;
+        if (prj.forward(point_ll(lon[i], lat[i]), expected))
+        {
+            valid++;
+        }
+        else
+        {
+            expected_result = false;
+        }
+
+        BOOST_CHECK_MESSAGE(equal_coordinate(x[i], bg::get<0>(expected))
+                            && equal_coordinate(y[i], bg::get<1>(expected))
+                            && xy[2 * i] == x[i] && xy[2 * i + 1] == y[i],
+            caseid << " forward " << i << " (" << lon[i] << " " << lat[i] << ")"
+            << " result: " << x[i] << " " << y[i]
+            << " expected: " << bg::get<0>(expected) << " " << bg::get<1>(expected));
+    }
+    BOOST_CHECK_EQUAL(result, expected_result);
+    BOOST_CHECK_MESSAGE(valid > 0, caseid << " no valid points");
+
+    // Radians
+    {
+        std::vector<double> lon_rad(count), lat_rad(count), x_rad(count), y_rad(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            lon_rad[i] = lon[i] * bg::math::d2r<double>();
+            lat_rad[i] = lat[i] * bg::math::d2r<double>();
+        }
+        prj.template forward<bg::radian>(&lon_rad[0], &lat_rad[0],
+                                         &x_rad[0], &y_rad[0], count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            point_xy expected;
+            prj.forward(point_ll_rad(lon_rad[i], lat_rad[i]), expected);
+            BOOST_CHECK_MESSAGE(equal_coordinate(x_rad[i], bg::get<0>(expected))
+                                && equal_coordinate(y_rad[i], bg::get<1>(expected)),
+                caseid << " forward radian " << i);
+        }
+    }
+
+    if (! invertible)
+    {
+        return;
+    }
+
+    std::vector<double> lon2(count), lat2(count);
+    bool const inverse_result = prj.inverse(&x[0], &y[0], &lon2[0], &lat2[0], count);
+
+    bool expected_inverse_result = true;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        point_ll expected;
+        if (! prj.inverse(point_xy(x[i], y[i]), expected))
+        {
+            expected_inverse_result = false;
+        }
+
+        BOOST_CHECK_MESSAGE(equal_coordinate(lon2[i], bg::get<0>(expected))
+                            && equal_coordinate(lat2[i], bg::get<1>(expected)),
+            caseid << " inverse " << i << " (" << x[i] << " " << y[i] << ")"
+            << " result: " << lon2[i] << " " << lat2[i]
+            << " expected: " << bg::get<0>(expected) << " " << bg::get<1>(expected));
+    }
+    BOOST_CHECK_EQUAL(inverse_result, expected_inverse_result);
+}
+
+void test_invalid()
+{
+    bg::srs::projection<> prj = bg::srs::proj4("+proj=merc +ellps=WGS84");
+
+    double const lon[] = { 10.0, 20.0, 30.0 };
+    double const lat[] = { 10.0, 95.0, 30.0 };
+    double x[3], y[3];
+    BOOST_CHECK(! prj.forward(lon, lat, x, y, 3));
+    BOOST_CHECK(x[0] != HUGE_VAL && x[2] != HUGE_VAL);
+    BOOST_CHECK(x[1] == HUGE_VAL && y[1] == HUGE_VAL);
+
+    // Nothing to project
+    BOOST_CHECK(prj.forward(lon, lat, x, y, 0));
+}
+
+void test_not_invertible()
+{
+    bg::srs::projection<> prj = bg::srs::proj4("+proj=bacon +ellps=WGS84");
+
+    double const x[] = { 10.0 };
+    double const y[] = { 10.0 };
+    double lon[1], lat[1];
+    BOOST_CHECK_THROW(prj.inverse(x, y, lon, lat, 1),
+                      bg::projection_not_invertible_exception);
+}
+
+int test_main(int, char*[])
+{
+    using namespace bg::srs;
+
+    // Projections with a batch kernel, in all modes
+    test_projection("tmerc", projection<>(proj4("+proj=tmerc +ellps=WGS84 +units=m")));
+    test_projection("tmerc_sphere", projection<>(proj4("+proj=tmerc +R=6370997 +lon_0=3")));
+    test_projection("etmerc", projection<>(proj4("+proj=etmerc +ellps=WGS84 +lon_0=9")));
+    test_projection("merc", projection<>(proj4("+proj=merc +ellps=WGS84 +lon_0=10")));
+    test_projection("merc_sphere", projection<>(proj4("+proj=merc +R=6378137 +lat_ts=20")));
+    test_projection("lcc", projection<>(proj4("+proj=lcc +ellps=GRS80 +lat_1=33 +lat_2=45 +lat_0=39 +lon_0=-96")));
+    test_projection("lcc_sphere", projection<>(proj4("+proj=lcc +R=6370997 +lat_1=-20 +lat_2=-40 +lat_0=-30")));
+    test_projection("aea", projection<>(proj4("+proj=aea +ellps=GRS80 +lat_1=29.5 +lat_2=45.5 +lon_0=-96")));
+    test_projection("aea_sphere", projection<>(proj4("+proj=aea +R=6370997 +lat_1=20 +lat_2=60")));
+    test_projection("laea", projection<>(proj4("+proj=laea +lat_0=52 +lon_0=10 +x_0=4321000 +y_0=3210000 +ellps=GRS80")));
+    test_projection("laea_equator", projection<>(proj4("+proj=laea +lat_0=0 +lon_0=20 +ellps=WGS84")));
+    test_projection("laea_north", projection<>(proj4("+proj=laea +lat_0=90 +lon_0=0 +ellps=WGS84")));
+    test_projection("laea_south", projection<>(proj4("+proj=laea +lat_0=-90 +lon_0=0 +ellps=WGS84")));
+    test_projection("stere", projection<>(proj4("+proj=stere +lat_0=90 +lat_ts=70 +lon_0=-45 +ellps=WGS84")));
+    test_projection("stere_south", projection<>(proj4("+proj=stere +lat_0=-90 +lat_ts=-71 +ellps=WGS84")));
+    test_projection("stere_oblique", projection<>(proj4("+proj=stere +lat_0=52 +lon_0=5 +k=0.9999 +ellps=bessel")));
+    test_projection("stere_equator", projection<>(proj4("+proj=stere +lat_0=0 +lon_0=0 +ellps=WGS84")));
+
+    // Projections without a batch kernel
+    test_projection("robin_km", projection<>(proj4("+proj=robin +R=6370997 +units=km")));
+    test_projection("bacon", projection<>(proj4("+proj=bacon +R=6370997")), false);
+
+    {
+        using namespace bg::srs::spar;
+        test_projection("static_tmerc",
+                        projection<parameters<proj_tmerc, ellps_wgs84, units_m> >());
+        test_projection("static_merc",
+                        projection<parameters<proj_merc, ellps_wgs84> >());
+        test_projection("static_aea",
+                        projection<parameters<proj_aea, ellps_grs80, lat_1<>, lat_2<> > >(
+                            parameters<proj_aea, ellps_grs80, lat_1<>, lat_2<> >(
+                                proj_aea(), ellps_grs80(), lat_1<>(29.5), lat_2<>(45.5))));
+    }
+
+    test_invalid();
+    test_not_invertible();
+
+    return 0;
+}
@@ -0,0 +1,276 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <algorithm>
+#include <cstddef>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> xy;
+typedef bg::model::linestring<ll> linestring_ll;
+typedef bg::model::linestring<xy> linestring_xy;
+typedef bg::model::polygon<ll> polygon_ll;
+typedef bg::model::polygon<xy> polygon_xy;
+
+typedef bg::srs::adaptive_densify<> densify;
+
+// Returns the maximum distance of the projections of points sampled along
+// the geodesics of the input linestring to the output linestring
+template <typename Projection>
+double max_distance(Projection const& prj, linestring_ll const& in,
+                    linestring_xy const& out)
+{
+    bg::strategy::line_interpolate::geographic<bg::strategy::vincenty> const strategy;
+    double result = 0;
+    for (std::size_t i = 0; i + 1 < in.size(); i++)
+    {
+        double const length = strategy.get_distance_pp_strategy().apply(in[i], in[i + 1]);
+        for (std::size_t j = 0; j <= 256; j++)
+        {
+            ll p;
+            strategy.apply(in[i], in[i + 1], j / 256.0, p, length);
+            xy q;
+            prj.forward(p, q);
+            result = (std::max)(result, bg::distance(q, out));
+        }
+    }
+    return result;
+}
+
+void test_linestring()
+{
+    bg::srs::projection<> prj = bg::srs::proj4("+proj=lcc +ellps=WGS84 +lat_1=33 +lat_2=45 +lon_0=-96");
+
+    linestring_ll ls;
+    bg::read_wkt("LINESTRING(-120 30,-70 30,-70 50,-120 50)", ls);
+
+    linestring_xy plain;
+    BOOST_CHECK(prj.forward(ls, plain));
+    BOOST_CHECK_EQUAL(plain.size(), ls.size());
+    double const plain_distance = max_distance(prj, ls, plain);
+
+    std::size_t previous_size = plain.size();
+    double const tolerances[] = { 10000.0, 100.0, 1.0 };
+    for (double tolerance : tolerances)
+    {
+        linestring_xy dense;
+        BOOST_CHECK(prj.forward(ls, dense, densify(tolerance)));
+
+        // The projected vertices are kept
+        BOOST_CHECK(bg::equals(dense.front(), plain.front()));
+        BOOST_CHECK(bg::equals(dense.back(), plain.back()));
+
+        // Smaller tolerance requires more points
+        BOOST_CHECK(dense.size() > previous_size);
+        previous_size = dense.size();
+
+        double const distance = max_distance(prj, ls, dense);
+        BOOST_CHECK_MESSAGE(distance <= 2 * tolerance,
+            "tolerance: " << tolerance << " distance: " << distance);
+        BOOST_CHECK(distance < plain_distance);
+    }
+
+    // The meridians are straight but not evenly scaled
+    linestring_ll meridian;
+    bg::read_wkt("LINESTRING(-96 30,-96 50)", meridian);
+    linestring_xy dense;
+    BOOST_CHECK(prj.forward(meridian, dense, densify(1.0)));
+    BOOST_CHECK_EQUAL(dense.size(), 2u);
+
+    // At most 2^max_depth - 1 points are inserted into a segment, the
+    // meridians are straight
+    BOOST_CHECK(prj.forward(ls, dense, densify(0.001, 2)));
+    BOOST_CHECK_EQUAL(dense.size(), ls.size() + 2 * 3);
+    BOOST_CHECK(prj.forward(ls, dense, densify(0.001, 0)));
+    BOOST_CHECK_EQUAL(dense.size(), ls.size());
+}
+
+void test_polygon()
+{
+    bg::srs::projection<> prj = bg::srs::proj4("+proj=lcc +ellps=WGS84 +lat_1=33 +lat_2=45 +lon_0=-96");
+
+    polygon_ll poly;
+    bg::read_wkt("POLYGON((-120 30,-120 50,-70 50,-70 30,-120 30),"
+                 "(-110 35,-80 35,-80 45,-110 45,-110 35))", poly);
+
+    polygon_xy dense;
+    BOOST_CHECK(prj.forward(poly, dense, densify(10.0)));
+    BOOST_CHECK(dense.outer().size() > poly.outer().size());
+    BOOST_CHECK_EQUAL(dense.inners().size(), 1u);
+    BOOST_CHECK(dense.inners()[0].size() > poly.inners()[0].size());
+    BOOST_CHECK(bg::equals(dense.outer().front(), dense.outer().back()));
+    BOOST_CHECK(bg::is_valid(dense));
+
+    // The segments of the reversed open rings are divided in the same way,
+    // including the closing segment
+    typedef bg::model::polygon<xy, false, false> polygon_ccw_open;
+    polygon_ccw_open dense_ccw;
+    BOOST_CHECK(prj.forward(poly, dense_ccw, densify(10.0)));
+    BOOST_CHECK_EQUAL(dense_ccw.outer().size() + 1, dense.outer().size());
+    BOOST_CHECK_EQUAL(dense_ccw.inners()[0].size() + 1, dense.inners()[0].size());
+    for (std::size_t i = 0; i < dense_ccw.outer().size(); i++)
+    {
+        BOOST_CHECK(bg::equals(dense_ccw.outer()[i],
+                               dense.outer()[dense.outer().size() - 1 - i]));
+    }
+
+    bg::model::multi_polygon<polygon_ll> mpoly;
+    mpoly.push_back(poly);
+    mpoly.push_back(poly);
+    bg::model::multi_polygon<polygon_xy> dense_mpoly;
+    BOOST_CHECK(prj.forward(mpoly, dense_mpoly, densify(10.0)));
+    BOOST_CHECK_EQUAL(bg::num_points(dense_mpoly), 2 * bg::num_points(dense));
+}
+
+void test_antimeridian()
+{
+    bg::srs::projection<> prj = bg::srs::proj4("+proj=merc +ellps=WGS84 +lon_0=180");
+
+    // The segment crosses the antimeridian, the central meridian of the
+    // projection, and is not divided at the other side of the globe
+    linestring_ll ls;
+    bg::read_wkt("LINESTRING(170 10,-170 10)", ls);
+
+    linestring_xy plain, dense;
+    BOOST_CHECK(prj.forward(ls, plain));
+    BOOST_CHECK(prj.forward(ls, dense, densify(100.0)));
+
+    // The geodesic bends towards the pole
+    BOOST_CHECK(dense.size() > plain.size());
+    BOOST_CHECK(bg::equals(dense.front(), plain.front()));
+    BOOST_CHECK(bg::equals(dense.back(), plain.back()));
+
+    double const max_x = bg::math::abs(bg::get<0>(plain.front())) + 1.0;
+    for (std::size_t i = 0; i < dense.size(); i++)
+    {
+        BOOST_CHECK_MESSAGE(bg::math::abs(bg::get<0>(dense[i])) <= max_x,
+            "x: " << bg::get<0>(dense[i]));
+        BOOST_CHECK(bg::get<1>(dense[i]) >= bg::get<1>(plain.front()) - 1.0);
+    }
+
+    double const distance = max_distance(prj, ls, dense);
+    BOOST_CHECK_MESSAGE(distance <= 200.0, "distance: " << distance);
+}
+
+void test_inverse()
+{
+    bg::srs::projection<> prj = bg::srs::proj4("+proj=lcc +ellps=WGS84 +lat_1=33 +lat_2=45 +lon_0=-96");
+
+    // A straight line in the projection is curved in geographic coordinates
+    linestring_xy ls;
+    ls.push_back(xy(-2000000, 4000000));
+    ls.push_back(xy(2000000, 4000000));
+
+    linestring_ll plain, dense;
+    BOOST_CHECK(prj.inverse(ls, plain));
+    BOOST_CHECK(prj.inverse(ls, dense, densify(0.01)));
+    BOOST_CHECK_EQUAL(plain.size(), 2u);
+    BOOST_CHECK(dense.size() > 2u);
+    BOOST_CHECK(bg::equals(dense.front(), plain.front()));
+    BOOST_CHECK(bg::equals(dense.back(), plain.back()));
+}
+
+void test_other_geometries()
+{
+    bg::srs::projection<> prj = bg::srs::proj4("+proj=lcc +ellps=WGS84 +lat_1=33 +lat_2=45 +lon_0=-96");
+
+    // The points of multi points, points and segments are only projected
+    bg::model::multi_point<ll> mpt;
+    bg::read_wkt("MULTIPOINT(-120 30,-70 30)", mpt);
+    bg::model::multi_point<xy> mpt_xy;
+    BOOST_CHECK(prj.forward(mpt, mpt_xy, densify(1.0)));
+    BOOST_CHECK_EQUAL(mpt_xy.size(), 2u);
+
+    xy pt;
+    BOOST_CHECK(prj.forward(ll(-70, 30), pt, densify(1.0)));
+
+    bg::model::segment<xy> seg;
+    BOOST_CHECK(prj.forward(bg::model::segment<ll>(ll(-120, 30), ll(-70, 30)), seg, densify(1.0)));
+
+    // Points which can not be projected are not divided
+    bg::srs::projection<> ortho = bg::srs::proj4("+proj=ortho +ellps=WGS84 +lat_0=0 +lon_0=0");
+    linestring_ll ls;
+    bg::read_wkt("LINESTRING(0 0,60 40,170 0)", ls);
+    linestring_xy dense;
+    BOOST_CHECK(! ortho.forward(ls, dense, densify(1.0)));
+    BOOST_CHECK(dense.size() > ls.size());
+    BOOST_CHECK(bg::get<0>(dense.back()) == HUGE_VAL);
+}
+
+void test_static()
+{
+    namespace par = bg::srs::spar;
+    typedef par::parameters<par::proj_lcc, par::ellps_wgs84, par::lat_1<>, par::lat_2<>, par::lon_0<> > params;
+    bg::srs::projection<params> prj_s(params(par::proj_lcc(), par::ellps_wgs84(), par::lat_1<>(33), par::lat_2<>(45), par::lon_0<>(-96)));
+    bg::srs::projection<> prj_d = bg::srs::proj4("+proj=lcc +ellps=WGS84 +lat_1=33 +lat_2=45 +lon_0=-96");
+
+    linestring_ll ls;
+    bg::read_wkt("LINESTRING(-120 30,-70 30,-70 50,-120 50)", ls);
+
+    linestring_xy dense_s, dense_d;
+    BOOST_CHECK(prj_s.forward(ls, dense_s, densify(10.0)));
+    BOOST_CHECK(prj_d.forward(ls, dense_d, densify(10.0)));
+    BOOST_CHECK_EQUAL(dense_s.size(), dense_d.size());
+    BOOST_CHECK(dense_s.size() > ls.size());
+}
+
+void test_transformation()
+{
+    bg::srs::transformation<> tr((bg::srs::proj4("+proj=longlat +ellps=WGS84")),
+                                 bg::srs::proj4("+proj=lcc +ellps=WGS84 +lat_1=33 +lat_2=45 +lon_0=-96"));
+    bg::srs::projection<> prj = bg::srs::proj4("+proj=lcc +ellps=WGS84 +lat_1=33 +lat_2=45 +lon_0=-96");
+
+    polygon_ll poly;
+    bg::read_wkt("POLYGON((-120 30,-120 50,-70 50,-70 30,-120 30))", poly);
+
+    polygon_xy expected, dense;
+    BOOST_CHECK(prj.forward(poly, expected, densify(10.0)));
+    BOOST_CHECK(tr.forward(poly, dense, densify(10.0)));
+    BOOST_CHECK_EQUAL(dense.outer().size(), expected.outer().size());
+    for (std::size_t i = 0; i < dense.outer().size(); i++)
+    {
+        BOOST_CHECK(bg::distance(dense.outer()[i], expected.outer()[i]) < 1e-6);
+    }
+
+    polygon_xy plain;
+    polygon_ll poly_inv;
+    BOOST_CHECK(tr.forward(poly, plain));
+    BOOST_CHECK(tr.inverse(plain, poly_inv, densify(0.001)));
+    BOOST_CHECK(poly_inv.outer().size() > plain.outer().size());
+
+    // In place transformation between projections
+    bg::srs::transformation<> tr_xy((bg::srs::proj4("+proj=merc +ellps=WGS84")),
+                                    bg::srs::proj4("+proj=lcc +ellps=WGS84 +lat_1=33 +lat_2=45 +lon_0=-96"));
+    polygon_xy poly_merc, poly_lcc;
+    BOOST_CHECK(bg::srs::projection<>(bg::srs::proj4("+proj=merc +ellps=WGS84")).forward(poly, poly_merc));
+    BOOST_CHECK(tr_xy.forward(poly_merc, poly_lcc, densify(10.0)));
+    BOOST_CHECK(tr_xy.forward(poly_merc, poly_merc, densify(10.0)));
+    BOOST_CHECK(poly_lcc.outer().size() > poly.outer().size());
+    BOOST_CHECK_EQUAL(poly_merc.outer().size(), poly_lcc.outer().size());
+    BOOST_CHECK(bg::equals(poly_merc, poly_lcc));
+}
+
+int test_main(int, char* [])
+{
+    test_linestring();
+    test_polygon();
+    test_antimeridian();
+    test_inverse();
+    test_other_geometries();
+    test_static();
+    test_transformation();
+
+    return 0;
+}
@@ -0,0 +1,255 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+template <typename Geometry>
+std::string to_wkt(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << std::setprecision(17) << bg::wkt(geometry);
+    return out.str();
+}
+
+// Circle of count points around (x, y), closed if the ring is closed
+template <typename Ring>
+Ring circle(double x, double y, double radius, std::size_t count)
+{
+    typedef typename bg::point_type<Ring>::type point_type;
+
+    Ring ring;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const angle = -2.0 * bg::math::pi<double>() * i / count;
+        bg::append(ring, point_type(x + radius * std::cos(angle),
+                                    y + radius * std::sin(angle)));
+    }
+    if (bg::closure<Ring>::value == bg::closed)
+    {
+        bg::append(ring, ring.front());
+    }
+    return ring;
+}
+
+template <typename Polygon>
+Polygon circle_polygon(double x, double y, double radius, std::size_t count)
+{
+    typedef typename bg::ring_type<Polygon>::type ring_type;
+
+    Polygon polygon;
+    bg::exterior_ring(polygon) = circle<ring_type>(x, y, radius, count);
+    ring_type hole = circle<ring_type>(x, y, radius / 2.0, count / 2);
+    std::reverse(hole.begin(), hole.end());
+    bg::interior_rings(polygon).push_back(hole);
+    bg::interior_rings(polygon).push_back(ring_type());
+    return polygon;
+}
+
+// Projects the geometry with one thread and with multiple threads,
+// and checks that the results and the returned values are equal
+template <typename Out, typename In, typename Projection>
+void test_projection(std::string const& caseid, In const& in,
+                     Projection const& prj, bool expected_result = true)
+{
+    Out expected;
+    bool const result = prj.forward(in, expected);
+    BOOST_CHECK_MESSAGE(result == expected_result,
+        caseid << " forward: " << result << " expected: " << expected_result);
+
+    Out expected_inv;
+    bool const result_inv = prj.inverse(expected, expected_inv);
+
+    std::size_t const thread_counts[] = { 1, 2, 3, 0 };
+    for (std::size_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); i++)
+    {
+        Out out;
+        BOOST_CHECK_EQUAL(prj.forward(in, out, thread_counts[i]), result);
+        BOOST_CHECK_MESSAGE(to_wkt(out) == to_wkt(expected),
+            caseid << " forward threads: " << thread_counts[i]);
+
+        Out out_inv;
+        BOOST_CHECK_EQUAL(prj.inverse(expected, out_inv, thread_counts[i]), result_inv);
+        BOOST_CHECK_MESSAGE(to_wkt(out_inv) == to_wkt(expected_inv),
+            caseid << " inverse threads: " << thread_counts[i]);
+    }
+}
+
+template <typename Out, typename In, typename Transformation>
+void test_transformation(std::string const& caseid, In const& in,
+                         Transformation const& tr)
+{
+    Out expected;
+    bool const result = tr.forward(in, expected);
+
+    Out expected_inv;
+    bool const result_inv = tr.inverse(expected, expected_inv);
+
+    std::size_t const thread_counts[] = { 1, 2, 3, 0 };
+    for (std::size_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); i++)
+    {
+        Out out;
+        BOOST_CHECK_EQUAL(tr.forward(in, out, thread_counts[i]), result);
+        BOOST_CHECK_MESSAGE(to_wkt(out) == to_wkt(expected),
+            caseid << " forward threads: " << thread_counts[i]);
+
+        Out out_inv;
+        BOOST_CHECK_EQUAL(tr.inverse(expected, out_inv, thread_counts[i]), result_inv);
+        BOOST_CHECK_MESSAGE(to_wkt(out_inv) == to_wkt(expected_inv),
+            caseid << " inverse threads: " << thread_counts[i]);
+    }
+
+    // In place
+    Out in_place = in;
+    BOOST_CHECK_EQUAL(tr.forward(in_place, in_place, 2), result);
+    BOOST_CHECK_MESSAGE(to_wkt(in_place) == to_wkt(expected),
+        caseid << " forward in place");
+}
+
+void test_projections()
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+    typedef bg::model::ring<point_ll> ring_ll;
+    typedef bg::model::ring<point_xy> ring_xy;
+    typedef bg::model::ring<point_xy, false, false> ccw_open_ring_xy;
+    typedef bg::model::polygon<point_ll> polygon_ll;
+    typedef bg::model::polygon<point_xy> polygon_xy;
+    typedef bg::model::multi_polygon<polygon_ll> multi_polygon_ll;
+    typedef bg::model::multi_polygon<polygon_xy> multi_polygon_xy;
+    typedef bg::model::linestring<point_ll> linestring_ll;
+    typedef bg::model::linestring<point_xy> linestring_xy;
+    typedef bg::model::multi_linestring<linestring_ll> multi_linestring_ll;
+    typedef bg::model::multi_linestring<linestring_xy> multi_linestring_xy;
+    typedef bg::model::multi_point<point_ll> multi_point_ll;
+    typedef bg::model::multi_point<point_xy> multi_point_xy;
+    typedef bg::model::segment<point_ll> segment_ll;
+    typedef bg::model::segment<point_xy> segment_xy;
+
+    bg::srs::projection<> const tmerc = bg::srs::proj4("+proj=tmerc +ellps=WGS84 +lon_0=10 +units=m");
+    bg::srs::projection<> const merc = bg::srs::proj4("+proj=merc +ellps=WGS84 +units=m");
+
+    ring_ll const ring = circle<ring_ll>(10.0, 50.0, 5.0, 5000);
+    test_projection<ring_xy>("ring", ring, tmerc);
+    test_projection<ccw_open_ring_xy>("ring_ccw_open", ring, tmerc);
+    test_projection<ring_xy>("ring_small", circle<ring_ll>(10.0, 50.0, 5.0, 10), tmerc);
+    test_projection<ring_xy>("ring_empty", ring_ll(), tmerc);
+
+    polygon_ll const polygon = circle_polygon<polygon_ll>(10.0, 50.0, 5.0, 3000);
+    test_projection<polygon_xy>("polygon", polygon, tmerc);
+
+    multi_polygon_ll multi_polygon;
+    for (int i = 0; i < 10; i++)
+    {
+        multi_polygon.push_back(circle_polygon<polygon_ll>(i * 10.0, 50.0, 4.0, 500 + i * 100));
+    }
+    test_projection<multi_polygon_xy>("multi_polygon", multi_polygon, merc);
+
+    multi_linestring_ll multi_linestring;
+    multi_point_ll multi_point;
+    for (int i = 0; i < 5; i++)
+    {
+        linestring_ll linestring;
+        for (int j = 0; j < 2000; j++)
+        {
+            bg::append(linestring, point_ll(-170.0 + j * 0.17, -80.0 + i * 40.0));
+            bg::append(multi_point, point_ll(-170.0 + j * 0.17, -80.0 + i * 40.0));
+        }
+        multi_linestring.push_back(linestring);
+    }
+    test_projection<multi_linestring_xy>("multi_linestring", multi_linestring, merc);
+    test_projection<multi_point_xy>("multi_point", multi_point, merc);
+
+    test_projection<point_xy>("point", point_ll(11.0, 51.0), tmerc);
+    test_projection<segment_xy>("segment", segment_ll(point_ll(11.0, 51.0), point_ll(12.0, 52.0)), tmerc);
+
+    // Points at the poles can not be projected, and are set to HUGE_VAL
+    // in every chunk containing them
+    multi_linestring_ll with_poles = multi_linestring;
+    bg::range::at(with_poles, 1)[10] = point_ll(0.0, 90.0);
+    bg::range::at(with_poles, 3)[1500] = point_ll(0.0, -90.0);
+    bg::range::at(with_poles, 4).back() = point_ll(0.0, 90.0);
+    test_projection<multi_linestring_xy>("multi_linestring_poles", with_poles, merc, false);
+}
+
+template <typename T>
+void test_transformations()
+{
+    typedef bg::model::point<T, 2, bg::cs::cartesian> point;
+    typedef bg::model::ring<point> ring;
+    typedef bg::model::polygon<point> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<point> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::multi_point<point> multi_point;
+    typedef bg::model::segment<point> segment;
+
+    // Longitudes and latitudes in radians
+    double const d2r = bg::math::d2r<double>();
+
+    bg::srs::transformation<> const tr(
+        bg::srs::proj4("+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs"),
+        bg::srs::proj4("+proj=tmerc +ellps=airy +datum=OSGB36 +lon_0=-2 +units=m"));
+
+    ring const r = circle<ring>(-2.0 * d2r, 54.0 * d2r, 3.0 * d2r, 3000);
+    test_transformation<ring>("ring", r, tr);
+
+    polygon const p = circle_polygon<polygon>(-2.0 * d2r, 54.0 * d2r, 3.0 * d2r, 3000);
+    test_transformation<polygon>("polygon", p, tr);
+
+    multi_polygon mp;
+    multi_linestring mls;
+    multi_point mpt;
+    for (int i = 0; i < 4; i++)
+    {
+        mp.push_back(circle_polygon<polygon>((i - 2) * d2r, 54.0 * d2r, 0.5 * d2r, 1000 + i * 300));
+        mls.push_back(circle<linestring>((i - 2) * d2r, 52.0 * d2r, 0.5 * d2r, 1500));
+        for (std::size_t j = 0; j < 500; j++)
+        {
+            mpt.push_back(bg::range::at(mls.back(), j));
+        }
+    }
+    test_transformation<multi_polygon>("multi_polygon", mp, tr);
+    test_transformation<multi_linestring>("multi_linestring", mls, tr);
+    test_transformation<multi_point>("multi_point", mpt, tr);
+
+    test_transformation<point>("point", point(-2.0 * d2r, 54.0 * d2r), tr);
+    test_transformation<segment>("segment", segment(point(-2.0 * d2r, 54.0 * d2r),
+                                                    point(-1.0 * d2r, 55.0 * d2r)), tr);
+
+    // Grids which are not shared are used by one thread
+    bg::srs::grids_storage<> storage;
+    bg::srs::transformation_grids<bg::srs::grids_storage<> > const grids
+        = tr.initialize_grids(storage);
+    ring expected, out;
+    tr.forward(r, expected, grids);
+    tr.forward(r, out, grids, 4);
+    BOOST_CHECK(to_wkt(out) == to_wkt(expected));
+}
+
+int test_main(int, char* [])
+{
+    test_projections();
+    test_transformations<double>();
+    test_transformations<float>();
+
+    return 0;
+}
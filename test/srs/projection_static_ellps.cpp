@@ -0,0 +1,191 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <utility>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/projection.hpp>
+
+
+namespace par = bg::srs::spar;
+namespace pd = bg::projections::detail;
+
+template <typename T, int Id>
+void check_ellps_constants()
+{
+    typedef pd::pj_ell_static<T, Id> ell;
+
+    // Evaluated at compile time
+    constexpr T a = ell::a();
+    constexpr T es = ell::es();
+    constexpr T e = ell::e();
+    constexpr T ra = ell::ra();
+    constexpr T one_es = ell::one_es();
+    constexpr T rone_es = ell::rone_es();
+
+    // Calculated like in pj_init()
+    pd::pj_ellps_type<T> const& ellps = pd::pj_get_ellps<T>().first[Id];
+    T const rt_es = pd::pj_ell_b_to_es(ellps.a, ellps.b);
+    T const rt_one_es = 1. - rt_es;
+
+    BOOST_CHECK_EQUAL(a, ellps.a);
+    BOOST_CHECK_EQUAL(es, rt_es);
+    BOOST_CHECK_EQUAL(e, T(std::sqrt(rt_es)));
+    BOOST_CHECK_EQUAL(ra, T(1. / ellps.a));
+    BOOST_CHECK_EQUAL(one_es, rt_one_es);
+    BOOST_CHECK_EQUAL(rone_es, T(1. / rt_one_es));
+
+    constexpr pd::en<T> en = pd::pj_enfn(es);
+    pd::en<T> const rt_en = pd::pj_enfn(rt_es);
+    for (std::size_t i = 0; i < pd::en<T>::size; i++)
+    {
+        BOOST_CHECK_EQUAL(en[i], rt_en[i]);
+    }
+}
+
+template <typename T, int ...Ids>
+void check_ellps_constants(std::integer_sequence<int, Ids...>)
+{
+    int dummy[] = { (check_ellps_constants<T, Ids>(), 0)... };
+    (void)dummy;
+}
+
+template <typename T>
+void test_sqrt()
+{
+    T const values[] = { T(0.25), T(0.5), T(2), T(3), T(1e-3), T(6.69438e-3), T(1e30) };
+    for (T v : values)
+    {
+        BOOST_CHECK_EQUAL(pd::pj_ell_sqrt(v), T(std::sqrt(v)));
+    }
+    BOOST_CHECK_EQUAL(pd::pj_ell_sqrt(T(0)), T(0));
+    BOOST_CHECK_EQUAL(pd::pj_ell_sqrt(T(-1)), T(0));
+}
+
+template <typename Params>
+constexpr int ellps_id()
+{
+    return pd::static_ellps_id<Params>::value;
+}
+
+void test_ellps_id()
+{
+    static_assert(ellps_id<par::parameters<par::proj_tmerc> >() == bg::srs::dpar::ellps_wgs84, "");
+    static_assert(ellps_id<par::parameters<par::proj_tmerc, par::ellps_bessel> >() == bg::srs::dpar::ellps_bessel, "");
+    static_assert(ellps_id<par::parameters<par::proj_tmerc, par::datum_potsdam> >() == bg::srs::dpar::ellps_bessel, "");
+    static_assert(ellps_id<par::parameters<par::proj_tmerc, par::ellps_clrk66, par::datum_potsdam> >() == bg::srs::dpar::ellps_clrk66, "");
+    static_assert(ellps_id<par::parameters<par::proj_tmerc, par::ellps_sphere> >() == bg::srs::dpar::ellps_sphere, "");
+    // Defined directly
+    static_assert(ellps_id<par::parameters<par::proj_tmerc, par::ellps_bessel, par::a<> > >() == -1, "");
+    static_assert(ellps_id<par::parameters<par::proj_tmerc, par::ellps_bessel, par::rf<> > >() == -1, "");
+    static_assert(ellps_id<par::parameters<par::proj_tmerc, par::r<> > >() == -1, "");
+    static_assert(ellps_id<par::parameters<par::proj_tmerc, par::ellps_bessel, par::r_au> >() == -1, "");
+    static_assert(ellps_id<par::parameters<par::proj_tmerc, par::ellps<bg::srs::spheroid<double> > > >() == -1, "");
+    static_assert(ellps_id<bg::srs::dpar::parameters<> >() == -1, "");
+}
+
+template <typename StaticParams>
+void check_projection(StaticParams const& params, bg::srs::dpar::parameters<> const& dparams)
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > ll;
+    typedef bg::model::point<double, 2, bg::cs::cartesian> xy;
+
+    bg::srs::projection<StaticParams> prj_s(params);
+    bg::srs::projection<> prj_d(dparams);
+
+    for (double lon = -6; lon <= 6; lon += 1.5)
+    {
+        for (double lat = 10; lat <= 70; lat += 7.5)
+        {
+            ll const p(lon, lat);
+            xy xy_s, xy_d;
+            prj_s.forward(p, xy_s);
+            prj_d.forward(p, xy_d);
+            BOOST_CHECK_EQUAL(bg::get<0>(xy_s), bg::get<0>(xy_d));
+            BOOST_CHECK_EQUAL(bg::get<1>(xy_s), bg::get<1>(xy_d));
+
+            ll ll_s, ll_d;
+            prj_s.inverse(xy_s, ll_s);
+            prj_d.inverse(xy_d, ll_d);
+            BOOST_CHECK_EQUAL(bg::get<0>(ll_s), bg::get<0>(ll_d));
+            BOOST_CHECK_EQUAL(bg::get<1>(ll_s), bg::get<1>(ll_d));
+        }
+    }
+}
+
+void test_projections()
+{
+    using namespace bg::srs::dpar;
+    typedef bg::srs::dpar::parameters<> dpars;
+
+    check_projection(par::parameters<par::proj_tmerc, par::ellps_bessel, par::lat_0<>, par::k_0<> >(par::proj_tmerc(), par::ellps_bessel(), par::lat_0<>(30), par::k_0<>(0.9996)),
+                     dpars(proj_tmerc)(ellps_bessel)(lat_0, 30)(k_0, 0.9996));
+    check_projection(par::parameters<par::proj_tmerc>(),
+                     dpars(proj_tmerc));
+    check_projection(par::parameters<par::proj_poly, par::datum_potsdam>(),
+                     dpars(proj_poly)(datum_potsdam));
+    check_projection(par::parameters<par::proj_cass, par::ellps_clrk66, par::lat_0<> >(par::proj_cass(), par::ellps_clrk66(), par::lat_0<>(40)),
+                     dpars(proj_cass)(ellps_clrk66)(lat_0, 40));
+    check_projection(par::parameters<par::proj_aea, par::ellps_grs80, par::lat_1<>, par::lat_2<> >(par::proj_aea(), par::ellps_grs80(), par::lat_1<>(29.5), par::lat_2<>(45.5)),
+                     dpars(proj_aea)(ellps_grs80)(lat_1, 29.5)(lat_2, 45.5));
+    check_projection(par::parameters<par::proj_sinu, par::ellps_intl>(),
+                     dpars(proj_sinu)(ellps_intl));
+    check_projection(par::parameters<par::proj_eqdc, par::ellps_krass, par::lat_1<>, par::lat_2<> >(par::proj_eqdc(), par::ellps_krass(), par::lat_1<>(20), par::lat_2<>(60)),
+                     dpars(proj_eqdc)(ellps_krass)(lat_1, 20)(lat_2, 60));
+    // Not folded
+    check_projection(par::parameters<par::proj_tmerc, par::ellps_bessel, par::a<> >(par::proj_tmerc(), par::ellps_bessel(), par::a<>(6378000)),
+                     dpars(proj_tmerc)(ellps_bessel)(a, 6378000));
+}
+
+// The ellipsoid constants are folded for long double too
+void test_long_double()
+{
+    typedef bg::model::point<long double, 2, bg::cs::geographic<bg::degree> > ll;
+    typedef bg::model::point<long double, 2, bg::cs::cartesian> xy;
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > ll_d;
+    typedef bg::model::point<double, 2, bg::cs::cartesian> xy_d;
+
+    bg::srs::projection<par::parameters<par::proj_tmerc, par::ellps_wgs84>, long double> prj;
+    bg::srs::projection<> prj_d(bg::srs::dpar::parameters<>(bg::srs::dpar::proj_tmerc)(bg::srs::dpar::ellps_wgs84));
+
+    ll const p(3, 50);
+    xy q;
+    BOOST_CHECK(prj.forward(p, q));
+    xy_d q_d;
+    BOOST_CHECK(prj_d.forward(ll_d(3, 50), q_d));
+    BOOST_CHECK_CLOSE(double(bg::get<0>(q)), bg::get<0>(q_d), 1e-9);
+    BOOST_CHECK_CLOSE(double(bg::get<1>(q)), bg::get<1>(q_d), 1e-9);
+
+    ll r;
+    BOOST_CHECK(prj.inverse(q, r));
+    BOOST_CHECK_CLOSE(double(bg::get<0>(r)), 3.0, 1e-9);
+    BOOST_CHECK_CLOSE(double(bg::get<1>(r)), 50.0, 1e-9);
+}
+
+int test_main(int, char* [])
+{
+    int const count = bg::srs::dpar::ellps_sphere + 1;
+    BOOST_CHECK_EQUAL(pd::pj_get_ellps<double>().second, count);
+
+    check_ellps_constants<double>(std::make_integer_sequence<int, count>());
+    check_ellps_constants<float>(std::make_integer_sequence<int, count>());
+    check_ellps_constants<long double>(std::make_integer_sequence<int, count>());
+
+    test_sqrt<double>();
+    test_sqrt<float>();
+    test_sqrt<long double>();
+    test_ellps_id();
+    test_projections();
+    test_long_double();
+
+    return 0;
+}
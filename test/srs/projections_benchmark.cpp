@@ -0,0 +1,419 @@
+// Boost.Geometry
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the forward and inverse throughput of every projection of the
+// selftest, created with the dynamic (proj4) and the static (spar)
+// parameters, and the round-trip error of the projected points.
+// The report is written as CSV, one line per projection and interface:
+//   id,interface,points,forward_pps,inverse_pps,max_roundtrip_m,forward_failed,inverse_failed
+// inverse_pps and max_roundtrip_m are empty for not invertible projections.
+// Usage: projections_benchmark -- [report.csv [min_milliseconds_per_measurement]]
+
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <boost/geometry/srs/projection.hpp>
+
+#include "projection_selftest_cases.hpp"
+
+
+namespace par = bg::srs::spar;
+namespace pd = bg::projections::detail;
+
+// The type of the projection created for static parameters
+template <typename Params>
+struct static_projection_type
+{
+    typedef typename pd::static_projection_type
+        <
+            typename par::detail::pick_proj_tag<Params>::type,
+            typename pd::static_srs_tag<Params>::type,
+            Params,
+            double,
+            bg::projections::parameters<double>
+        >::type type;
+};
+
+template <typename Prj, typename P>
+std::true_type is_invertible_impl(pd::static_wrapper_fi<Prj, P> const*);
+std::false_type is_invertible_impl(...);
+
+template <typename Params>
+struct is_invertible
+    : decltype(is_invertible_impl(
+        static_cast<typename static_projection_type<Params>::type const*>(0)))
+{};
+
+struct measurement
+{
+    measurement()
+        : forward_pps(0), inverse_pps(0), max_roundtrip(0)
+        , forward_failed(0), inverse_failed(0)
+        , invertible(false)
+    {}
+
+    double forward_pps;
+    double inverse_pps;
+    double max_roundtrip;
+    std::size_t forward_failed;
+    std::size_t inverse_failed;
+    bool invertible;
+};
+
+class benchmark
+{
+    typedef std::chrono::steady_clock clock_type;
+
+public:
+    benchmark(char const* filename, double min_seconds, std::size_t grid_size)
+        : m_out(filename)
+        , m_min_seconds(min_seconds)
+    {
+        // Grid around the origins of the selftest cases
+        for (std::size_t i = 0; i < grid_size; i++)
+        {
+            for (std::size_t j = 0; j < grid_size; j++)
+            {
+                m_lon.push_back(-10.0 + 20.0 * double(i) / double(grid_size - 1));
+                m_lat.push_back(-10.0 + 20.0 * double(j) / double(grid_size - 1));
+            }
+        }
+    }
+
+    void header()
+    {
+        m_out << "id,interface,points,forward_pps,inverse_pps,max_roundtrip_m,"
+                     "forward_failed,inverse_failed" << std::endl;
+    }
+
+    void run_dynamic(std::string const& id, std::string const& args)
+    {
+        try
+        {
+            bg::srs::projection<> prj = bg::srs::proj4(args);
+            measurement m;
+            forward(prj, m);
+            try
+            {
+                inverse(prj, m);
+            }
+            catch (bg::projection_not_invertible_exception const&)
+            {}
+            report(id, "dynamic", m);
+        }
+        catch (bg::projection_exception const& e)
+        {
+            std::cerr << id << ": " << e.what() << std::endl;
+        }
+    }
+
+    template <typename ...Ps>
+    void run_static(std::string const& id, Ps const& ... ps)
+    {
+        typedef par::parameters<Ps...> params_type;
+        try
+        {
+            bg::srs::projection<params_type> prj(params_type(ps...));
+            measurement m;
+            forward(prj, m);
+            inverse(prj, m, is_invertible<params_type>());
+            report(id, "static", m);
+        }
+        catch (bg::projection_exception const& e)
+        {
+            std::cerr << id << ": " << e.what() << std::endl;
+        }
+    }
+
+private:
+    template <typename Projection>
+    void forward(Projection const& prj, measurement & m)
+    {
+        std::size_t const count = m_lon.size();
+        m_x.resize(count);
+        m_y.resize(count);
+
+        m.forward_pps = points_per_second([&]()
+        {
+            prj.forward(m_lon.data(), m_lat.data(), m_x.data(), m_y.data(), count);
+        });
+
+        m.forward_failed = std::size_t(std::count(m_x.begin(), m_x.end(), HUGE_VAL));
+    }
+
+    template <typename Projection>
+    void inverse(Projection const& , measurement & , std::false_type)
+    {}
+
+    template <typename Projection>
+    void inverse(Projection const& prj, measurement & m, std::true_type = std::true_type())
+    {
+        // Inverse of the successfully projected points
+        std::vector<double> x, y, lon, lat;
+        for (std::size_t i = 0; i < m_x.size(); i++)
+        {
+            if (m_x[i] != HUGE_VAL)
+            {
+                x.push_back(m_x[i]);
+                y.push_back(m_y[i]);
+                lon.push_back(m_lon[i]);
+                lat.push_back(m_lat[i]);
+            }
+        }
+
+        std::size_t const count = x.size();
+        std::vector<double> lon_out(count), lat_out(count);
+
+        m.inverse_pps = points_per_second([&]()
+        {
+            prj.inverse(x.data(), y.data(), lon_out.data(), lat_out.data(), count);
+        });
+
+        m.invertible = true;
+        m.inverse_failed = 0;
+        m.max_roundtrip = 0;
+        double const r = 6371008.8; // mean Earth radius
+        double const d2r = bg::math::d2r<double>();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            if (lon_out[i] == HUGE_VAL)
+            {
+                m.inverse_failed++;
+                continue;
+            }
+            // Longitudes may differ by a multiple of 360
+            double dlon = std::fmod(bg::math::abs(lon_out[i] - lon[i]), 360.0);
+            dlon = (std::min)(dlon, 360.0 - dlon);
+            double const dx = dlon * d2r * std::cos(lat[i] * d2r) * r;
+            double const dy = (lat_out[i] - lat[i]) * d2r * r;
+            m.max_roundtrip = (std::max)(m.max_roundtrip, std::sqrt(dx * dx + dy * dy));
+        }
+    }
+
+    // Repeats the projection of all points until the minimal time elapses
+    template <typename Function>
+    double points_per_second(Function const& f) const
+    {
+        f(); // warm-up
+        std::size_t repetitions = 0;
+        clock_type::time_point const start = clock_type::now();
+        double seconds = 0;
+        do
+        {
+            f();
+            repetitions++;
+            seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+        }
+        while (seconds < m_min_seconds);
+        return double(repetitions * m_lon.size()) / seconds;
+    }
+
+    void report(std::string const& id, char const* interface_name, measurement const& m)
+    {
+        m_out << id << ',' << interface_name << ',' << m_lon.size() << ','
+                  << std::fixed << std::setprecision(0) << m.forward_pps << ',';
+        if (m.invertible)
+        {
+            m_out << m.inverse_pps;
+        }
+        m_out << ',';
+        if (m.invertible)
+        {
+            m_out << std::scientific << std::setprecision(3) << m.max_roundtrip;
+        }
+        m_out << ',' << m.forward_failed << ',' << m.inverse_failed
+                  << std::defaultfloat << std::endl;
+    }
+
+    std::ofstream m_out;
+    double m_min_seconds;
+    std::vector<double> m_lon, m_lat, m_x, m_y;
+};
+
+void run_static_cases(benchmark & bench)
+{
+    // The same parameters as the selftest cases, chamb, geos and isea
+    // do not support static parameters
+    bench.run_static("aea_e", par::proj_aea(), par::ellps_grs80(), par::lat_1<>(0), par::lat_2<>(2));
+    bench.run_static("aea_s", par::proj_aea(), par::r<>(6400000), par::lat_1<>(0), par::lat_2<>(2));
+    bench.run_static("leac_e", par::proj_leac(), par::ellps_grs80(), par::lat_1<>(0), par::lat_2<>(2));
+    bench.run_static("leac_s", par::proj_leac(), par::r<>(6400000), par::lat_1<>(0), par::lat_2<>(2));
+    bench.run_static("aeqd_e", par::proj_aeqd(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("aeqd_s", par::proj_aeqd(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("airy", par::proj_airy(), par::a<>(6400000), par::lat_1<>(0), par::lat_2<>(2));
+    bench.run_static("aitoff", par::proj_aitoff(), par::r<>(6400000), par::lat_1<>(0), par::lat_2<>(2));
+    bench.run_static("wintri", par::proj_wintri(), par::a<>(6400000), par::lat_1<>(0), par::lat_2<>(2));
+    bench.run_static("august", par::proj_august(), par::a<>(6400000), par::lat_1<>(0), par::lat_2<>(2));
+    bench.run_static("bacon", par::proj_bacon(), par::a<>(6400000), par::lat_1<>(0), par::lat_2<>(2));
+    bench.run_static("apian", par::proj_apian(), par::a<>(6400000), par::lat_1<>(0), par::lat_2<>(2));
+    bench.run_static("ortel", par::proj_ortel(), par::a<>(6400000), par::lat_1<>(0), par::lat_2<>(2));
+    bench.run_static("bipc_e", par::proj_bipc(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("bipc_s", par::proj_bipc(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("boggs", par::proj_boggs(), par::a<>(6400000), par::lat_1<>(0), par::lat_2<>(2));
+    bench.run_static("bonne_e", par::proj_bonne(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("bonne_s", par::proj_bonne(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("cass_e", par::proj_cass(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("cass_s", par::proj_cass(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("cc", par::proj_cc(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("cea_e", par::proj_cea(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("cea_s", par::proj_cea(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("collg", par::proj_collg(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("crast", par::proj_crast(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("denoy", par::proj_denoy(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("eck1", par::proj_eck1(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("eck2", par::proj_eck2(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("eck3", par::proj_eck3(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("eck4", par::proj_eck4(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("eck5", par::proj_eck5(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("eqc", par::proj_eqc(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("eqdc_e", par::proj_eqdc(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("eqdc_s", par::proj_eqdc(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("fahey", par::proj_fahey(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("fouc_s", par::proj_fouc_s(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("gall", par::proj_gall(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("gins8", par::proj_gins8(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("sinu_e", par::proj_sinu(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("sinu_s", par::proj_sinu(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("eck6", par::proj_eck6(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("mbtfps", par::proj_mbtfps(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("gn_sinu", par::proj_gn_sinu(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::m<>(1), par::n<>(2));
+    bench.run_static("gnom", par::proj_gnom(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("goode", par::proj_goode(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("gstmerc", par::proj_gstmerc(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("hammer", par::proj_hammer(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("hatano", par::proj_hatano(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("healpix_e", par::proj_healpix(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("healpix_s", par::proj_healpix(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("rhealpix_e", par::proj_rhealpix(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("rhealpix_s", par::proj_rhealpix(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("igh", par::proj_igh(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("imw_p", par::proj_imw_p(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("krovak", par::proj_krovak(), par::ellps_grs80(), par::no_defs());
+    bench.run_static("labrd", par::proj_labrd(), par::ellps_grs80(), par::lon_0<>(0.5), par::lat_0<>(2));
+    bench.run_static("laea_e", par::proj_laea(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("laea_s", par::proj_laea(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("lagrng", par::proj_lagrng(), par::a<>(6400000), par::w<>(2), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("larr", par::proj_larr(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("lask", par::proj_lask(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("lcc", par::proj_lcc(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("lcca", par::proj_lcca(), par::ellps_grs80(), par::lat_0<>(1), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("loxim", par::proj_loxim(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("lsat", par::proj_lsat(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::lsat<1>(), par::path<2>());
+    bench.run_static("mbt_fps", par::proj_mbt_fps(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("mbtfpp", par::proj_mbtfpp(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("mbtfpq", par::proj_mbtfpq(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("merc_e", par::proj_merc(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("merc_s", par::proj_merc(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("mill", par::proj_mill(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("moll", par::proj_moll(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("wag4", par::proj_wag4(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("wag5", par::proj_wag5(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("natearth", par::proj_natearth(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("nell", par::proj_nell(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("nell_h", par::proj_nell_h(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("nicol", par::proj_nicol(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("nsper", par::proj_nsper(), par::a<>(6400000), par::h<>(1000000));
+    bench.run_static("tpers", par::proj_tpers(), par::a<>(6400000), par::h<>(1000000), par::azi<>(20));
+    bench.run_static("nzmg", par::proj_nzmg(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("ob_tran", par::proj_ob_tran(), par::a<>(6400000), par::o_proj<par::proj_latlon>(), par::o_lon_p<>(20), par::o_lat_p<>(20), par::lon_0<>(180));
+    bench.run_static("ocea", par::proj_ocea(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("oea", par::proj_oea(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(1), par::m<>(2), par::theta<>(3));
+    bench.run_static("omerc", par::proj_omerc(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("ortho", par::proj_ortho(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("poly_e", par::proj_poly(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("poly_s", par::proj_poly(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("putp2", par::proj_putp2(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("putp3", par::proj_putp3(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("putp3p", par::proj_putp3p(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("putp4p", par::proj_putp4p(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("weren", par::proj_weren(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("putp5", par::proj_putp5(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("putp5p", par::proj_putp5p(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("putp6", par::proj_putp6(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("putp6p", par::proj_putp6p(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("qsc_e", par::proj_qsc(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("qsc_s", par::proj_qsc(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("robin", par::proj_robin(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("rpoly", par::proj_rpoly(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("euler_e", par::proj_euler(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("euler_s", par::proj_euler(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("murd1_e", par::proj_murd1(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("murd1_s", par::proj_murd1(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("murd2_e", par::proj_murd2(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("murd2_s", par::proj_murd2(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("murd3_e", par::proj_murd3(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("murd3_s", par::proj_murd3(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("pconic_e", par::proj_pconic(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("pconic_s", par::proj_pconic(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("tissot_e", par::proj_tissot(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("tissot_s", par::proj_tissot(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("vitk1_e", par::proj_vitk1(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("vitk1_s", par::proj_vitk1(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("somerc_e", par::proj_somerc(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("somerc_s", par::proj_somerc(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("stere_e", par::proj_stere(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("stere_s", par::proj_stere(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("ups", par::proj_ups(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("sterea_e", par::proj_sterea(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("sterea_s", par::proj_sterea(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("fouc_e", par::proj_fouc(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("fouc_s", par::proj_fouc(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("kav5_e", par::proj_kav5(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("kav5_s", par::proj_kav5(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("qua_aut_e", par::proj_qua_aut(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("qua_aut_s", par::proj_qua_aut(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("mbt_s_e", par::proj_mbt_s(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("mbt_s_s", par::proj_mbt_s(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("tcc", par::proj_tcc(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("tcea", par::proj_tcea(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("tmerc_e", par::proj_tmerc(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("tmerc_s", par::proj_tmerc(), par::r<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("tpeqd_e", par::proj_tpeqd(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("tpeqd_s", par::proj_tpeqd(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("urm5", par::proj_urm5(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("urmfps", par::proj_urmfps(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("wag1", par::proj_wag1(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5));
+    bench.run_static("vandg", par::proj_vandg(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("vandg2", par::proj_vandg2(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("vandg3", par::proj_vandg3(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("vandg4", par::proj_vandg4(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("wag2", par::proj_wag2(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("wag3", par::proj_wag3(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("wag7", par::proj_wag7(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("wink1", par::proj_wink1(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("wink2", par::proj_wink2(), par::a<>(6400000), par::lat_1<>(0.5), par::lat_2<>(2));
+    bench.run_static("etmerc", par::proj_etmerc(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5), par::zone<30>());
+    bench.run_static("utm", par::proj_utm(), par::ellps_grs80(), par::lat_1<>(0.5), par::lat_2<>(2), par::n<>(0.5), par::zone<30>());
+}
+
+int test_main(int argc, char* argv[])
+{
+    char const* filename = argc > 1 ? argv[1] : "projections_benchmark.csv";
+    double const min_milliseconds = argc > 2 ? std::atof(argv[2]) : 50.0;
+
+    benchmark bench(filename, min_milliseconds / 1000.0, 64);
+    bench.header();
+
+    for (projection_case const& pcas : projection_cases)
+    {
+        bench.run_dynamic(pcas.id, pcas.args);
+    }
+
+    run_static_cases(bench);
+
+    return 0;
+}
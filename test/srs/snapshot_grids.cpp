@@ -0,0 +1,159 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/snapshot_grids.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+#include "grid_files.hpp"
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point;
+typedef bg::model::multi_point<point> multi_point;
+
+typedef bg::srs::grids_storage<> loaded_storage;
+typedef bg::srs::grids_storage<bg::srs::ifstream_policy, bg::srs::snapshot_grids> snapshot_storage;
+
+std::string const ntv2_name = "snapshot_grids_test.gsb";
+std::string const ctable2_name = "snapshot_grids_test.ct2";
+
+std::string const dst = "+proj=longlat +ellps=clrk66 +towgs84=0,0,0";
+
+std::string src(std::string const& nadgrids)
+{
+    return "+proj=longlat +ellps=clrk66 +nadgrids=" + nadgrids;
+}
+
+multi_point test_points()
+{
+    multi_point mpt;
+    for (double x = -1.0; x <= 23.0; x += 0.37)
+    {
+        for (double y = -9.0; y <= 51.0; y += 0.41)
+        {
+            mpt.push_back(point(x, y));
+        }
+    }
+    return mpt;
+}
+
+bool equal(multi_point const& mpt1, multi_point const& mpt2)
+{
+    if (mpt1.size() != mpt2.size())
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < mpt1.size(); i++)
+    {
+        if (bg::get<0>(mpt1[i]) != bg::get<0>(mpt2[i])
+         || bg::get<1>(mpt1[i]) != bg::get<1>(mpt2[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void test_serial(std::string const& nadgrids)
+{
+    bg::srs::transformation<> tr((bg::srs::proj4(src(nadgrids))), bg::srs::proj4(dst));
+    multi_point const mpt = test_points();
+
+    loaded_storage loaded;
+    bg::srs::transformation_grids<loaded_storage> const loaded_grids
+        = tr.initialize_grids(loaded);
+    multi_point expected_fwd, expected_inv;
+    BOOST_CHECK(tr.forward(mpt, expected_fwd, loaded_grids));
+    BOOST_CHECK(tr.inverse(mpt, expected_inv, loaded_grids));
+    BOOST_CHECK(! equal(mpt, expected_fwd));
+
+    snapshot_storage snapshot;
+    bg::srs::transformation_grids<snapshot_storage> const snapshot_grids
+        = tr.initialize_grids(snapshot);
+    multi_point fwd, inv;
+    BOOST_CHECK(tr.forward(mpt, fwd, snapshot_grids));
+    BOOST_CHECK(tr.inverse(mpt, inv, snapshot_grids));
+    BOOST_CHECK(equal(fwd, expected_fwd));
+    BOOST_CHECK(equal(inv, expected_inv));
+
+    // Loaded values are reused
+    BOOST_CHECK(tr.forward(mpt, fwd, snapshot_grids, 4));
+    BOOST_CHECK(equal(fwd, expected_fwd));
+}
+
+// Threads initializing grids of different files and loading the values
+// while other threads use them
+void test_concurrent()
+{
+    std::string const nadgrids[3] = { ntv2_name, ctable2_name,
+                                      ctable2_name + "," + ntv2_name };
+    multi_point const mpt = test_points();
+
+    multi_point expected[3];
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        bg::srs::transformation<> tr((bg::srs::proj4(src(nadgrids[i]))), bg::srs::proj4(dst));
+        loaded_storage loaded;
+        tr.forward(mpt, expected[i], tr.initialize_grids(loaded));
+    }
+
+    snapshot_storage storage;
+
+    std::size_t const thread_count = 6;
+    std::vector<char> valid(thread_count, 1);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < thread_count; t++)
+    {
+        threads.push_back(std::thread([&, t]()
+        {
+            for (std::size_t i = 0; i < 3; i++)
+            {
+                std::size_t const j = (t + i) % 3;
+                bg::srs::transformation<> tr((bg::srs::proj4(src(nadgrids[j]))), bg::srs::proj4(dst));
+                multi_point out;
+                if (! tr.forward(mpt, out, tr.initialize_grids(storage))
+                    || ! equal(out, expected[j]))
+                {
+                    valid[t] = 0;
+                }
+            }
+        }));
+    }
+    for (std::size_t t = 0; t < thread_count; t++)
+    {
+        threads[t].join();
+        BOOST_CHECK(valid[t]);
+    }
+
+    // Parent and child grids of NTv2 are stored in the same list
+    BOOST_CHECK_EQUAL(storage.hgrids.size(), 2u);
+}
+
+int test_main(int, char* [])
+{
+    write_ntv2(ntv2_name);
+    write_ctable2(ctable2_name);
+
+    test_serial(ntv2_name);
+    test_serial(ctable2_name);
+    test_concurrent();
+
+    std::remove(ntv2_name.c_str());
+    std::remove(ctable2_name.c_str());
+
+    return 0;
+}
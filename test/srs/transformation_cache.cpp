@@ -0,0 +1,137 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/epsg.hpp>
+#include <boost/geometry/srs/transformation_cache.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point;
+
+std::string const wgs84 = "+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs";
+
+std::string utm(int zone)
+{
+    return "+proj=utm +zone=" + std::to_string(zone) + " +ellps=WGS84 +datum=WGS84 +units=m +no_defs";
+}
+
+void test_cache()
+{
+    typedef bg::srs::transformation_cache<> cache_type;
+
+    cache_type cache(2);
+    BOOST_CHECK_EQUAL(cache.capacity(), 2u);
+    BOOST_CHECK_EQUAL(cache.size(), 0u);
+
+    cache_type::pointer const t31 = cache.get(bg::srs::proj4(wgs84), bg::srs::proj4(utm(31)));
+    cache_type::pointer const t31_hit = cache.get(bg::srs::proj4(wgs84), bg::srs::proj4(utm(31)));
+    BOOST_CHECK(t31 == t31_hit);
+    BOOST_CHECK_EQUAL(cache.hits(), 1u);
+    BOOST_CHECK_EQUAL(cache.misses(), 1u);
+
+    // The reversed pair is another transformation
+    cache_type::pointer const t31_inv = cache.get(bg::srs::proj4(utm(31)), bg::srs::proj4(wgs84));
+    BOOST_CHECK(t31 != t31_inv);
+    BOOST_CHECK_EQUAL(cache.misses(), 2u);
+    BOOST_CHECK_EQUAL(cache.size(), 2u);
+
+    // The least recently used, the reversed pair, is evicted
+    cache.get(bg::srs::proj4(wgs84), bg::srs::proj4(utm(31)));
+    cache.get(bg::srs::proj4(wgs84), bg::srs::proj4(utm(32)));
+    BOOST_CHECK_EQUAL(cache.size(), 2u);
+    BOOST_CHECK_EQUAL(cache.evictions(), 1u);
+    BOOST_CHECK(cache.get(bg::srs::proj4(wgs84), bg::srs::proj4(utm(31))) == t31);
+    BOOST_CHECK(cache.get(bg::srs::proj4(utm(31)), bg::srs::proj4(wgs84)) != t31_inv);
+    BOOST_CHECK_EQUAL(cache.hits(), 3u);
+    BOOST_CHECK_EQUAL(cache.misses(), 4u);
+    BOOST_CHECK_EQUAL(cache.evictions(), 2u);
+
+    // Evicted transformations in use are still valid
+    point const ll(3.0 * bg::math::d2r<double>(), 52.0 * bg::math::d2r<double>());
+    point xy, expected;
+    t31_inv->inverse(ll, xy);
+    bg::srs::transformation<>(bg::srs::proj4(wgs84), bg::srs::proj4(utm(31))).forward(ll, expected);
+    BOOST_CHECK_CLOSE(bg::get<0>(xy), bg::get<0>(expected), 1e-10);
+    BOOST_CHECK_CLOSE(bg::get<1>(xy), bg::get<1>(expected), 1e-10);
+
+    // Codes and proj4 strings can be combined
+    cache_type::pointer const epsg = cache.get(bg::srs::epsg(4326), bg::srs::epsg(32631));
+    BOOST_CHECK(cache.get(bg::srs::epsg(4326), bg::srs::epsg(32631)) == epsg);
+    BOOST_CHECK(cache.get(bg::srs::epsg(4326), bg::srs::proj4(utm(31))) != epsg);
+
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.size(), 0u);
+    BOOST_CHECK(cache.get(bg::srs::epsg(4326), bg::srs::epsg(32631)) != epsg);
+
+    // Invalid parameters are not cached
+    std::size_t const misses = cache.misses();
+    BOOST_CHECK_THROW(cache.get(bg::srs::proj4("+proj=unknown"), bg::srs::proj4(wgs84)),
+                      bg::projection_exception);
+    BOOST_CHECK_EQUAL(cache.misses(), misses + 1);
+    BOOST_CHECK_EQUAL(cache.size(), 1u);
+
+    // Nothing is cached without capacity
+    cache_type none(0);
+    BOOST_CHECK(none.get(bg::srs::proj4(wgs84), bg::srs::proj4(utm(31))));
+    BOOST_CHECK_EQUAL(none.size(), 0u);
+    BOOST_CHECK_EQUAL(none.misses(), 1u);
+}
+
+void test_concurrent()
+{
+    bg::srs::transformation_cache<> cache(4);
+
+    std::size_t const thread_count = 4;
+    std::size_t const calls = 200;
+    std::vector<char> valid(thread_count, 1);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < thread_count; t++)
+    {
+        threads.push_back(std::thread([&, t]()
+        {
+            for (std::size_t i = 0; i < calls; i++)
+            {
+                int const zone = 30 + static_cast<int>((i + t) % 6);
+                point const ll((zone * 6 - 183) * bg::math::d2r<double>(),
+                               45.0 * bg::math::d2r<double>());
+                point xy;
+                cache.get(bg::srs::proj4(wgs84), bg::srs::proj4(utm(zone)))->forward(ll, xy);
+                // Central meridian of the zone
+                if (bg::math::abs(bg::get<0>(xy) - 500000.0) > 1e-6)
+                {
+                    valid[t] = 0;
+                }
+            }
+        }));
+    }
+    for (std::size_t t = 0; t < thread_count; t++)
+    {
+        threads[t].join();
+        BOOST_CHECK(valid[t]);
+    }
+
+    BOOST_CHECK_EQUAL(cache.hits() + cache.misses(), thread_count * calls);
+    BOOST_CHECK_EQUAL(cache.size(), 4u);
+    BOOST_CHECK(cache.misses() - cache.evictions() >= cache.size());
+}
+
+int test_main(int, char* [])
+{
+    test_cache();
+    test_concurrent();
+
+    return 0;
+}
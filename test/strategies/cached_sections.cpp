@@ -0,0 +1,160 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/strategies/relate/cached_sections.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/relation.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Geometry1, typename Geometry2, typename Strategy>
+void check_relations(Geometry1 const& geometry1, Geometry2 const& geometry2,
+                     Strategy const& strategy)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry1) << " " << bg::wkt(geometry2);
+    std::string const caseid = out.str();
+
+    BOOST_CHECK_MESSAGE(bg::intersects(geometry1, geometry2, strategy)
+                        == bg::intersects(geometry1, geometry2),
+                        "intersects: " << caseid);
+    BOOST_CHECK_MESSAGE(bg::intersects(geometry2, geometry1, strategy)
+                        == bg::intersects(geometry2, geometry1),
+                        "intersects: " << caseid);
+    BOOST_CHECK_MESSAGE(bg::disjoint(geometry1, geometry2, strategy)
+                        == bg::disjoint(geometry1, geometry2),
+                        "disjoint: " << caseid);
+    BOOST_CHECK_MESSAGE(bg::relation(geometry1, geometry2, strategy).str()
+                        == bg::relation(geometry1, geometry2).str(),
+                        "relation: " << caseid);
+    BOOST_CHECK_MESSAGE(bg::relation(geometry2, geometry1, strategy).str()
+                        == bg::relation(geometry2, geometry1).str(),
+                        "relation: " << caseid);
+}
+
+template <typename Polygon, typename Geometry, typename Strategy>
+void check_overlay(Polygon const& polygon, Geometry const& geometry,
+                   Strategy const& strategy)
+{
+    typedef bg::model::multi_polygon<Polygon> multi_polygon;
+
+    multi_polygon expected, result;
+    bg::intersection(polygon, geometry, expected);
+    bg::intersection(polygon, geometry, result, strategy);
+    BOOST_CHECK_EQUAL(bg::area(result), bg::area(expected));
+
+    expected.clear();
+    result.clear();
+    bg::union_(geometry, polygon, expected);
+    bg::union_(geometry, polygon, result, strategy);
+    BOOST_CHECK_EQUAL(bg::area(result), bg::area(expected));
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, false, false> polygon_ccw_open;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+
+    polygon boundary;
+    bg::read_wkt("POLYGON((0 0,0 100,40 100,40 60,60 60,60 100,100 100,100 0,0 0),"
+                 "(10 10,30 10,30 30,10 30,10 10))", boundary);
+    polygon_ccw_open ccw;
+    bg::read_wkt("POLYGON((0 0,100 0,100 100,0 100))", ccw);
+    multi_linestring roads;
+    bg::read_wkt("MULTILINESTRING((-10 50,110 50),(50 -10,50 110))", roads);
+
+    bg::strategies::relate::cached_sections<P> strategy;
+    strategy.add(boundary);
+    strategy.add(ccw);
+    strategy.add(roads);
+    BOOST_CHECK_EQUAL(strategy.size(), 3u);
+
+    BOOST_CHECK(strategy.find_sections(boundary, false) != nullptr);
+    BOOST_CHECK(strategy.find_sections(boundary, true) == nullptr);
+    BOOST_CHECK(strategy.find_sections(ccw, true) != nullptr);
+    BOOST_CHECK(strategy.find_sections(bg::exterior_ring(boundary), false) == nullptr);
+
+    // The stored sections are the same as created by sectionalize
+    typename bg::strategies::relate::cached_sections<P>::sections_type sections;
+    bg::sectionalize<false, std::integer_sequence<std::size_t, 0, 1> >(boundary,
+        bg::detail::no_rescale_policy(), sections, strategy);
+    BOOST_CHECK_EQUAL(strategy.find_sections(boundary, false)->size(), sections.size());
+
+    // Copies share the sections
+    bg::strategies::relate::cached_sections<P> const copy = strategy;
+    BOOST_CHECK(copy.find_sections(roads, false) != nullptr);
+
+    std::string const features[] =
+    {
+        "POLYGON((20 20,20 25,25 25,25 20,20 20))",
+        "POLYGON((5 5,5 35,35 35,35 5,5 5))",
+        "POLYGON((45 70,45 80,55 80,55 70,45 70))",
+        "POLYGON((40 60,40 100,60 100,60 60,40 60))",
+        "POLYGON((90 90,90 110,110 110,110 90,90 90))",
+        "POLYGON((200 200,200 210,210 210,210 200,200 200))",
+        "POLYGON((0 0,0 100,100 100,100 0,0 0))",
+        "POLYGON((10 10,10 30,30 30,30 10,10 10))"
+    };
+
+    for (std::size_t i = 0; i < sizeof(features) / sizeof(features[0]); i++)
+    {
+        polygon feature;
+        bg::read_wkt(features[i], feature);
+
+        check_relations(boundary, feature, copy);
+        check_relations(ccw, feature, copy);
+        check_relations(roads, feature, copy);
+        check_overlay(boundary, feature, copy);
+        check_overlay(ccw, feature, copy);
+
+        linestring line;
+        bg::assign_points(line, bg::exterior_ring(feature));
+        check_relations(boundary, line, copy);
+        check_relations(roads, line, copy);
+    }
+
+    // Self turns
+    BOOST_CHECK(bg::is_valid(boundary, strategy));
+    polygon invalid;
+    bg::read_wkt("POLYGON((0 0,0 10,10 0,10 10,0 0))", invalid);
+    strategy.add(invalid);
+    BOOST_CHECK(! bg::is_valid(invalid, strategy));
+
+    // Not added geometries are sectionalized as usual
+    multi_polygon other;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 5,5 5,5 0,0 0)),((50 50,50 55,55 55,55 50,50 50)))", other);
+    check_relations(other, boundary, strategy);
+    check_overlay(boundary, other, strategy);
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<int, 2, bg::cs::cartesian> >();
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
@@ -0,0 +1,196 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+
+#include <strategies/test_within.hpp>
+
+#include <boost/geometry/strategies/cartesian/point_in_poly_indexed_winding.hpp>
+
+#include <boost/geometry/algorithms/for_each.hpp>
+
+#include <boost/geometry/geometries/linestring.hpp>
+#include <boost/geometry/geometries/multi_polygon.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+
+
+template <typename Point, typename Geometry, typename Strategy>
+void check_point(Point const& point, Geometry const& geometry,
+                 Strategy const& strategy)
+{
+    bool const within = bg::within(point, geometry);
+    bool const covered_by = bg::covered_by(point, geometry);
+
+    BOOST_CHECK_MESSAGE(bg::within(point, geometry, strategy) == within,
+        "within: " << bg::wkt(point) << " in " << bg::wkt(geometry)
+        << " -> Expected: " << within);
+    BOOST_CHECK_MESSAGE(bg::covered_by(point, geometry, strategy) == covered_by,
+        "covered_by: " << bg::wkt(point) << " in " << bg::wkt(geometry)
+        << " -> Expected: " << covered_by);
+}
+
+template <typename Geometry>
+void test_geometry(std::string const& wkt, std::size_t expected_ring_count)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef typename bg::coordinate_type<point_type>::type coordinate_type;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::strategy::within::cartesian_indexed_winding<point_type> const strategy(geometry);
+    BOOST_CHECK_EQUAL(strategy.ring_count(), expected_ring_count);
+
+    for (int x = -2; x <= 22; x++)
+    {
+        for (int y = -2; y <= 22; y++)
+        {
+            point_type const point(coordinate_type(x) / 2, coordinate_type(y) / 2);
+            check_point(point, geometry, strategy);
+        }
+    }
+    bg::for_each_point(geometry, [&](point_type const& point)
+    {
+        check_point(point, geometry, strategy);
+    });
+}
+
+template <typename Point>
+void test_large_ring()
+{
+    typedef typename bg::coordinate_type<Point>::type coordinate_type;
+    typedef bg::model::polygon<Point> polygon;
+
+    // Star shaped ring with many vertices, such that many segments overlap
+    // in x-direction
+    polygon star;
+    int const count = 5000;
+    double const pi = bg::math::pi<double>();
+    for (int i = 0; i <= count; i++)
+    {
+        double const angle = -2.0 * pi * (i % count) / count;
+        double const radius = i % 2 == 0 ? 10.0 : 4.0 + (i % 7);
+        bg::append(star, Point(coordinate_type(radius * std::cos(angle)),
+                               coordinate_type(radius * std::sin(angle))));
+    }
+
+    bg::strategy::within::cartesian_indexed_winding<Point> const strategy(star);
+
+    for (int x = -44; x <= 44; x++)
+    {
+        for (int y = -44; y <= 44; y++)
+        {
+            check_point(Point(coordinate_type(x) / 4, coordinate_type(y) / 4),
+                        star, strategy);
+        }
+    }
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        check_point(bg::exterior_ring(star)[i], star, strategy);
+    }
+}
+
+template <typename Point>
+void test_other_geometries()
+{
+    typedef bg::model::polygon<Point> polygon;
+    typedef bg::model::linestring<Point> linestring;
+
+    polygon indexed, other;
+    linestring line;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0))", indexed);
+    bg::read_wkt("POLYGON((20 0,20 10,30 10,30 0,20 0))", other);
+    bg::read_wkt("LINESTRING(0 0,5 5,10 0)", line);
+
+    bg::strategy::within::cartesian_indexed_winding<Point> const strategy(indexed);
+
+    // Geometries which are not indexed are processed without the index
+    check_point(Point(25, 5), other, strategy);
+    check_point(Point(20, 5), other, strategy);
+    check_point(Point(5, 5), other, strategy);
+
+    check_point(Point(5, 5), line, strategy);
+    check_point(Point(2, 2), line, strategy);
+    check_point(Point(0, 0), line, strategy);
+    check_point(Point(5, 0), line, strategy);
+}
+
+template <typename Point>
+void test_copies()
+{
+    typedef bg::model::polygon<Point> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    polygon indexed;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))", indexed);
+
+    bg::strategy::within::cartesian_indexed_winding<Point> const strategy(indexed);
+
+    // Copies of the rings are identified by their points
+    polygon const copy = indexed;
+    BOOST_CHECK(strategy.is_indexed(bg::exterior_ring(copy)));
+    BOOST_CHECK(strategy.is_indexed(bg::interior_rings(copy)[0]));
+    check_point(Point(5, 5), copy, strategy);
+    check_point(Point(1, 5), copy, strategy);
+    check_point(Point(2, 5), copy, strategy);
+
+    // Modified rings are not identified
+    polygon modified = indexed;
+    bg::range::at(bg::exterior_ring(modified), 1) = Point(0, 12);
+    BOOST_CHECK(! strategy.is_indexed(bg::exterior_ring(modified)));
+    BOOST_CHECK(strategy.is_indexed(bg::interior_rings(modified)[0]));
+    check_point(Point(1, 11), modified, strategy);
+    check_point(Point(5, 5), modified, strategy);
+
+    // Equal rings can not be identified and are not indexed
+    multi_polygon duplicates;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((0 0,0 10,10 10,10 0,0 0)),"
+                 "((20 0,20 10,30 10,30 0,20 0)))", duplicates);
+    bg::strategy::within::cartesian_indexed_winding<Point> const strategy_duplicates(duplicates);
+    BOOST_CHECK_EQUAL(strategy_duplicates.ring_count(), 1u);
+    BOOST_CHECK(! strategy_duplicates.is_indexed(bg::exterior_ring(duplicates[0])));
+    BOOST_CHECK(strategy_duplicates.is_indexed(bg::exterior_ring(duplicates[2])));
+    check_point(Point(5, 5), duplicates, strategy_duplicates);
+    check_point(Point(25, 5), duplicates, strategy_duplicates);
+    check_point(Point(15, 5), duplicates, strategy_duplicates);
+}
+
+template <typename Point>
+void test_all()
+{
+    typedef bg::model::ring<Point> ring;
+    typedef bg::model::polygon<Point> polygon;
+    typedef bg::model::polygon<Point, false, false> polygon_ccw_open;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    test_geometry<ring>("POLYGON((0 0,0 7,4 2,2 0,0 0))", 1);
+    test_geometry<ring>("POLYGON((0 0,0 10,5 5,10 10,10 0,5 5,0 0))", 1);
+    test_geometry<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),"
+            "(1 1,4 1,4 4,1 4,1 1),(5 5,5 9,9 9,9 5,5 5),(6 1,8 3,9 1,6 1))", 4);
+    test_geometry<polygon>("POLYGON((0 0,0 10,2 10,2 2,4 2,4 10,"
+            "6 10,6 2,8 2,8 10,10 10,10 0,0 0))", 1);
+    test_geometry<polygon_ccw_open>("POLYGON((0 0,10 0,10 10,0 10),(2 2,2 8,8 8,8 2))", 2);
+    test_geometry<multi_polygon>("MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0),(1 1,3 1,3 3,1 3,1 1)),"
+            "((4 4,4 8,8 8,8 4,4 4)),((2 2,2 2.5,2.5 2.5,2.5 2,2 2)),"
+            "((9 0,9 10,10 10,10 0,9 0)))", 5);
+    test_geometry<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,2 2,2 2,2 2))", 2);
+    test_geometry<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),())", 2);
+
+    test_large_ring<Point>();
+    test_other_geometries<Point>();
+    test_copies<Point>();
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<float, 2, bg::cs::cartesian> >();
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <sstream>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/strategies/relate/cached_sections.hpp>
+#include <boost/geometry/strategies/relate/sweep_sections.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/detail/overlay/self_turn_points.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/relation.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Multi polygon with count x count diamonds of the given radius, in cells
+// of size 1, shifted by offset
+std::string diamonds(int count, double radius, double offset = 0.0)
+{
+    std::ostringstream out;
+    out << "MULTIPOLYGON(";
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            double const x = i + 0.5 + offset;
+            double const y = j + 0.5 + offset;
+            out << (i > 0 || j > 0 ? "," : "") << "(("
+                << x - radius << " " << y << ","
+                << x << " " << y + radius << ","
+                << x + radius << " " << y << ","
+                << x << " " << y - radius << ","
+                << x - radius << " " << y << "))";
+        }
+    }
+    out << ")";
+    return out.str();
+}
+
+template <typename Geometry1, typename Geometry2, typename Strategy>
+void check_relations(std::string const& caseid,
+                     Geometry1 const& geometry1, Geometry2 const& geometry2,
+                     Strategy const& strategy)
+{
+    BOOST_CHECK_MESSAGE(bg::intersects(geometry1, geometry2, strategy)
+                        == bg::intersects(geometry1, geometry2),
+                        "intersects: " << caseid);
+    BOOST_CHECK_MESSAGE(bg::disjoint(geometry2, geometry1, strategy)
+                        == bg::disjoint(geometry2, geometry1),
+                        "disjoint: " << caseid);
+    BOOST_CHECK_MESSAGE(bg::relation(geometry1, geometry2, strategy).str()
+                        == bg::relation(geometry1, geometry2).str(),
+                        "relation: " << caseid);
+}
+
+template <typename MultiPolygon, typename Geometry, typename Strategy>
+void check_overlay(std::string const& caseid,
+                   MultiPolygon const& geometry1, Geometry const& geometry2,
+                   Strategy const& strategy)
+{
+    MultiPolygon expected, result;
+    bg::intersection(geometry1, geometry2, expected);
+    bg::intersection(geometry1, geometry2, result, strategy);
+    BOOST_CHECK_MESSAGE(result.size() == expected.size(),
+                        "intersection: " << caseid);
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+
+    expected.clear();
+    result.clear();
+    bg::union_(geometry1, geometry2, expected);
+    bg::union_(geometry1, geometry2, result, strategy);
+    BOOST_CHECK_MESSAGE(result.size() == expected.size(),
+                        "union: " << caseid);
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<P> linestring;
+
+    bg::strategies::relate::sweep_sections<> const strategy;
+
+    multi_polygon grid, grid_shifted, small;
+    bg::read_wkt(diamonds(12, 0.45), grid);
+    bg::read_wkt(diamonds(12, 0.45, 0.3), grid_shifted);
+    bg::read_wkt(diamonds(12, 0.1), small);
+
+    check_relations("grid_shifted", grid, grid_shifted, strategy);
+    check_relations("grid_small", grid, small, strategy);
+    check_overlay("grid_shifted", grid, grid_shifted, strategy);
+    check_overlay("grid_small", grid, small, strategy);
+
+    // Only the last diamond crosses another one
+    multi_polygon separated;
+    bg::read_wkt(diamonds(12, 0.2, 0.5), separated);
+    check_relations("grid_separated", small, separated, strategy);
+    polygon crossing;
+    bg::read_wkt("POLYGON((11.5 11.3,11.3 11.5,11.5 11.7,11.7 11.5,11.5 11.3))", crossing);
+    separated.push_back(crossing);
+    check_relations("grid_crossing", small, separated, strategy);
+
+    // A wavy line along the grid
+    linestring line;
+    for (int i = 0; i <= 240; i++)
+    {
+        bg::append(line, P(i * 0.05, 6.0 + 5.0 * std::sin(i * 0.1)));
+    }
+    check_relations("grid_line", grid, line, strategy);
+    check_relations("grid_line", small, line, strategy);
+
+    // Self turns
+    BOOST_CHECK(bg::is_valid(grid, strategy));
+    polygon invalid;
+    bg::read_wkt("POLYGON((0 0,0 10,10 0,10 10,0 0))", invalid);
+    BOOST_CHECK(! bg::is_valid(invalid, strategy));
+    BOOST_CHECK(bg::detail::overlay::has_self_intersections(invalid,
+                    strategy, bg::detail::no_rescale_policy(), false));
+
+    // Together with cached sections
+    bg::strategies::relate::cached_sections
+        <
+            P, bg::strategies::relate::sweep_sections<>
+        > cached;
+    cached.add(grid);
+    check_relations("cached_grid_shifted", grid, grid_shifted, cached);
+    check_overlay("cached_grid_shifted", grid, grid_shifted, cached);
+
+    BOOST_CHECK((bg::detail::section::has_sweep_sections<decltype(cached)>::value));
+    BOOST_CHECK((! bg::detail::section::has_sweep_sections
+                    <
+                        bg::strategies::relate::cartesian<>
+                    >::value));
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}